@@ -0,0 +1,90 @@
+#pragma once
+
+/** @file bench_Khronos.hpp
+	@date 2026-10-18
+	@brief Khronos library benchmark common declarations.
+
+	Every benchmark converts a batch of BENCH_BATCH dates per iteration, so
+	ns/op is per date.  Batches are drawn from three date ranges, in both
+	ascending (sorted) and shuffled (random) order.
+	*/
+
+#include <khronos.hpp>
+#include <gats/BenchApp.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define CONVERSION_GROUP	"{1} Conversions"
+#define CALENDAR_GROUP		"{2} Calendar Classes"
+#define JD_GROUP			"{3} Jd Class"
+
+
+constexpr std::size_t BENCH_BATCH = 1'024;
+
+enum class bench_range { ancient, modern, future };
+enum class bench_order { sorted, random };
+
+constexpr bench_range BENCH_RANGES[] = { bench_range::ancient, bench_range::modern, bench_range::future };
+constexpr bench_order BENCH_ORDERS[] = { bench_order::sorted, bench_order::random };
+
+
+/** Benchmark name: "subject/range/order". */
+inline std::string bench_name(std::string const& subject, bench_range range, bench_order order) {
+	char const* const rangeNames[] = { "ancient", "modern", "future" };
+	return subject + "/" + rangeNames[int(range)] + "/" + (order == bench_order::sorted ? "sorted" : "random");
+}
+
+
+/**	Batch of JDs (with times of day) from a date range.
+		ancient:	4713 BCE .. 1976 BCE
+		modern:		1900 CE .. 2100 CE
+		future:		10000 CE .. 12000 CE
+	*/
+inline std::vector<khronos::jd_t> const& bench_jds(bench_range range, bench_order order) {
+	static std::map<std::pair<bench_range, bench_order>, std::vector<khronos::jd_t>> cache;
+	auto& jds = cache[{ range, order }];
+	if (jds.empty()) {
+		std::pair<khronos::jd_t, khronos::jd_t> const bounds[] = {
+			{ 0.0, 1'000'000.0 }, { 2'415'020.5, 2'488'069.5 }, { 5'373'484.5, 6'103'965.5 } };
+		std::mt19937_64 rng(20261018 + int(range));
+		std::uniform_real_distribution<khronos::jd_t> dist(bounds[int(range)].first, bounds[int(range)].second);
+		for (std::size_t i = 0; i < BENCH_BATCH; ++i)
+			jds.push_back(std::floor(dist(rng) * 86'400.0) / 86'400.0);	// whole seconds
+		if (order == bench_order::sorted)
+			std::sort(jds.begin(), jds.end());
+	}
+	return jds;
+}
+
+
+/** Calendar fields of a JD batch. */
+struct bench_fields {
+	std::vector<khronos::year_t>	year;
+	std::vector<khronos::month_t>	month;
+	std::vector<khronos::day_t>		day;
+	std::vector<khronos::hour_t>	hour;
+	std::vector<khronos::minute_t>	minute;
+	std::vector<khronos::second_t>	second;
+};
+
+template <typename FromJd>
+bench_fields make_bench_fields(std::vector<khronos::jd_t> const& jds, FromJd fromJd) {
+	bench_fields fields;
+	for (auto jd : jds) {
+		khronos::year_t y; khronos::month_t m; khronos::day_t d; khronos::hour_t h; khronos::minute_t mi; khronos::second_t s;
+		fromJd(jd, y, m, d, h, mi, s);
+		fields.year.push_back(y);
+		fields.month.push_back(m);
+		fields.day.push_back(d);
+		fields.hour.push_back(h);
+		fields.minute.push_back(mi);
+		fields.second.push_back(s);
+	}
+	return fields;
+}
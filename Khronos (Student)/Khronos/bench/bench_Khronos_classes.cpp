@@ -0,0 +1,116 @@
+/** @file bench_Khronos_classes.cpp
+	@date 2026-10-18
+	@brief Benchmarks of the calendar classes.
+
+	The calendar classes have no day arithmetic of their own; adding days
+	is measured as the round trip calendar -> Jd -> calendar.
+	*/
+
+#include "bench_Khronos.hpp"
+using namespace khronos;
+
+
+namespace {
+
+	template <typename Calendar>
+	std::vector<Calendar> bench_dates(bench_range range, bench_order order) {
+		std::vector<Calendar> dates;
+		for (auto jd : bench_jds(range, order))
+			dates.push_back(Calendar(jd));
+		return dates;
+	}
+
+
+	/** Registers a benchmark applying 'op' to each date of a batch (and its mirror for binary operators). */
+	template <typename Calendar, typename Op>
+	void register_date_op(std::string const& subject, Op op) {
+		for (auto range : BENCH_RANGES)
+			for (auto order : BENCH_ORDERS)
+				gats::BenchApp::add(bench_name(subject, range, order), CALENDAR_GROUP, [op, range, order](gats::BenchApp::State& state) {
+					auto const dates = bench_dates<Calendar>(range, order);
+					state.set_items_per_iteration(BENCH_BATCH);
+					for ([[maybe_unused]] auto _ : state)
+						for (std::size_t i = 0; i < BENCH_BATCH; ++i)
+							gats::do_not_optimize(op(dates[i], dates[BENCH_BATCH - 1 - i]));
+				});
+	}
+
+
+	/** Registers the constructor benchmarks of a calendar. */
+	template <typename Calendar, typename FromJd>
+	void register_constructors(std::string const& name, FromJd fromJd) {
+		for (auto range : BENCH_RANGES)
+			for (auto order : BENCH_ORDERS) {
+				gats::BenchApp::add(bench_name(name + "(jd)", range, order), CALENDAR_GROUP, [range, order](gats::BenchApp::State& state) {
+					auto const& jds = bench_jds(range, order);
+					state.set_items_per_iteration(BENCH_BATCH);
+					for ([[maybe_unused]] auto _ : state)
+						for (std::size_t i = 0; i < BENCH_BATCH; ++i)
+							gats::do_not_optimize(Calendar(jds[i]));
+				});
+
+				gats::BenchApp::add(bench_name(name + "(ymd)", range, order), CALENDAR_GROUP, [fromJd, range, order](gats::BenchApp::State& state) {
+					auto const fields = make_bench_fields(bench_jds(range, order), fromJd);
+					state.set_items_per_iteration(BENCH_BATCH);
+					for ([[maybe_unused]] auto _ : state)
+						for (std::size_t i = 0; i < BENCH_BATCH; ++i)
+							gats::do_not_optimize(Calendar(fields.year[i], fields.month[i], fields.day[i]));
+				});
+
+				gats::BenchApp::add(bench_name(name + "(ymdhms)", range, order), CALENDAR_GROUP, [fromJd, range, order](gats::BenchApp::State& state) {
+					auto const fields = make_bench_fields(bench_jds(range, order), fromJd);
+					state.set_items_per_iteration(BENCH_BATCH);
+					for ([[maybe_unused]] auto _ : state)
+						for (std::size_t i = 0; i < BENCH_BATCH; ++i)
+							gats::do_not_optimize(Calendar(fields.year[i], fields.month[i], fields.day[i], fields.hour[i], fields.minute[i], fields.second[i]));
+				});
+			}
+
+		gats::BenchApp::add(name + "()", CALENDAR_GROUP, [](gats::BenchApp::State& state) {
+			for ([[maybe_unused]] auto _ : state)
+				gats::do_not_optimize(Calendar());
+		});
+
+		gats::BenchApp::add(name + "(WTIMEOFDAY)", CALENDAR_GROUP, [](gats::BenchApp::State& state) {
+			for ([[maybe_unused]] auto _ : state)
+				gats::do_not_optimize(Calendar(WTIMEOFDAY));
+		});
+	}
+
+
+	template <typename Calendar, typename FromJd>
+	void register_calendar(std::string const& name, FromJd fromJd) {
+		register_constructors<Calendar>(name, fromJd);
+
+		register_date_op<Calendar>(name + "+=years", [](Calendar date, Calendar const&) { return date += 1.5_years; });
+		register_date_op<Calendar>(name + "+=months", [](Calendar date, Calendar const&) { return date += 7_months; });
+		register_date_op<Calendar>(name + "+=days", [](Calendar const& date, Calendar const&) { return Calendar(Jd(date.to_jd()) + 10.0_days); });
+		register_date_op<Calendar>(name + "==" + name, [](Calendar const& lhs, Calendar const& rhs) { return lhs == rhs; });
+		register_date_op<Calendar>(name + "!=" + name, [](Calendar const& lhs, Calendar const& rhs) { return lhs != rhs; });
+		register_date_op<Calendar>(name + "<" + name, [](Calendar const& lhs, Calendar const& rhs) { return lhs < rhs; });
+		register_date_op<Calendar>(name + "<=" + name, [](Calendar const& lhs, Calendar const& rhs) { return lhs <= rhs; });
+		register_date_op<Calendar>(name + ">" + name, [](Calendar const& lhs, Calendar const& rhs) { return lhs > rhs; });
+		register_date_op<Calendar>(name + ">=" + name, [](Calendar const& lhs, Calendar const& rhs) { return lhs >= rhs; });
+		register_date_op<Calendar>(name + "<=>" + name, [](Calendar const& lhs, Calendar const& rhs) { return lhs <=> rhs; });
+		register_date_op<Calendar>(name + "-" + name, [](Calendar const& lhs, Calendar const& rhs) { return lhs - rhs; });
+		register_date_op<Calendar>(name + ".to_string", [](Calendar const& date, Calendar const&) { return date.to_string(); });
+	}
+
+
+	void jd_to_gregorian_hms(jd_t jd, year_t& y, month_t& m, day_t& d, hour_t& h, minute_t& mi, second_t& s) { jd_to_gregorian(jd, y, m, d, h, mi, s); }
+	void jd_to_julian_hms(jd_t jd, year_t& y, month_t& m, day_t& d, hour_t& h, minute_t& mi, second_t& s) { jd_to_julian(jd, y, m, d, h, mi, s); }
+	void jd_to_islamic_hms(jd_t jd, year_t& y, month_t& m, day_t& d, hour_t& h, minute_t& mi, second_t& s) { jd_to_islamic(jd, y, m, d, h, mi, s); }
+	void jd_to_hebrew_hms(jd_t jd, year_t& y, month_t& m, day_t& d, hour_t& h, minute_t& mi, second_t& s) { jd_to_hebrew(jd, y, m, d, h, mi, s); }
+	void jd_to_vulcan_hms(jd_t jd, year_t& y, month_t& m, day_t& d, hour_t& h, minute_t& mi, second_t& s) { jd_to_vulcan(jd, y, m, d, h, mi, s); }
+
+
+	bool const registered_g = [] {
+		register_calendar<Gregorian>("Gregorian", jd_to_gregorian_hms);
+		register_calendar<Julian>("Julian", jd_to_julian_hms);
+		register_calendar<Islamic>("Islamic", jd_to_islamic_hms);
+		register_calendar<Hebrew>("Hebrew", jd_to_hebrew_hms);
+		register_calendar<Vulcan>("Vulcan", jd_to_vulcan_hms);
+		return true;
+	}();
+
+}
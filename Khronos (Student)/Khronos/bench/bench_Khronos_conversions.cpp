@@ -0,0 +1,84 @@
+/** @file bench_Khronos_conversions.cpp
+	@date 2026-10-18
+	@brief Benchmarks of the calendar <-> JD conversion functions.
+	*/
+
+#include "bench_Khronos.hpp"
+using namespace khronos;
+
+
+namespace {
+
+	/** The conversion functions of a calendar. */
+	struct conversions {
+		char const* name;
+		jd_t (*to_jd)(year_t, month_t, day_t);
+		jd_t (*to_jd_time)(year_t, month_t, day_t, hour_t, minute_t, second_t);
+		void (*from_jd)(jd_t, year_t&, month_t&, day_t&);
+		void (*from_jd_time)(jd_t, year_t&, month_t&, day_t&, hour_t&, minute_t&, second_t&);
+	};
+
+	conversions const calendars[] = {
+		{ "gregorian", gregorian_to_jd, gregorian_to_jd, jd_to_gregorian, jd_to_gregorian },
+		{ "julian", julian_to_jd, julian_to_jd, jd_to_julian, jd_to_julian },
+		{ "islamic", islamic_to_jd, islamic_to_jd, jd_to_islamic, jd_to_islamic },
+		{ "hebrew", hebrew_to_jd, hebrew_to_jd, jd_to_hebrew, jd_to_hebrew },
+		{ "vulcan", vulcan_to_jd, vulcan_to_jd, jd_to_vulcan, jd_to_vulcan },
+	};
+
+
+	void register_conversions(conversions const& cal, bench_range range, bench_order order) {
+		std::string const prefix(cal.name);
+
+		gats::BenchApp::add(bench_name(prefix + "_to_jd(ymd)", range, order), CONVERSION_GROUP, [cal, range, order](gats::BenchApp::State& state) {
+			auto const fields = make_bench_fields(bench_jds(range, order), cal.from_jd_time);
+			state.set_items_per_iteration(BENCH_BATCH);
+			for ([[maybe_unused]] auto _ : state)
+				for (std::size_t i = 0; i < BENCH_BATCH; ++i)
+					gats::do_not_optimize(cal.to_jd(fields.year[i], fields.month[i], fields.day[i]));
+		});
+
+		gats::BenchApp::add(bench_name(prefix + "_to_jd(ymdhms)", range, order), CONVERSION_GROUP, [cal, range, order](gats::BenchApp::State& state) {
+			auto const fields = make_bench_fields(bench_jds(range, order), cal.from_jd_time);
+			state.set_items_per_iteration(BENCH_BATCH);
+			for ([[maybe_unused]] auto _ : state)
+				for (std::size_t i = 0; i < BENCH_BATCH; ++i)
+					gats::do_not_optimize(cal.to_jd_time(fields.year[i], fields.month[i], fields.day[i], fields.hour[i], fields.minute[i], fields.second[i]));
+		});
+
+		gats::BenchApp::add(bench_name("jd_to_" + prefix + "(ymd)", range, order), CONVERSION_GROUP, [cal, range, order](gats::BenchApp::State& state) {
+			auto const& jds = bench_jds(range, order);
+			state.set_items_per_iteration(BENCH_BATCH);
+			year_t y; month_t m; day_t d;
+			for ([[maybe_unused]] auto _ : state)
+				for (std::size_t i = 0; i < BENCH_BATCH; ++i) {
+					cal.from_jd(jds[i], y, m, d);
+					gats::do_not_optimize(y);
+					gats::do_not_optimize(m);
+					gats::do_not_optimize(d);
+				}
+		});
+
+		gats::BenchApp::add(bench_name("jd_to_" + prefix + "(ymdhms)", range, order), CONVERSION_GROUP, [cal, range, order](gats::BenchApp::State& state) {
+			auto const& jds = bench_jds(range, order);
+			state.set_items_per_iteration(BENCH_BATCH);
+			year_t y; month_t m; day_t d; hour_t h; minute_t mi; second_t s;
+			for ([[maybe_unused]] auto _ : state)
+				for (std::size_t i = 0; i < BENCH_BATCH; ++i) {
+					cal.from_jd_time(jds[i], y, m, d, h, mi, s);
+					gats::do_not_optimize(y);
+					gats::do_not_optimize(s);
+				}
+		});
+	}
+
+
+	bool const registered_g = [] {
+		for (auto const& cal : calendars)
+			for (auto range : BENCH_RANGES)
+				for (auto order : BENCH_ORDERS)
+					register_conversions(cal, range, order);
+		return true;
+	}();
+
+}
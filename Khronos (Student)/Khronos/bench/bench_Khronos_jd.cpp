@@ -0,0 +1,68 @@
+/** @file bench_Khronos_jd.cpp
+	@date 2026-10-18
+	@brief Benchmarks of the Jd class.
+	*/
+
+#include "bench_Khronos.hpp"
+using namespace khronos;
+
+
+namespace {
+
+	/** Registers a benchmark applying 'op' to each Jd of a batch. */
+	template <typename Op>
+	void register_jd(std::string const& subject, Op op) {
+		for (auto range : BENCH_RANGES)
+			for (auto order : BENCH_ORDERS)
+				gats::BenchApp::add(bench_name(subject, range, order), JD_GROUP, [op, range, order](gats::BenchApp::State& state) {
+					std::vector<Jd> jds;
+					for (auto jd : bench_jds(range, order))
+						jds.push_back(Jd(jd));
+					state.set_items_per_iteration(BENCH_BATCH);
+					for ([[maybe_unused]] auto _ : state)
+						for (std::size_t i = 0; i < BENCH_BATCH; ++i)
+							gats::do_not_optimize(op(jds[i], jds[BENCH_BATCH - 1 - i]));
+				});
+	}
+
+
+	bool const registered_g = [] {
+		register_jd("Jd+=seconds", [](Jd jd, Jd) { return jd += 90.0_seconds; });
+		register_jd("Jd+=minutes", [](Jd jd, Jd) { return jd += 90.0_minutes; });
+		register_jd("Jd+=hours", [](Jd jd, Jd) { return jd += 36.0_hours; });
+		register_jd("Jd+=days", [](Jd jd, Jd) { return jd += 10.0_days; });
+		register_jd("Jd+=weeks", [](Jd jd, Jd) { return jd += 2.0_weeks; });
+		register_jd("Jd+=years", [](Jd jd, Jd) { return jd += 1.5_years; });
+		register_jd("Jd-=days", [](Jd jd, Jd) { return jd -= 10.0_days; });
+		register_jd("Jd-=years", [](Jd jd, Jd) { return jd -= 1.5_years; });
+		register_jd("Jd+days", [](Jd jd, Jd) { return jd + 10.0_days; });
+		register_jd("Jd-days", [](Jd jd, Jd) { return jd - 10.0_days; });
+		register_jd("Jd-Jd", [](Jd lhs, Jd rhs) { return lhs - rhs; });
+		register_jd("Jd==Jd", [](Jd lhs, Jd rhs) { return lhs == rhs; });
+		register_jd("Jd<Jd", [](Jd lhs, Jd rhs) { return lhs < rhs; });
+		register_jd("Jd<=>Jd", [](Jd lhs, Jd rhs) { return lhs <=> rhs; });
+		return true;
+	}();
+
+}
+
+
+
+GATS_BENCHMARK(Jd_default_constructor, JD_GROUP) {
+	for ([[maybe_unused]] auto _ : state)
+		gats::do_not_optimize(Jd());
+}
+
+
+
+GATS_BENCHMARK(Jd_now_constructor, JD_GROUP) {
+	for ([[maybe_unused]] auto _ : state)
+		gats::do_not_optimize(Jd(WTIMEOFDAY));
+}
+
+
+
+GATS_BENCHMARK(Jd_now_date_constructor, JD_GROUP) {
+	for ([[maybe_unused]] auto _ : state)
+		gats::do_not_optimize(Jd(NOTIMEOFDAY));
+}
@@ -0,0 +1,33 @@
+/**	@file fuzz_Khronos.cpp
+	@date 2026-10-18
+	@brief libFuzzer entry point for the Khronos differential checks.
+
+	Each input is decoded into a sample (calendar, date, day number, time of
+	day, month/year offsets) and run through the same checks as the
+	differential unit tests; a mismatch is printed and aborts the run so the
+	fuzzer keeps the input.  Build with clang, e.g.
+
+		clang++ -std=c++23 -g -O1 -fsanitize=fuzzer,address,undefined
+			-Iinclude -Iut fuzz/fuzz_Khronos.cpp ut/ut_differential.cpp
+			ut/ut_reference.cpp libsrc/<all>.cpp -o fuzz_Khronos
+
+	or with MSVC using /std:c++latest /fsanitize=fuzzer.  Run with -jobs=N -workers=N for
+	multi-threaded fuzzing; the coverage counters are libFuzzer's own.
+	*/
+
+#include "ut_differential.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const* data, std::size_t size) {
+	differential::coverage cov;
+	auto const s = differential::decode(data, size);
+	for (auto failure : { differential::check_conversion(s, cov), differential::check_arithmetic(s, cov) }) {
+		if (!failure.empty()) {
+			std::fprintf(stderr, "%s\n", failure.c_str());
+			std::abort();
+		}
+	}
+	return 0;
+}
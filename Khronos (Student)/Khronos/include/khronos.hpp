@@ -17,4 +17,26 @@ Khronos library header.
 #include <khronos/julian_calendar.hpp>
 #include <khronos/islamic_calendar.hpp>
 #include <khronos/hebrew_calendar.hpp>
-#include <khronos/vulcan_calendar.hpp>
\ No newline at end of file
+#include <khronos/vulcan_calendar.hpp>
+#include <khronos/calendar_traits.hpp>
+#include <khronos/cyclic_calendar.hpp>
+#include <khronos/coptic_calendar.hpp>
+#include <khronos/persian_calendar.hpp>
+#include <khronos/islamic_variants.hpp>
+#include <khronos/historical_calendar.hpp>
+#include <khronos/astronomical_time.hpp>
+#include <khronos/ephemeris.hpp>
+#include <khronos/week.hpp>
+#include <khronos/period.hpp>
+#include <khronos/packed_date.hpp>
+#include <khronos/validate.hpp>
+#include <khronos/datetime_columns.hpp>
+#include <khronos/parallel.hpp>
+#include <khronos/sort.hpp>
+#include <khronos/rollup.hpp>
+#include <khronos/column_file.hpp>
+#include <khronos/tick_codec.hpp>
+#include <khronos/arrow.hpp>
+#include <khronos/interval.hpp>
+#include <khronos/event_index.hpp>
+#include <khronos/instrument.hpp>
\ No newline at end of file
@@ -0,0 +1,164 @@
+#pragma once
+
+/**	@file khronos/arrow.hpp
+	@date 2026-10-18
+
+	Date column exchange through the Apache Arrow C Data Interface.
+
+	The ArrowSchema/ArrowArray structs are the ABI-stable definitions from
+	the Arrow specification; no Arrow library is needed.  Exported arrays own
+	their buffers and are freed by calling their release callback, as the
+	interface requires.  Columns already held in Arrow units (Unix days or
+	Unix nanoseconds) are exported without copying: the vector's buffer
+	moves into the array.
+
+	Calendar fields are exported as a struct array of int32 year, month and
+	day children, decoded in one pass over the JD column.  They are decoded
+	at export, not on first access: a consumer reads the children's buffers
+	directly, with no callback through which to fill them, and one from_jd
+	per row yields all three fields, so decoding one child costs as much as
+	decoding them all.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/calendar_traits.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#include <stdint.h>
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct ArrowSchema {
+	// Array type description
+	const char* format;
+	const char* name;
+	const char* metadata;
+	int64_t flags;
+	int64_t n_children;
+	struct ArrowSchema** children;
+	struct ArrowSchema* dictionary;
+
+	// Release callback
+	void (*release)(struct ArrowSchema*);
+	// Opaque producer-specific data
+	void* private_data;
+};
+
+struct ArrowArray {
+	// Array data description
+	int64_t length;
+	int64_t null_count;
+	int64_t offset;
+	int64_t n_buffers;
+	int64_t n_children;
+	const void** buffers;
+	struct ArrowArray** children;
+	struct ArrowArray* dictionary;
+
+	// Release callback
+	void (*release)(struct ArrowArray*);
+	// Opaque producer-specific data
+	void* private_data;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+
+namespace khronos {
+
+	// VALUES
+	constexpr jd_t UNIX_EPOCH_JD = 2'440'587.5;
+	constexpr tick_t UNIX_EPOCH_TICKS = 2'440'587 * TICKS_PER_DAY + TICKS_PER_DAY / 2;
+
+	/** Arrow temporal types of an exported date column. */
+	enum class arrow_date_type {
+		date32,			// int32 days since 1970-01-01 ("tdD")
+		timestamp_ns	// int64 nanoseconds since 1970-01-01T00:00:00, no time zone ("tsn:")
+	};
+
+
+	// CONVERSIONS
+	/**	Days since the Unix epoch of the day containing each JD.
+		Throws std::out_of_range for a NaN JD or a day outside int32.
+		*/
+	void jd_to_unix_days(std::span<jd_t const> jds, std::span<std::int32_t> days);
+
+	/**	Nanoseconds since the Unix epoch of each JD (to the microsecond tick).
+		Throws std::out_of_range for a NaN JD or an instant outside 1677-2262.
+		*/
+	void jd_to_unix_ns(std::span<jd_t const> jds, std::span<std::int64_t> ns);
+
+
+	// EXPORT
+	/**	Export a JD column.  NaN JDs, and instants a timestamp[ns] cannot hold
+		(outside 1677-2262), are exported as nulls.
+		*/
+	void export_arrow(std::span<jd_t const> jds, arrow_date_type type, ArrowArray* array, ArrowSchema* schema);
+
+	/** Export a date32 column without copying; 'unixDays' is moved into the array. */
+	void export_arrow(std::vector<std::int32_t>&& unixDays, ArrowArray* array, ArrowSchema* schema);
+
+	/** Export a timestamp[ns] column without copying; 'unixNs' is moved into the array. */
+	void export_arrow(std::vector<std::int64_t>&& unixNs, ArrowArray* array, ArrowSchema* schema);
+
+
+	namespace detail {
+		/** Export struct<year, month, day> of int32 columns; rows flagged 'false' in 'valid' are null. */
+		void export_date_fields(std::vector<std::int32_t>&& years, std::vector<std::int32_t>&& months, std::vector<std::int32_t>&& days,
+			std::vector<bool> const& valid, ArrowArray* array, ArrowSchema* schema);
+	}
+
+	/**	Export the calendar fields of a JD column as struct<year: int32, month: int32, day: int32>.
+		Non-finite JDs, and dates whose year does not fit an int32, are exported as nulls.
+		*/
+	template <typename Calendar>
+	void export_calendar_fields(std::span<jd_t const> jds, ArrowArray* array, ArrowSchema* schema) {
+		std::vector<std::int32_t> years(jds.size()), months(jds.size()), days(jds.size());
+		std::vector<bool> valid(jds.size());
+		// no calendar year of at most 400 days reaches an int32 year inside this bound, and from_jd stays in range within it
+		constexpr jd_t LIMIT = 400.0 * 2'147'483'648.0;
+		for (std::size_t i = 0; i < jds.size(); ++i) {
+			if (!(std::abs(jds[i]) < LIMIT))
+				continue;
+			year_t y; month_t m; day_t d;
+			calendar_traits<Calendar>::from_jd(jds[i], y, m, d);
+			valid[i] = y >= std::numeric_limits<std::int32_t>::min() && y <= std::numeric_limits<std::int32_t>::max();
+			if (!valid[i])
+				continue;
+			years[i] = static_cast<std::int32_t>(y);
+			months[i] = m;
+			days[i] = d;
+		}
+		detail::export_date_fields(std::move(years), std::move(months), std::move(days), valid, array, schema);
+	}
+
+
+	// IMPORT
+	/**	JDs of an Arrow date32, date64 or timestamp (any unit and time zone) array; nulls import as NaN.
+		Values too far out for int64 microseconds import in double, to the precision a JD holds.
+		The array is not released.  Throws std::invalid_argument for other types.
+		*/
+	std::vector<jd_t> import_arrow(ArrowArray const* array, ArrowSchema const* schema);
+
+} // end-of-namespace khronos
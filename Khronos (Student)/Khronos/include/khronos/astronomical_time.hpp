@@ -0,0 +1,144 @@
+#pragma once
+
+/**	@file khronos/astronomical_time.hpp
+	@date 2026-10-18
+
+	Astronomical time quantities of a Julian Day: Julian centuries since
+	J2000, the MJD/TJD/RJD epoch views, Greenwich mean and apparent sidereal
+	time and the equation of time (Meeus, "Astronomical Algorithms", 2nd ed.,
+	ch. 12, 22 and 28).
+
+	A JD near the present has about 40 microseconds of resolution, and
+	360.9856 * (JD - J2000) spends most of a double on whole turns of the
+	Earth.  The sidereal time is therefore evaluated from a split_jd, a whole
+	day number and the fraction of the day: the whole days contribute only
+	their 0.9856 degree daily drift, so the fraction keeps its precision.
+	Tick columns split exactly with split_ticks(), named apart from split() so
+	that an integer JD such as split(2'451'545) is not read as ticks.
+
+	The polynomial quantities are constexpr.  Nutation and the equation of
+	time need sines, so they are ordinary functions.  The span kernels are
+	straight loops without branches for the compiler to vectorize.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+
+#include <span>
+
+
+namespace khronos {
+
+	// VALUES
+	/** 2000 January 1, 12h TT. */
+	constexpr jd_t J2000 = 2'451'545.0;
+	constexpr double DAYS_PER_JULIAN_CENTURY = 36'525.0;
+
+	constexpr jd_t MJD_EPOCH = 2'400'000.5;		// Modified JD: 1858 November 17, 0h
+	constexpr jd_t TJD_EPOCH = 2'440'000.5;		// Truncated JD: 1968 May 24, 0h
+	constexpr jd_t RJD_EPOCH = 2'400'000.0;		// Reduced JD: 1858 November 16, 12h
+
+
+	/** A Julian Day as a whole day number and the fraction [0..1) of the day after it. */
+	struct split_jd {
+		long long	day;
+		double		fraction;
+	};
+
+	namespace detail {
+		constexpr long long floor_to_integer(double x) {
+			long long const i = static_cast<long long>(x);
+			return static_cast<double>(i) > x ? i - 1 : i;
+		}
+
+		/** 'degrees' reduced to [0..360). */
+		constexpr double norm360(double degrees) {
+			return degrees - 360.0 * static_cast<double>(floor_to_integer(degrees / 360.0));
+		}
+
+		/** Mean obliquity 'T' Julian centuries from J2000, degrees (Meeus 22.2). */
+		constexpr double mean_obliquity(double T) {
+			return 23.439'291'111 + (-46.815'0 + (-0.000'59 + 0.001'813 * T) * T) * T / 3'600.0;
+		}
+	}
+
+
+
+	// FUNCTIONS
+	/** The finite Julian Day 'jd' split into whole day and fraction. */
+	constexpr split_jd split(jd_t jd) {
+		long long const day = detail::floor_to_integer(jd);
+		return { day, jd - static_cast<jd_t>(day) };
+	}
+
+	/** The tick count 'ticks' split exactly into whole day and fraction. */
+	constexpr split_jd split_ticks(tick_t ticks) {
+		return { utility::floor_div(ticks, TICKS_PER_DAY),
+			static_cast<double>(utility::floor_mod(ticks, TICKS_PER_DAY)) / static_cast<double>(TICKS_PER_DAY) };
+	}
+
+	/** Days from 'epoch' to 'jd', without rounding the whole days into the fraction. */
+	constexpr double days_since(split_jd jd, jd_t epoch) {
+		split_jd const e = split(epoch);
+		return static_cast<double>(jd.day - e.day) + (jd.fraction - e.fraction);
+	}
+
+
+	// EPOCH VIEWS
+	constexpr double jd_to_mjd(jd_t jd) { return jd - MJD_EPOCH; }
+	constexpr jd_t mjd_to_jd(double mjd) { return mjd + MJD_EPOCH; }
+	constexpr double jd_to_tjd(jd_t jd) { return jd - TJD_EPOCH; }
+	constexpr jd_t tjd_to_jd(double tjd) { return tjd + TJD_EPOCH; }
+	constexpr double jd_to_rjd(jd_t jd) { return jd - RJD_EPOCH; }
+	constexpr jd_t rjd_to_jd(double rjd) { return rjd + RJD_EPOCH; }
+
+
+	/** Julian centuries of 36525 days since J2000. */
+	constexpr double julian_centuries(jd_t jd) { return (jd - J2000) / DAYS_PER_JULIAN_CENTURY; }
+	constexpr double julian_centuries(split_jd jd) { return days_since(jd, J2000) / DAYS_PER_JULIAN_CENTURY; }
+
+
+	// SIDEREAL TIME
+	/** Greenwich mean sidereal time at 'ut', degrees [0..360) (Meeus 12.4). */
+	constexpr double gmst(split_jd ut) {
+		// 360.98564736629 degrees per day, less the whole turns of the whole days
+		double const d = static_cast<double>(ut.day - static_cast<long long>(J2000));
+		double const T = (d + ut.fraction) / DAYS_PER_JULIAN_CENTURY;
+		return detail::norm360(280.460'618'37 + 0.985'647'366'29 * d + 360.985'647'366'29 * ut.fraction
+			+ 0.000'387'933 * T * T - T * T * T / 38'710'000.0);
+	}
+	constexpr double gmst(jd_t ut) { return gmst(split(ut)); }
+
+	/** Mean obliquity of the ecliptic at 'jde' (TT), degrees (Meeus 22.2). */
+	constexpr double mean_obliquity(jd_t jde) { return detail::mean_obliquity(julian_centuries(jde)); }
+
+	/** Nutation in longitude and in obliquity, arc seconds. */
+	struct nutation_angles {
+		double	longitude;		// delta psi
+		double	obliquity;		// delta epsilon
+	};
+
+	/** Nutation at 'jde' (TT) from its four principal terms; within 0.5" and 0.1" (Meeus ch. 22). */
+	nutation_angles nutation(jd_t jde);
+
+	/** Greenwich apparent sidereal time at 'ut', degrees [0..360): GMST plus the equation of the equinoxes. */
+	double gast(split_jd ut);
+	double gast(jd_t ut);
+
+
+	// EQUATION OF TIME
+	/** Apparent less mean solar time at 'jde' (TT), minutes; within a few seconds (Meeus 28.3). */
+	double equation_of_time(jd_t jde);
+
+
+	// SPAN KERNELS
+	void julian_centuries(std::span<jd_t const> jds, std::span<double> centuries);
+	void days_since(std::span<jd_t const> jds, jd_t epoch, std::span<double> days);
+	void days_since(std::span<tick_t const> ticks, jd_t epoch, std::span<double> days);
+	void gmst(std::span<jd_t const> uts, std::span<double> degrees);
+	void gmst(std::span<tick_t const> uts, std::span<double> degrees);
+	void gast(std::span<jd_t const> uts, std::span<double> degrees);
+	void gast(std::span<tick_t const> uts, std::span<double> degrees);
+	void equation_of_time(std::span<jd_t const> jdes, std::span<double> minutes);
+
+} // end-of-namespace khronos
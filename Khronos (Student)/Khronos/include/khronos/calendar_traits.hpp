@@ -0,0 +1,202 @@
+#pragma once
+
+/**	@file khronos/calendar_traits.hpp
+	@date 2026-10-18
+
+	Uniform compile-time description of the Khronos calendars.
+
+	calendar_traits<C> exposes the conversion functions and the month layout of
+	calendar class C so that generic algorithms (sorting, bucketing, validation,
+	...) can be written once for every calendar.  Months are addressed either by
+	their calendar number or by their 'ordinal', the 0-based position of the
+	month within the calendar year (the Hebrew year starts with Tishrei = 7).
+	A month's absolute 'index' is months_before(year) + ordinal, counting every
+	month since the calendar's year 0 (1 AM for the Hebrew calendar).
+	A calendar in which some day numbers of a month never happened also
+	provides is_date(year, month, day), which validation consults.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/utility.hpp>
+#include <khronos/gregorian_calendar.hpp>
+#include <khronos/julian_calendar.hpp>
+#include <khronos/islamic_calendar.hpp>
+#include <khronos/hebrew_calendar.hpp>
+#include <khronos/vulcan_calendar.hpp>
+
+#include <algorithm>
+#include <concepts>
+
+
+namespace khronos {
+
+	/** Calendar description.  Specialized for each calendar class. */
+	template <typename Calendar> struct calendar_traits;
+
+
+	template <> struct calendar_traits<Gregorian> {
+		static jd_t to_jd(year_t y, month_t m, day_t d) { return gregorian_to_jd(y, m, d); }
+		static void from_jd(jd_t jd, year_t& y, month_t& m, day_t& d) { jd_to_gregorian(jd, y, m, d); }
+		static month_t months_in_year(year_t) { return 12; }
+		static day_t days_in_month(year_t y, month_t m) { return gregorian_days_in_month(m, is_gregorian_leapyear(y)); }
+		static int month_ordinal(year_t, month_t m) { return m - 1; }
+		static month_t month_at(year_t, int ordinal) { return ordinal + 1; }
+		static long long months_before(year_t y) { return 12 * y; }
+		static year_t year_of_month(long long index) { return utility::floor_div(index, 12); }
+	};
+
+
+	template <> struct calendar_traits<Julian> {
+		static jd_t to_jd(year_t y, month_t m, day_t d) { return julian_to_jd(y, m, d); }
+		static void from_jd(jd_t jd, year_t& y, month_t& m, day_t& d) { jd_to_julian(jd, y, m, d); }
+		static month_t months_in_year(year_t) { return 12; }
+		static day_t days_in_month(year_t y, month_t m) { return julian_days_in_month(m, is_julian_leapyear(y)); }
+		static int month_ordinal(year_t, month_t m) { return m - 1; }
+		static month_t month_at(year_t, int ordinal) { return ordinal + 1; }
+		static long long months_before(year_t y) { return 12 * y; }
+		static year_t year_of_month(long long index) { return utility::floor_div(index, 12); }
+	};
+
+
+	template <> struct calendar_traits<Islamic> {
+		static jd_t to_jd(year_t y, month_t m, day_t d) { return islamic_to_jd(y, m, d); }
+		static void from_jd(jd_t jd, year_t& y, month_t& m, day_t& d) { jd_to_islamic(jd, y, m, d); }
+		static month_t months_in_year(year_t) { return 12; }
+		static day_t days_in_month(year_t y, month_t m) { return islamic_days_in_month(m, is_islamic_leapyear(y)); }
+		static int month_ordinal(year_t, month_t m) { return m - 1; }
+		static month_t month_at(year_t, int ordinal) { return ordinal + 1; }
+		static long long months_before(year_t y) { return 12 * y; }
+		static year_t year_of_month(long long index) { return utility::floor_div(index, 12); }
+	};
+
+
+	template <> struct calendar_traits<Hebrew> {
+		static jd_t to_jd(year_t y, month_t m, day_t d) { return hebrew_to_jd(y, m, d); }
+		static void from_jd(jd_t jd, year_t& y, month_t& m, day_t& d) { jd_to_hebrew(jd, y, m, d); }
+		static month_t months_in_year(year_t y) { return hebrew_months_in_year(y); }
+		static day_t days_in_month(year_t y, month_t m) { return hebrew_days_in_month(m, y); }
+
+		/* Tishrei (7) .. Adar/Adar II, then Nisan (1) .. Elul (6). */
+		static int month_ordinal(year_t y, month_t m) {
+			return m >= 7 ? m - 7 : m - 1 + (months_in_year(y) - 6);
+		}
+		static month_t month_at(year_t y, int ordinal) {
+			int const tail = months_in_year(y) - 6;
+			return ordinal < tail ? ordinal + 7 : ordinal - tail + 1;
+		}
+		static long long months_before(year_t y) { return hebrew_months_elapsed(y); }
+		static year_t year_of_month(long long index) { return hebrew_year_of_month(index); }
+	};
+
+
+	template <> struct calendar_traits<Vulcan> {
+		static jd_t to_jd(year_t y, month_t m, day_t d) { return vulcan_to_jd(y, m, d); }
+		static void from_jd(jd_t jd, year_t& y, month_t& m, day_t& d) { jd_to_vulcan(jd, y, m, d); }
+		static month_t months_in_year(year_t) { return 12; }
+		static day_t days_in_month(year_t y, month_t m) { return vulcan_days_in_month(m, is_vulcan_leapyear(y)); }
+		static int month_ordinal(year_t, month_t m) { return m - 1; }
+		static month_t month_at(year_t, int ordinal) { return ordinal + 1; }
+		static long long months_before(year_t y) { return 12 * y; }
+		static year_t year_of_month(long long index) { return utility::floor_div(index, 12); }
+	};
+
+
+
+	/** A calendar date class with a calendar_traits specialization. */
+	template <typename C>
+	concept calendar_date = requires(C const& c, year_t y, month_t m, day_t d, jd_t jd) {
+		{ c.to_jd() } -> std::convertible_to<jd_t>;
+		{ c.year() } -> std::convertible_to<year_t>;
+		{ c.month() } -> std::convertible_to<month_t>;
+		{ c.day() } -> std::convertible_to<day_t>;
+		{ calendar_traits<C>::to_jd(y, m, d) } -> std::convertible_to<jd_t>;
+		calendar_traits<C>::from_jd(jd, y, m, d);
+		{ calendar_traits<C>::month_ordinal(y, m) } -> std::convertible_to<int>;
+		{ calendar_traits<C>::month_at(y, 0) } -> std::convertible_to<month_t>;
+	};
+
+	/** Calendars whose traits reject some day numbers within a month's length. */
+	template <typename C>
+	concept calendar_with_gaps = requires(year_t y, month_t m, day_t d) {
+		{ calendar_traits<C>::is_date(y, m, d) } -> std::convertible_to<bool>;
+	};
+
+
+
+	// CALENDAR PERIODS
+	// --------------------------------------------------------------------------------------
+
+	/**	Calendar periods used for bucketing.  Weeks start on Monday (ISO weeks).
+		Quarters are three months in calendar order; in a 13-month year
+		(Hebrew leap year) the fourth quarter is four months long. */
+	enum class period { day, week, month, quarter, year };
+
+
+	/** JD of midnight starting the first day of 'year' in the given calendar. */
+	template <typename Calendar>
+	jd_t year_start(year_t year) {
+		using traits = calendar_traits<Calendar>;
+		return traits::to_jd(year, traits::month_at(year, 0), 1);
+	}
+
+
+	/** Advance (year, month) by one month in calendar order. */
+	template <typename Calendar>
+	void next_month(year_t& year, month_t& month) {
+		using traits = calendar_traits<Calendar>;
+		int ordinal = traits::month_ordinal(year, month) + 1;
+		if (ordinal == traits::months_in_year(year)) {
+			++year;
+			ordinal = 0;
+		}
+		month = traits::month_at(year, ordinal);
+	}
+
+
+	/**	Get the calendar period containing 'jd'.
+		@param jd [in] the instant to classify.
+		@param p [in] the period kind.
+		@param begin [out] JD of the midnight starting the period.
+		@param end [out] JD of the midnight starting the following period.
+		*/
+	template <typename Calendar>
+	void period_bounds(jd_t jd, period p, jd_t& begin, jd_t& end) {
+		using traits = calendar_traits<Calendar>;
+		jd_t const jdn = jd_to_jdn(jd);
+		switch (p) {
+		case period::day:
+			begin = jdn - 0.5;
+			end = begin + 1;
+			return;
+		case period::week:
+			begin = jdn - 0.5 - static_cast<jd_t>(utility::floor_mod(static_cast<long long>(jdn), 7));
+			end = begin + 7;
+			return;
+		case period::month: {
+			year_t y; month_t m; day_t d;
+			traits::from_jd(jd, y, m, d);
+			begin = traits::to_jd(y, m, 1);
+			next_month<Calendar>(y, m);
+			end = traits::to_jd(y, m, 1);
+			return;
+		}
+		case period::quarter: {
+			year_t y; month_t m; day_t d;
+			traits::from_jd(jd, y, m, d);
+			int const quarter = std::min(traits::month_ordinal(y, m) / 3, 3);
+			begin = traits::to_jd(y, traits::month_at(y, quarter * 3), 1);
+			end = quarter == 3 ? year_start<Calendar>(y + 1) : traits::to_jd(y, traits::month_at(y, quarter * 3 + 3), 1);
+			return;
+		}
+		case period::year: {
+			year_t y; month_t m; day_t d;
+			traits::from_jd(jd, y, m, d);
+			begin = year_start<Calendar>(y);
+			end = year_start<Calendar>(y + 1);
+			return;
+		}
+		}
+	}
+
+} // end-of-namespace khronos
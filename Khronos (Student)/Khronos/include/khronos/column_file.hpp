@@ -0,0 +1,161 @@
+#pragma once
+
+/**	@file khronos/column_file.hpp
+	@date 2026-10-18
+
+	Memory-mapped columnar date files.
+
+	A column file stores one column of instants as fixed-width ticks
+	(microseconds since JD 0.0, see jd_to_ticks()) in blocks of up to
+	'rows_per_block' rows.  Layout (little-endian):
+
+		header		64 bytes: magic "KHRNCOL1", format version, rows per block
+		blocks		each starting on a 64-byte boundary
+		index		one column_block_info per block
+		trailer		32 bytes: index offset, block count, row count, magic
+
+	A raw block is an array of tick_t.  A delta block is the tick of every
+	64th row (its first tick included), followed by the int32 differences
+	between consecutive rows; blocks whose differences do not fit are
+	written raw.  The index records each block's encoding and its smallest
+	and largest tick, so range scans skip blocks that cannot overlap.
+
+	column_file maps the whole file read-only: blocks and the index are
+	read in place, and rows are converted to JDs or calendar dates only when
+	asked for.  Opening a file reads only its header, trailer and index;
+	reading one row of a delta block starts from the row's stored
+	checkpoint tick and sums fewer than 64 differences.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/calendar_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <vector>
+
+
+namespace khronos {
+
+	/** Storage of a column file block. */
+	enum class column_encoding : std::uint32_t { raw = 0, delta = 1 };
+
+	struct column_file_options {
+		std::uint32_t rows_per_block = 65'536;
+		column_encoding encoding = column_encoding::raw;
+	};
+
+
+	/** Index entry of one block. */
+	struct column_block_info {
+		std::uint64_t	offset;		// from the start of the file
+		std::uint32_t	rows;
+		column_encoding	encoding;
+		tick_t			min;
+		tick_t			max;
+
+		/** Can the block hold a tick in [first, last). */
+		bool overlaps(tick_t first, tick_t last) const { return min < last && max >= first; }
+		jd_t min_jd() const { return ticks_to_jd(min); }
+		jd_t max_jd() const { return ticks_to_jd(max); }
+	};
+
+
+
+	/**	Writes a column file, a block at a time.
+		Rows may be appended in chunks of any size; close() (or the destructor)
+		writes the final partial block and the index.
+		*/
+	class column_file_writer {
+		std::ofstream			out_;
+		column_file_options		options_;
+		std::vector<tick_t>		pending_;
+		std::vector<column_block_info> index_;
+		std::uint64_t			offset_ = 0;
+		std::uint64_t			rows_ = 0;
+
+		void write_block();
+		void pad_to_block_boundary();
+
+	public:
+		/** Creates (or truncates) 'path'.  Throws std::runtime_error if it cannot be opened. */
+		explicit column_file_writer(std::filesystem::path const& path, column_file_options options = {});
+		~column_file_writer();
+
+		column_file_writer(column_file_writer const&) = delete;
+		column_file_writer& operator=(column_file_writer const&) = delete;
+
+		void append(std::span<tick_t const> ticks);
+		void append(std::span<jd_t const> jds);
+		void close();
+
+		std::uint64_t rows() const { return rows_; }
+	};
+
+
+
+	/**	A read-only memory-mapped column file.
+		Throws std::runtime_error if the file cannot be mapped or is not a column file.
+		*/
+	class column_file {
+		std::byte const*		data_ = nullptr;
+		std::size_t				size_ = 0;
+		std::uint64_t			rows_ = 0;
+		std::uint32_t			rowsPerBlock_ = 0;
+		std::span<column_block_info const> index_;
+		std::vector<std::uint64_t> blockEnds_;	// the row after the last of each block
+
+		void unmap();
+
+	public:
+		explicit column_file(std::filesystem::path const& path);
+		~column_file() { unmap(); }
+
+		column_file(column_file&& other) noexcept;
+		column_file& operator=(column_file&& other) noexcept;
+		column_file(column_file const&) = delete;
+		column_file& operator=(column_file const&) = delete;
+
+		std::uint64_t rows() const { return rows_; }
+		std::uint32_t rows_per_block() const { return rowsPerBlock_; }
+		std::span<column_block_info const> blocks() const { return index_; }
+
+		/**	Ticks of block 'b'.
+			Raw blocks are returned in place; delta blocks are decoded into 'buffer'.
+			Throws std::out_of_range if there is no block 'b'.
+			*/
+		std::span<tick_t const> block_ticks(std::size_t b, std::vector<tick_t>& buffer) const;
+
+		/** Tick of 'row'.  Throws std::out_of_range if 'row' >= rows(). */
+		tick_t tick(std::uint64_t row) const;
+		jd_t jd(std::uint64_t row) const { return ticks_to_jd(tick(row)); }
+
+		/** The row as a calendar date, decoded on request. */
+		template <calendar_date Calendar>
+		Calendar date(std::uint64_t row) const { return Calendar(jd(row)); }
+
+		/** Call fn(row, tick) for every row with a JD in [first, last), reading only the blocks that can overlap. */
+		template <typename Fn>
+		void scan(jd_t first, jd_t last, Fn fn) const {
+			tick_t const lo = jd_to_ticks(first), hi = jd_to_ticks(last);
+			std::vector<tick_t> buffer;
+			std::uint64_t row = 0;
+			for (std::size_t b = 0; b < index_.size(); row += index_[b].rows, ++b) {
+				if (!index_[b].overlaps(lo, hi))
+					continue;
+				auto const ticks = block_ticks(b, buffer);
+				for (std::size_t i = 0; i < ticks.size(); ++i)
+					if (ticks[i] >= lo && ticks[i] < hi)
+						fn(row + i, ticks[i]);
+			}
+		}
+
+		/** JDs of the rows in [first, last), in row order. */
+		std::vector<jd_t> select(jd_t first, jd_t last) const;
+	};
+
+} // end-of-namespace khronos
@@ -0,0 +1,90 @@
+#pragma once
+
+/**	@file khronos/coptic_calendar.hpp
+	@date 2026-10-18
+
+	Coptic and Ethiopic calendars.
+
+	Both have twelve months of 30 days and a thirteenth month of five days,
+	six in a leap year; a year is leap when year mod 4 = 3.  They differ only
+	in their epochs: the Coptic Era of the Martyrs began on 29 August 284
+	(Julian), the Ethiopic Amete Mihret on 29 August 8 (Julian).  Both are
+	defined on the cyclic calendar engine.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/cyclic_calendar.hpp>
+
+#include <array>
+
+
+namespace khronos {
+
+	// VALUES
+	constexpr jd_t COPTIC_EPOCH = 1'825'029.5;
+	constexpr jd_t ETHIOPIC_EPOCH = 1'724'220.5;
+
+
+	struct coptic_rules {
+		static constexpr jd_t epoch = COPTIC_EPOCH;
+		static constexpr std::array<bool, 4> leap_years = { false, false, true, false };
+		static constexpr std::array<day_t, 13> month_days = { 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5 };
+		static constexpr month_t leap_month = 13;
+	};
+	using coptic_calendar = cyclic_calendar<coptic_rules>;
+
+	struct ethiopic_rules : coptic_rules {
+		static constexpr jd_t epoch = ETHIOPIC_EPOCH;
+	};
+	using ethiopic_calendar = cyclic_calendar<ethiopic_rules>;
+
+
+	// OPERATIONS
+	/** Leap year test for the Coptic and Ethiopic calendars. */
+	constexpr bool is_coptic_leapyear(year_t year) {
+		return coptic_calendar::is_leapyear(year);
+	}
+
+	/** Provide the name of the given month in the Coptic calendar. */
+	constexpr char const* coptic_month_name(month_t month) {
+		constexpr char const* const names[14] = {
+			"",
+			"Thoout", "Paope", "Athor", "Koiak", "Tobe", "Meshir", "Paremhotep",
+			"Parmoute", "Pashons", "Paone", "Epep", "Mesore", "Epagomene"
+		};
+		return names[month];
+	}
+
+	/** Provide the name of the given month in the Ethiopic calendar. */
+	constexpr char const* ethiopic_month_name(month_t month) {
+		constexpr char const* const names[14] = {
+			"",
+			"Maskaram", "Teqemt", "Hedar", "Takhsas", "Ter", "Yakatit", "Magabit",
+			"Miyazya", "Genbot", "Sane", "Hamle", "Nahase", "Paguemen"
+		};
+		return names[month];
+	}
+
+
+	// FUNCTIONS
+	/** Convert Coptic date to Julian Day Number. */
+	inline jd_t coptic_to_jd(year_t year, month_t month, day_t day) {
+		return coptic_calendar::to_jd(year, month, day);
+	}
+
+	/** Convert Julian Day Number to Coptic date. */
+	inline void jd_to_coptic(jd_t jd, year_t& year, month_t& month, day_t& day) {
+		coptic_calendar::from_jd(jd, year, month, day);
+	}
+
+	/** Convert Ethiopic date to Julian Day Number. */
+	inline jd_t ethiopic_to_jd(year_t year, month_t month, day_t day) {
+		return ethiopic_calendar::to_jd(year, month, day);
+	}
+
+	/** Convert Julian Day Number to Ethiopic date. */
+	inline void jd_to_ethiopic(jd_t jd, year_t& year, month_t& month, day_t& day) {
+		ethiopic_calendar::from_jd(jd, year, month, day);
+	}
+
+} // end-of-namespace khronos
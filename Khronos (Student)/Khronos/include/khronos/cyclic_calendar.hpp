@@ -0,0 +1,209 @@
+#pragma once
+
+/**	@file khronos/cyclic_calendar.hpp
+	@date 2026-10-18
+
+	Table-driven engine for cyclic arithmetic calendars.
+
+	A cyclic calendar repeats its pattern of common and leap years exactly
+	every cycle, and its months have fixed lengths except for the month that
+	takes the leap day.  Such a calendar is described by a Rules type:
+
+		static constexpr jd_t epoch;							// midnight starting 1/1/1
+		static constexpr std::array<bool, N> leap_years;		// year y is leap_years[(y - 1) mod N]
+		static constexpr std::array<day_t, M> month_days;		// lengths in a common year
+		static constexpr month_t leap_month;					// the month with the leap day
+
+	and cyclic_calendar<Rules> builds, at compile time, the day each year of
+	the cycle starts on, the day each month starts on and the month of each
+	day of the year.  A date then converts in O(1): one division by the
+	cycle length and a few table lookups, with no loops over years or months.
+
+	The Julian, Islamic and Vulcan calendars are defined on this engine here;
+	the Coptic, Ethiopic and arithmetic Persian calendars in their own headers.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/utility.hpp>
+#include <khronos/calendar_traits.hpp>
+#include <khronos/julian_calendar.hpp>
+#include <khronos/islamic_calendar.hpp>
+#include <khronos/vulcan_calendar.hpp>
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+
+namespace khronos {
+
+	template <typename Rules>
+	struct cyclic_calendar {
+		using rules = Rules;
+
+		static constexpr int CYCLE_YEARS = static_cast<int>(Rules::leap_years.size());
+		static constexpr int MONTHS = static_cast<int>(Rules::month_days.size());
+
+		static constexpr int COMMON_YEAR_DAYS = [] {
+			int days = 0;
+			for (day_t monthDays : Rules::month_days)
+				days += monthDays;
+			return days;
+		}();
+		static constexpr int MAX_YEAR_DAYS = COMMON_YEAR_DAYS + 1;
+
+		/** Days from the start of the cycle to the start of each of its years; [CYCLE_YEARS] is the cycle length. */
+		static constexpr auto YEAR_STARTS = [] {
+			std::array<long long, CYCLE_YEARS + 1> starts{};
+			for (int i = 0; i < CYCLE_YEARS; ++i)
+				starts[i + 1] = starts[i] + COMMON_YEAR_DAYS + Rules::leap_years[i];
+			return starts;
+		}();
+		static constexpr long long CYCLE_DAYS = YEAR_STARTS[CYCLE_YEARS];
+
+		/** Days from the start of the year to the start of each month, [0] for a common year and [1] for a leap year. */
+		static constexpr auto MONTH_STARTS = [] {
+			std::array<std::array<int, MONTHS + 1>, 2> starts{};
+			for (int leap = 0; leap < 2; ++leap)
+				for (int m = 0; m < MONTHS; ++m)
+					starts[leap][m + 1] = starts[leap][m] + Rules::month_days[m] + (leap && m + 1 == Rules::leap_month);
+			return starts;
+		}();
+
+		/** Month of each day of the year (0-based), for common and leap years. */
+		static constexpr auto MONTH_OF_DAY = [] {
+			std::array<std::array<std::uint8_t, MAX_YEAR_DAYS>, 2> months{};
+			for (int leap = 0; leap < 2; ++leap)
+				for (int m = 0; m < MONTHS; ++m)
+					for (int d = MONTH_STARTS[leap][m]; d < MONTH_STARTS[leap][m + 1]; ++d)
+						months[leap][d] = static_cast<std::uint8_t>(m + 1);
+			return months;
+		}();
+
+
+		static constexpr bool is_leapyear(year_t year) {
+			return Rules::leap_years[utility::floor_mod(year - 1, CYCLE_YEARS)];
+		}
+
+		static constexpr day_t days_in_month(year_t year, month_t month) {
+			if (month < 1 || month > MONTHS)
+				return 0;
+			return Rules::month_days[month - 1] + (month == Rules::leap_month && is_leapyear(year));
+		}
+
+		static constexpr int days_in_year(year_t year) {
+			return MONTH_STARTS[is_leapyear(year)][MONTHS];
+		}
+
+
+		/**	Days from 1/1/1 to a date.
+			A month outside [1..MONTHS] carries into the year: month 0 is the last month of the year before.
+			*/
+		static constexpr long long to_days(year_t year, month_t month, day_t day) {
+			long long const monthIndex = year * MONTHS + (month - 1);
+			year_t const y = utility::floor_div(monthIndex, MONTHS);
+			auto const m = static_cast<int>(monthIndex - y * MONTHS);
+			long long const cycle = utility::floor_div(y - 1, CYCLE_YEARS);
+			auto const i = static_cast<int>(y - 1 - cycle * CYCLE_YEARS);
+			return cycle * CYCLE_DAYS + YEAR_STARTS[i] + MONTH_STARTS[Rules::leap_years[i]][m] + day - 1;
+		}
+
+		/** Date 'days' after 1/1/1. */
+		static constexpr void from_days(long long days, year_t& year, month_t& month, day_t& day) {
+			long long const cycle = utility::floor_div(days, CYCLE_DAYS);
+			long long const rest = days - cycle * CYCLE_DAYS;
+
+			// the years of a cycle are nearly equal, so the proportional estimate is at most one year out
+			auto i = static_cast<int>(rest * CYCLE_YEARS / CYCLE_DAYS);
+			i += rest >= YEAR_STARTS[i + 1];
+			i -= rest < YEAR_STARTS[i];
+
+			auto const dayOfYear = static_cast<int>(rest - YEAR_STARTS[i]);
+			bool const leap = Rules::leap_years[i];
+			year = cycle * CYCLE_YEARS + i + 1;
+			month = MONTH_OF_DAY[leap][dayOfYear];
+			day = static_cast<day_t>(dayOfYear - MONTH_STARTS[leap][month - 1] + 1);
+		}
+
+
+		static jd_t to_jd(year_t year, month_t month, day_t day) {
+			return Rules::epoch + static_cast<jd_t>(to_days(year, month, day));
+		}
+
+		static void from_jd(jd_t jd, year_t& year, month_t& month, day_t& day) {
+			from_days(static_cast<long long>(jd_to_jdn(jd) - (Rules::epoch + 0.5)), year, month, day);
+		}
+
+
+		/** Midnight JDs of date columns. */
+		static void to_jd(std::span<year_t const> years, std::span<month_t const> months, std::span<day_t const> days, std::span<jd_t> jds) {
+			assert(months.size() >= years.size() && days.size() >= years.size() && jds.size() >= years.size());
+			for (std::size_t i = 0; i < years.size(); ++i)
+				jds[i] = to_jd(years[i], months[i], days[i]);
+		}
+
+		/** Dates of a JD column. */
+		static void from_jd(std::span<jd_t const> jds, std::span<year_t> years, std::span<month_t> months, std::span<day_t> days) {
+			assert(years.size() >= jds.size() && months.size() >= jds.size() && days.size() >= jds.size());
+			for (std::size_t i = 0; i < jds.size(); ++i)
+				from_jd(jds[i], years[i], months[i], days[i]);
+		}
+	};
+
+
+	/** Every cyclic calendar is a calendar for the generic algorithms. */
+	template <typename Rules>
+	struct calendar_traits<cyclic_calendar<Rules>> {
+		using engine = cyclic_calendar<Rules>;
+		static jd_t to_jd(year_t y, month_t m, day_t d) { return engine::to_jd(y, m, d); }
+		static void from_jd(jd_t jd, year_t& y, month_t& m, day_t& d) { engine::from_jd(jd, y, m, d); }
+		static month_t months_in_year(year_t) { return engine::MONTHS; }
+		static day_t days_in_month(year_t y, month_t m) { return engine::days_in_month(y, m); }
+		static int month_ordinal(year_t, month_t m) { return m - 1; }
+		static month_t month_at(year_t, int ordinal) { return ordinal + 1; }
+		static long long months_before(year_t y) { return engine::MONTHS * y; }
+		static year_t year_of_month(long long index) { return utility::floor_div(index, engine::MONTHS); }
+	};
+
+
+
+	// CALENDAR RULES
+	// --------------------------------------------------------------------------------------
+
+	/** Julian: a leap day in February every fourth year. */
+	struct julian_rules {
+		static constexpr jd_t epoch = JULIAN_EPOCH;
+		static constexpr std::array<bool, 4> leap_years = { false, false, false, true };
+		static constexpr std::array<day_t, 12> month_days = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+		static constexpr month_t leap_month = 2;
+	};
+	using julian_calendar = cyclic_calendar<julian_rules>;
+
+
+	/** Arithmetic Islamic: 11 leap days in Dhu al-Hijja in each 30 years. */
+	struct islamic_rules {
+		static constexpr jd_t epoch = ISLAMIC_EPOCH;
+		static constexpr std::array<bool, 30> leap_years = {
+			false, true, false, false, true, false, true, false, false, true,
+			false, false, true, false, false, true, false, true, false, false,
+			true, false, false, true, false, true, false, false, true, false };
+		static constexpr std::array<day_t, 12> month_days = { 30, 29, 30, 29, 30, 29, 30, 29, 30, 29, 30, 29 };
+		static constexpr month_t leap_month = 12;
+	};
+	using islamic_calendar = cyclic_calendar<islamic_rules>;
+
+
+	/** Vulcan: 12 months of 21 days, with a leap day in Tasmeen every fourth year. */
+	struct vulcan_rules {
+		static constexpr jd_t epoch = VULCAN_EPOCH;
+		static constexpr std::array<bool, 4> leap_years = { false, false, false, true };
+		static constexpr std::array<day_t, 12> month_days = { 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21 };
+		static constexpr month_t leap_month = 12;
+	};
+	using vulcan_calendar = cyclic_calendar<vulcan_rules>;
+
+} // end-of-namespace khronos
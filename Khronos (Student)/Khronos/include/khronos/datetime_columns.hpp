@@ -0,0 +1,58 @@
+#pragma once
+
+/**	@file khronos/datetime_columns.hpp
+	@date 2026-10-18
+
+	Column decoders of dates and times of day.
+
+	Times are decomposed exactly in integers: each row is rounded once to a
+	nanosecond of the day, snapped to the whole second its JD cannot be told
+	apart from (see jd_to_ns()), and split with multiply-shift (see
+	ns_to_hms()), so a time never renders as 59.99999 seconds or lands in
+	the wrong hour.
+	The seconds are whole; the nanoseconds past them are a separate column.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/timeofday.hpp>
+#include <khronos/calendar_traits.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+
+
+namespace khronos {
+
+	/** Time-of-day columns of a JD column. */
+	void jd_to_hms(std::span<jd_t const> jds,
+		std::span<hour_t> hours, std::span<minute_t> minutes, std::span<int> seconds, std::span<int> nanoseconds);
+
+	/** Time-of-day columns of a tick column; exact to the tick. */
+	void ticks_to_hms(std::span<tick_t const> ticks,
+		std::span<hour_t> hours, std::span<minute_t> minutes, std::span<int> seconds, std::span<int> nanoseconds);
+
+
+	namespace detail {
+		/* Rows decoded together: the time columns of a block are computed before its dates while both are in cache. */
+		constexpr std::size_t DATETIME_BLOCK = 256;
+	}
+
+	/** Date and time-of-day columns of a JD column in the calendar. */
+	template <typename Calendar>
+	void jd_to_datetime(std::span<jd_t const> jds,
+		std::span<year_t> years, std::span<month_t> months, std::span<day_t> days,
+		std::span<hour_t> hours, std::span<minute_t> minutes, std::span<int> seconds, std::span<int> nanoseconds) {
+		assert(years.size() >= jds.size() && months.size() >= jds.size() && days.size() >= jds.size());
+		for (std::size_t first = 0; first < jds.size(); first += detail::DATETIME_BLOCK) {
+			std::size_t const n = std::min(detail::DATETIME_BLOCK, jds.size() - first);
+			jd_to_hms(jds.subspan(first, n), hours.subspan(first, n), minutes.subspan(first, n),
+				seconds.subspan(first, n), nanoseconds.subspan(first, n));
+			for (std::size_t i = first; i < first + n; ++i)
+				calendar_traits<Calendar>::from_jd(jds[i], years[i], months[i], days[i]);
+		}
+	}
+
+} // end-of-namespace khronos
@@ -21,6 +21,9 @@ namespace khronos {
 	using month_t = int;
 	using year_t = long long;
 
+	/** Microseconds since JD 0.0: an exact, fixed-width instant for stored columns. */
+	using tick_t = long long;
+
 	/** Indicates the 'now' type used by default constructors. */
 	enum now_t { NOTIMEOFDAY = 0, WTIMEOFDAY };
 
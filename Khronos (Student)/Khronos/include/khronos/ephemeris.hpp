@@ -0,0 +1,145 @@
+#pragma once
+
+/**	@file khronos/ephemeris.hpp
+	@date 2026-10-18
+
+	Sun and Moon ephemeris for observational lunar calendars.
+
+	Positions come from the truncated series of Meeus, "Astronomical
+	Algorithms" (2nd ed.): the Sun from its low-accuracy solution (0.01
+	degree), the Moon from the principal terms of ELP-2000/82 (10 arc
+	seconds), and the true new moons from the mean lunation with its
+	periodic corrections (a few seconds of time).  Positions and new moons
+	are in Terrestrial Time (JDE); rise and set times are in UT.  The span
+	kernels evaluate a series one term at a time across a block of JDs, so
+	each inner loop is a straight run of multiply-adds and sines that the
+	compiler vectorizes.
+
+	A lunar month begins on the evening its crescent is first seen.
+	Visibility is Yallop's q test, evaluated at the "best time" 4/9 of the
+	way from sunset to moonset.  observed_islamic_months() walks the new
+	moons of a range of years once and packs the month lengths it finds
+	into an islamic_month_table, so conversions through it are O(1).
+
+	The Hebrew calendar has been fixed since the fourth century: its months
+	start from the molad, the mean conjunction of the traditional reckoning,
+	which hebrew_molad() gives.  Both calendars start their days at sunset;
+	sunset_date() finds the date an instant belongs to.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/islamic_variants.hpp>
+
+#include <span>
+
+
+namespace khronos {
+
+	// VALUES
+	constexpr double SYNODIC_MONTH = 29.530'588'861;
+
+	/** Altitude of the Sun's centre at sunrise and sunset: refraction and semidiameter, degrees. */
+	constexpr double SUNSET_ALTITUDE = -0.833'3;
+
+
+	/** A place on the Earth: degrees, north and east positive. */
+	struct geo_location {
+		double	latitude;
+		double	longitude;
+	};
+
+	/** Apparent geocentric ecliptic coordinates of date. */
+	struct ecliptic_position {
+		double	longitude;		// degrees [0..360)
+		double	latitude;		// degrees
+		double	distance;		// AU for the Sun, km for the Moon
+	};
+
+	/** Yallop's visibility classes of the young crescent, best first. */
+	enum class crescent_visibility {
+		easily_visible,			// A: q > +0.216
+		perfect_conditions,		// B: q > -0.014, visible to the eye under perfect conditions
+		optical_aid_to_find,	// C: q > -0.160, may need optical aid to find
+		optical_aid_only,		// D: q > -0.232, visible only with optical aid
+		below_telescope,		// E: q > -0.293, below the limit of a telescope
+		not_visible				// F: q <= -0.293, or the Moon sets before the Sun
+	};
+
+	/** The crescent seen from a place on one evening. */
+	struct crescent_observation {
+		jd_t				sunset;		// UT
+		jd_t				moonset;	// UT
+		jd_t				best_time;	// UT, sunset + 4/9 of the lag
+		double				arcl;		// elongation of the Moon from the Sun, degrees
+		double				arcv;		// altitude of the Moon above the Sun, degrees
+		double				width;		// topocentric crescent width, arc minutes
+		double				q;			// Yallop's q; NaN without a lag
+		crescent_visibility	visibility;
+	};
+
+
+	// TIME SCALES
+	/** TT - UT in seconds (Morrison & Stephenson's parabola; within a minute in recent centuries). */
+	double delta_t(jd_t jd);
+
+
+	// POSITIONS
+	/** Apparent position of the Sun at 'jde' (TT). */
+	ecliptic_position sun_position(jd_t jde);
+
+	/** Apparent position of the Moon at 'jde' (TT). */
+	ecliptic_position moon_position(jd_t jde);
+
+	void sun_positions(std::span<jd_t const> jdes, std::span<ecliptic_position> positions);
+	void moon_positions(std::span<jd_t const> jdes, std::span<ecliptic_position> positions);
+
+
+	// NEW MOONS
+	/** JDE (TT) of the true new moon of 'lunation'; lunation 0 is the new moon of 6 January 2000. */
+	jd_t new_moon(long long lunation);
+
+	/** JDEs of consecutive new moons, starting at 'firstLunation'. */
+	void new_moons(long long firstLunation, std::span<jd_t> jdes);
+
+	/** The lunation whose new moon is the last at or before 'jde' (TT). */
+	long long lunation_of(jd_t jde);
+
+	/** Molad (mean conjunction) of a Hebrew month, in Jerusalem mean time. */
+	jd_t hebrew_molad(year_t year, month_t month);
+
+
+	// RISING AND SETTING
+	/** Sunrise (UT) on the local date of 'day'; NaN if the Sun does not rise or set that day. */
+	jd_t sunrise(jd_t day, geo_location const& site);
+
+	/** Sunset (UT) on the local date of 'day'; NaN if the Sun does not rise or set that day. */
+	jd_t sunset(jd_t day, geo_location const& site);
+
+	/** Moonset (UT) nearest to 'jd'; NaN if the Moon does not set. */
+	jd_t moonset(jd_t jd, geo_location const& site);
+
+	void sunsets(std::span<jd_t const> days, geo_location const& site, std::span<jd_t> jds);
+
+	/** Midnight JD of the date 'jd' falls on when days begin at sunset. */
+	jd_t sunset_date(jd_t jd, geo_location const& site);
+
+
+	// CRESCENT
+	/** The crescent at best time on the evening of the local date of 'day'. */
+	crescent_observation observe_crescent(jd_t day, geo_location const& site);
+
+	/**	Midnight JD starting the month of 'lunation': the day after the first evening,
+		after the conjunction, whose crescent is at least 'required'.  A crescent not
+		seen by the third evening after the conjunction's date is taken as seen then.
+		*/
+	jd_t observed_month_start(long long lunation, geo_location const& site,
+		crescent_visibility required = crescent_visibility::perfect_conditions);
+
+	/**	Islamic months of the years [firstYear..lastYear] as seen from 'site'.
+		Months are 29 or 30 days: a crescent seen early or late moves the next month.
+		*/
+	islamic_month_table observed_islamic_months(year_t firstYear, year_t lastYear, geo_location const& site,
+		crescent_visibility required = crescent_visibility::perfect_conditions);
+
+} // end-of-namespace khronos
@@ -0,0 +1,229 @@
+#pragma once
+
+/**	@file khronos/event_index.hpp
+	@date 2026-10-18
+
+	Index of events (an interval and a payload) for overlap queries.
+
+	The events are kept sorted by start in parallel columns, which are read as
+	an implicit binary tree: the node at index i has level k when the low k
+	bits of i are 1, and its children are i -/+ 2^(k-1).  Each node also
+	stores the greatest end in its subtree, so a query descends only into
+	subtrees that can reach it and lists the k events found in
+	O(log n + k) without pointers or per-node allocation.  Small subtrees
+	are scanned linearly.
+
+	Inserted events wait in a small buffer, kept sorted by start, until it
+	outgrows about sqrt(n) events; then it is merged in and the tree's maxima
+	are rebuilt in one O(n) pass.  Queries binary-search the buffer, reading
+	only the events that start within its longest interval of the query.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/calendar_traits.hpp>
+#include <khronos/interval.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+namespace khronos {
+
+	template <typename Payload>
+	class event_index {
+	public:
+		struct event {
+			jd_interval	interval;
+			Payload		payload;
+		};
+
+	private:
+		static constexpr std::size_t MIN_PENDING = 256;
+		static constexpr int SCAN_LEVEL = 3;		// subtrees of at most 15 events are scanned
+
+		std::vector<tick_t>		starts_;
+		std::vector<tick_t>		ends_;
+		std::vector<tick_t>		maxEnds_;		// greatest end in the subtree of each node
+		std::vector<Payload>	payloads_;
+		int						rootLevel_ = -1;
+		std::vector<event>		pending_;		// sorted by start
+		tick_t					longestPending_ = 0;
+
+		void merge_pending();
+		void build_tree();
+
+	public:
+		event_index() = default;
+
+		/** Bulk load. */
+		explicit event_index(std::vector<event> events) : pending_(std::move(events)) { merge_pending(); }
+
+		/** Number of events. */
+		std::size_t size() const { return starts_.size() + pending_.size(); }
+		bool empty() const { return size() == 0; }
+
+		/** Add an event.  Its interval must not be empty: an instant is one tick long. */
+		void insert(jd_interval const& interval, Payload payload) {
+			assert(!interval.empty());
+			auto const at = std::ranges::upper_bound(pending_, interval.start, {}, [](event const& e) { return e.interval.start; });
+			pending_.insert(at, { interval, std::move(payload) });
+			longestPending_ = std::max(longestPending_, interval.length());
+			if (pending_.size() > std::max(MIN_PENDING, std::size_t(1) << (std::bit_width(starts_.size()) + 1) / 2))
+				merge_pending();
+		}
+
+		/** Add many events at once. */
+		void insert(std::span<event const> events) {
+			pending_.insert(pending_.end(), events.begin(), events.end());
+			merge_pending();
+		}
+
+
+		/** Call visit(interval, payload) for every event overlapping 'query', in no particular order. */
+		template <typename Visit>
+		void visit_overlapping(jd_interval const& query, Visit visit) const;
+
+		/** Every event overlapping 'query', in no particular order. */
+		std::vector<event> overlapping(jd_interval const& query) const {
+			std::vector<event> found;
+			visit_overlapping(query, [&](jd_interval const& interval, Payload const& payload) { found.push_back({ interval, payload }); });
+			return found;
+		}
+
+		/** Every event during the day (midnight to midnight) of a calendar date. */
+		template <typename Calendar>
+		std::vector<event> on_day(year_t year, month_t month, day_t day) const {
+			tick_t const start = jd_to_ticks(calendar_traits<Calendar>::to_jd(year, month, day));
+			return overlapping({ start, start + TICKS_PER_DAY });
+		}
+
+		template <typename Calendar>
+		std::vector<event> on_day(Calendar const& date) const {
+			return on_day<Calendar>(date.year(), date.month(), date.day());
+		}
+	};
+
+
+
+	template <typename Payload>
+	void event_index<Payload>::merge_pending() {
+		if (pending_.empty())
+			return;
+		std::ranges::sort(pending_, {}, [](event const& e) { return e.interval.start; });
+
+		// merge the sorted columns with the sorted pending events, from the back
+		std::size_t const oldSize = starts_.size(), newSize = oldSize + pending_.size();
+		starts_.resize(newSize);
+		ends_.resize(newSize);
+		payloads_.resize(newSize);
+		std::size_t i = oldSize, j = pending_.size(), out = newSize;
+		while (j > 0) {
+			if (i > 0 && starts_[i - 1] > pending_[j - 1].interval.start) {
+				--i;
+				--out;
+				starts_[out] = starts_[i];
+				ends_[out] = ends_[i];
+				payloads_[out] = std::move(payloads_[i]);
+			}
+			else {
+				--j;
+				--out;
+				starts_[out] = pending_[j].interval.start;
+				ends_[out] = pending_[j].interval.end;
+				payloads_[out] = std::move(pending_[j].payload);
+			}
+		}
+		pending_.clear();
+		longestPending_ = 0;
+		build_tree();
+	}
+
+
+	template <typename Payload>
+	void event_index<Payload>::build_tree() {
+		std::size_t const n = starts_.size();
+		maxEnds_ = ends_;
+		rootLevel_ = -1;
+		if (n == 0)
+			return;
+
+		// 'last' tracks the maximum of the rightmost node at each level, the stand-in for right children beyond n
+		std::size_t lastIndex = 0;
+		tick_t last = 0;
+		for (std::size_t i = 0; i < n; i += 2) {
+			lastIndex = i;
+			last = ends_[i];
+		}
+		int k = 1;
+		for (; (std::size_t(1) << k) <= n; ++k) {
+			std::size_t const half = std::size_t(1) << (k - 1), first = (half << 1) - 1, step = half << 2;
+			for (std::size_t i = first; i < n; i += step) {
+				tick_t const left = maxEnds_[i - half];
+				tick_t const right = i + half < n ? maxEnds_[i + half] : last;
+				maxEnds_[i] = std::max({ ends_[i], left, right });
+			}
+			lastIndex = (lastIndex >> k & 1) ? lastIndex - half : lastIndex + half;
+			if (lastIndex < n && maxEnds_[lastIndex] > last)
+				last = maxEnds_[lastIndex];
+		}
+		rootLevel_ = k - 1;
+	}
+
+
+	template <typename Payload>
+	template <typename Visit>
+	void event_index<Payload>::visit_overlapping(jd_interval const& query, Visit visit) const {
+		if (query.empty())
+			return;
+
+		// a pending event can only reach the query if it starts less than the longest pending interval before it
+		auto e = pending_.begin();
+		if (query.start >= std::numeric_limits<tick_t>::min() + longestPending_)
+			e = std::ranges::upper_bound(pending_, query.start - longestPending_, {}, [](event const& p) { return p.interval.start; });
+		for (; e != pending_.end() && e->interval.start < query.end; ++e)
+			if (query.start < e->interval.end)
+				visit(e->interval, e->payload);
+		if (rootLevel_ < 0)
+			return;
+
+		struct node {
+			std::size_t	index;
+			int			level;
+			bool		leftDone;
+		};
+		node stack[64];
+		int top = 0;
+		std::size_t const n = starts_.size();
+		stack[top++] = { (std::size_t(1) << rootLevel_) - 1, rootLevel_, false };
+		while (top > 0) {
+			node const z = stack[--top];
+			if (z.level <= SCAN_LEVEL) {
+				std::size_t const first = z.index >> z.level << z.level;
+				std::size_t const last = std::min(n, first + (std::size_t(1) << (z.level + 1)) - 1);
+				for (std::size_t i = first; i < last && starts_[i] < query.end; ++i)
+					if (query.start < ends_[i])
+						visit(jd_interval{ starts_[i], ends_[i] }, payloads_[i]);
+			}
+			else if (!z.leftDone) {
+				// revisit this node after its left subtree, if that subtree can reach the query
+				std::size_t const left = z.index - (std::size_t(1) << (z.level - 1));
+				stack[top++] = { z.index, z.level, true };
+				if (left >= n || maxEnds_[left] > query.start)
+					stack[top++] = { left, z.level - 1, false };
+			}
+			else if (z.index < n && starts_[z.index] < query.end) {
+				if (query.start < ends_[z.index])
+					visit(jd_interval{ starts_[z.index], ends_[z.index] }, payloads_[z.index]);
+				stack[top++] = { z.index + (std::size_t(1) << (z.level - 1)), z.level - 1, false };
+			}
+		}
+	}
+
+} // end-of-namespace khronos
@@ -69,6 +69,18 @@ namespace khronos {
 	void jd_to_gregorian(jd_t jd, year_t& year, month_t& month, day_t& day,
 		hour_t& hour, minute_t& minute, second_t& second);
 
+	/** ISO 8601 week date. */
+	struct iso_week_date {
+		year_t	year;		// the ISO week-numbering year
+		int		week;		// [1..53]
+		day_t	weekday;	// [1..7], where 1 = Monday
+	};
+
+	inline bool operator==(iso_week_date const& lhs, iso_week_date const& rhs) {
+		return lhs.year == rhs.year && lhs.week == rhs.week && lhs.weekday == rhs.weekday;
+	}
+
+
 	// CLASSES
 	// --------------------------------------------------------------------------------------
 
@@ -105,6 +117,12 @@ namespace khronos {
 		operator jd_t() const { return to_jd(); }
 		std::string to_string() const;
 
+		// Calendar positions
+		day_t day_of_week() const;		// [0..6], 0 = Monday
+		day_t day_of_year() const;
+		int week_of_year() const;
+		iso_week_date iso_week() const;
+
 		// Assignment
 		Gregorian& operator=(jd_t jd);
 
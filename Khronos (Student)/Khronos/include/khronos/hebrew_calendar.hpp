@@ -10,6 +10,7 @@
 #include <khronos/def.hpp>
 #include <khronos/calendar.hpp>
 #include <khronos/julian_day.hpp>
+#include <khronos/utility.hpp>
 #include <string>
 
 namespace khronos {
@@ -23,7 +24,9 @@ namespace khronos {
 	   3, 6, 8, 11, 14, 17, and 19
 	*/
 	constexpr bool is_hebrew_leapyear(year_t year) {
-		int cycle_year = ((year - 1) % 19) + 1;
+		int cycle_year = ((year - 1) % 19);
+		if (cycle_year < 0) cycle_year += 19;
+		cycle_year++;
 		return (cycle_year == 3 || cycle_year == 6 || cycle_year == 8 || cycle_year == 11 ||
 			cycle_year == 14 || cycle_year == 17 || cycle_year == 19);
 	}
@@ -33,6 +36,16 @@ namespace khronos {
 		return is_hebrew_leapyear(year) ? 13 : 12;
 	}
 
+	/** Months from Tishri 1 AM to Tishri of 'year': 235 months in each 19-year cycle. */
+	constexpr long long hebrew_months_elapsed(year_t year) {
+		return utility::floor_div(235 * year - 234, 19);
+	}
+
+	/** The year whose Tishri is the last at or before the month 'months' after Tishri 1 AM. */
+	constexpr year_t hebrew_year_of_month(long long months) {
+		return utility::floor_div(19 * months + 252, 235);
+	}
+
 	/** Get the day of year for Rosh Hashanah */
 	long long hebrew_delay_1(year_t year);
 	long long hebrew_delay_2(year_t year);
@@ -94,6 +107,11 @@ namespace khronos {
 		operator jd_t() const { return to_jd(); }
 		std::string to_string() const;
 
+		// Calendar positions
+		day_t day_of_week() const;		// [0..6], 0 = Monday
+		day_t day_of_year() const;
+		int week_of_year() const;
+
 		// Assignment
 		Hebrew& operator=(jd_t jd);
 
@@ -0,0 +1,320 @@
+#pragma once
+
+/**	@file khronos/historical_calendar.hpp
+	@date 2026-10-18
+
+	Historical calendar: Julian before a country's Gregorian reform, Gregorian after.
+
+	A reform policy names the first Gregorian date; the day before it is the
+	last Julian date, and the Julian dates between them never happened.
+	Britain went from Wednesday 2 September 1752 to Thursday 14 September, so
+	September 1752 has 19 days and 1752 has 355.  Years are numbered from
+	1 January on both sides of the reform (the British legal year began on
+	25 March until 1752; such dates must be converted first).
+
+	The Julian Day Number of the reform is a compile-time constant of the
+	policy, so a conversion is one comparison and one O(1) conversion in the
+	chosen calendar.  Dates that fall in the skipped days are not valid:
+	is_historical_date() and the generic is_valid(), make_date() and
+	validate() reject them, and to_jd() reads them as Julian dates.  The
+	other generic algorithms of calendar_traits count day numbers (1 to the
+	last day of the month), so in a reform month they also count the
+	skipped days: use historical_month_length() there.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/utility.hpp>
+#include <khronos/calendar_traits.hpp>
+#include <khronos/gregorian_calendar.hpp>
+#include <khronos/julian_calendar.hpp>
+#include <khronos/week.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <string>
+
+
+namespace khronos {
+
+	namespace detail {
+		/** Julian Day Number of a Gregorian date. */
+		constexpr long long gregorian_jdn(year_t year, month_t month, day_t day) {
+			// years start in March so that the leap day ends the year
+			year_t const y = year - (month <= 2);
+			long long const era = utility::floor_div(y, 400);
+			long long const yearOfEra = y - era * 400;
+			long long const dayOfYear = (153 * ((month + 9) % 12) + 2) / 5 + day - 1;
+			long long const dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+			return era * 146'097 + dayOfEra + 1'721'120;
+		}
+	}
+
+
+	// REFORM POLICIES
+	// --------------------------------------------------------------------------------------
+
+	/** A reform whose first Gregorian date is Year-Month-Day. */
+	template <year_t Year, month_t Month, day_t Day>
+	struct gregorian_reform {
+		static constexpr year_t year = Year;
+		static constexpr month_t month = Month;
+		static constexpr day_t day = Day;
+		static constexpr long long first_jdn = detail::gregorian_jdn(Year, Month, Day);
+	};
+
+	/** Spain, Portugal and the Papal States: Thursday 4 October 1582 was followed by Friday 15 October. */
+	using papal_reform = gregorian_reform<1582, 10, 15>;
+
+	/** Great Britain and its colonies: 2 September 1752 was followed by 14 September. */
+	using british_reform = gregorian_reform<1752, 9, 14>;
+
+	/** Soviet Russia: 31 January 1918 was followed by 14 February. */
+	using russian_reform = gregorian_reform<1918, 2, 14>;
+
+
+
+	// FUNCTIONS
+	// --------------------------------------------------------------------------------------
+
+	/** 'true' if the date is on or after the first Gregorian date of the reform. */
+	template <typename Reform>
+	constexpr bool is_historical_gregorian(year_t year, month_t month, day_t day) {
+		if (year != Reform::year)
+			return year > Reform::year;
+		if (month != Reform::month)
+			return month > Reform::month;
+		return day >= Reform::day;
+	}
+
+	/** Last day number of the month: the Julian length before the reform month, the Gregorian length from it on. */
+	template <typename Reform>
+	constexpr day_t historical_days_in_month(year_t year, month_t month) {
+		return year > Reform::year || (year == Reform::year && month >= Reform::month)
+			? gregorian_days_in_month(month, is_gregorian_leapyear(year))
+			: julian_days_in_month(month, is_julian_leapyear(year));
+	}
+
+	/** Convert a historical date to Julian Day (midnight). */
+	template <typename Reform>
+	jd_t historical_to_jd(year_t year, month_t month, day_t day) {
+		return is_historical_gregorian<Reform>(year, month, day)
+			? gregorian_to_jd(year, month, day)
+			: julian_to_jd(year, month, day);
+	}
+
+	/** Convert a historical date and time to Julian Day. */
+	template <typename Reform>
+	jd_t historical_to_jd(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second) {
+		return is_historical_gregorian<Reform>(year, month, day)
+			? gregorian_to_jd(year, month, day, hour, minute, second)
+			: julian_to_jd(year, month, day, hour, minute, second);
+	}
+
+	/** Convert Julian Day to a historical date. */
+	template <typename Reform>
+	void jd_to_historical(jd_t jd, year_t& year, month_t& month, day_t& day) {
+		if (jd_to_jdn(jd) >= Reform::first_jdn)
+			jd_to_gregorian(jd, year, month, day);
+		else
+			jd_to_julian(jd, year, month, day);
+	}
+
+	/** Convert Julian Day to a historical date and time. */
+	template <typename Reform>
+	void jd_to_historical(jd_t jd, year_t& year, month_t& month, day_t& day, hour_t& hour, minute_t& minute, second_t& second) {
+		if (jd_to_jdn(jd) >= Reform::first_jdn)
+			jd_to_gregorian(jd, year, month, day, hour, minute, second);
+		else
+			jd_to_julian(jd, year, month, day, hour, minute, second);
+	}
+
+	/** 'true' if the date existed: its day is in the month and was not skipped by the reform. */
+	template <typename Reform>
+	bool is_historical_date(year_t year, month_t month, day_t day) {
+		if (month < 1 || month > 12 || day < 1 || day > historical_days_in_month<Reform>(year, month))
+			return false;
+		return is_historical_gregorian<Reform>(year, month, day)
+			|| date_jdn<Julian>(year, month, day) < Reform::first_jdn;
+	}
+
+
+	namespace detail {
+		/** Julian Day Number of the first day of a month that existed. */
+		template <typename Reform>
+		long long historical_month_start(year_t year, month_t month) {
+			if (month > 12) {
+				++year;
+				month = 1;
+			}
+			// only the reform month can start inside the skipped days
+			return is_historical_date<Reform>(year, month, 1)
+				? static_cast<long long>(historical_to_jd<Reform>(year, month, 1) + 0.5)
+				: Reform::first_jdn;
+		}
+	}
+
+	/** Number of days the month actually had; fewer than its last day number in the months the reform cut. */
+	template <typename Reform>
+	day_t historical_month_length(year_t year, month_t month) {
+		return static_cast<day_t>(detail::historical_month_start<Reform>(year, month + 1) - detail::historical_month_start<Reform>(year, month));
+	}
+
+	/** Number of days the year actually had. */
+	template <typename Reform>
+	int historical_days_in_year(year_t year) {
+		return static_cast<int>(detail::historical_month_start<Reform>(year + 1, 1) - detail::historical_month_start<Reform>(year, 1));
+	}
+
+
+	/** Midnight JDs of a column of historical dates. */
+	template <typename Reform>
+	void historical_to_jd(std::span<year_t const> years, std::span<month_t const> months, std::span<day_t const> days, std::span<jd_t> jds) {
+		assert(months.size() >= years.size() && days.size() >= years.size() && jds.size() >= years.size());
+		for (std::size_t i = 0; i < years.size(); ++i)
+			jds[i] = historical_to_jd<Reform>(years[i], months[i], days[i]);
+	}
+
+	/** Historical dates of a JD column. */
+	template <typename Reform>
+	void jd_to_historical(std::span<jd_t const> jds, std::span<year_t> years, std::span<month_t> months, std::span<day_t> days) {
+		assert(years.size() >= jds.size() && months.size() >= jds.size() && days.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			jd_to_historical<Reform>(jds[i], years[i], months[i], days[i]);
+	}
+
+
+
+	// CLASSES
+	// --------------------------------------------------------------------------------------
+
+	/**	Historical Calendar Date class: Julian before Reform, Gregorian from it on. */
+	template <typename Reform>
+	class Historical {
+		year_t year_;
+		month_t month_;
+		day_t day_;
+		hour_t hour_;
+		minute_t minute_;
+		second_t second_;
+
+		void from_jd(jd_t jd) {
+			jd_to_historical<Reform>(jd, year_, month_, day_, hour_, minute_, second_);
+		}
+
+		/* Move a day past the end of the month, or skipped by the reform, onto a day of the month that existed. */
+		void clamp_day() {
+			day_ = std::min(day_, historical_days_in_month<Reform>(year_, month_));
+			if (is_historical_date<Reform>(year_, month_, day_))
+				return;
+			if (year_ == Reform::year && month_ == Reform::month)
+				day_ = Reform::day;
+			else {	// the reform month starts the next month: end on the last Julian day
+				year_t y;
+				month_t m;
+				jd_to_julian(static_cast<jd_t>(Reform::first_jdn - 1), y, m, day_);
+			}
+		}
+
+	public:
+		using reform = Reform;
+
+		// Constructors
+		Historical(jd_t jd) { from_jd(jd); }
+		Historical(year_t year, month_t month, day_t day)
+			: year_(year), month_(month), day_(day), hour_(0), minute_(0), second_(0) {
+		}
+		Historical(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second)
+			: year_(year), month_(month), day_(day), hour_(hour), minute_(minute), second_(second) {
+		}
+
+		// Accessors
+		year_t year() const { return year_; }
+		month_t month() const { return month_; }
+		day_t day() const { return day_; }
+		hour_t hour() const { return hour_; }
+		minute_t minute() const { return minute_; }
+		second_t second() const { return second_; }
+		bool is_gregorian() const { return is_historical_gregorian<Reform>(year_, month_, day_); }
+
+		// Conversion
+		jd_t to_jd() const { return historical_to_jd<Reform>(year_, month_, day_, hour_, minute_, second_); }
+		operator jd_t() const { return to_jd(); }
+		std::string to_string() const {
+			return is_gregorian()
+				? Gregorian(year_, month_, day_, hour_, minute_, second_).to_string()
+				: Julian(year_, month_, day_, hour_, minute_, second_).to_string();
+		}
+
+		// Calendar positions
+		day_t day_of_week() const { return khronos::day_of_week<Historical>(year_, month_, day_); }
+		day_t day_of_year() const { return khronos::day_of_year<Historical>(year_, month_, day_); }
+		int week_of_year() const { return khronos::week_of_year<Historical>(year_, month_, day_); }
+
+		// Assignment
+		Historical& operator=(jd_t jd) {
+			from_jd(jd);
+			return *this;
+		}
+
+		// Arithmetic operations
+		/* Whole years keep the month and day (29 February becomes the 28th where it does not exist); fractions are orbital days. */
+		Historical& operator+=(detail::packaged_year_real const& year) {
+			auto const wholeYears = static_cast<long long>(year.value);
+			year_ += wholeYears;
+			clamp_day();
+
+			double const fractionalYears = year.value - wholeYears;
+			if (fractionalYears != 0.0)
+				from_jd(to_jd() + fractionalYears * EARTH_ORBITAL_PERIOD_DAYS);
+			return *this;
+		}
+
+		/* A day the reform skipped moves forward to the first Gregorian day of the month. */
+		Historical& operator+=(detail::packaged_month_integer const& month) {
+			long long const index = 12 * year_ + (month_ - 1) + month.value;
+			year_ = utility::floor_div(index, 12);
+			month_ = static_cast<month_t>(utility::floor_mod(index, 12) + 1);
+			clamp_day();
+			return *this;
+		}
+
+		Historical operator+(detail::packaged_year_real const& year) const { return Historical(*this) += year; }
+		Historical operator+(detail::packaged_month_integer const& month) const { return Historical(*this) += month; }
+		Historical operator-(detail::packaged_month_integer const& month) const { return *this + detail::packaged_month_integer(-month.value); }
+	};
+
+	// Relational operators
+	template <typename Reform>
+	bool operator==(Historical<Reform> const& lhs, Historical<Reform> const& rhs) {
+		return lhs.to_jd() == rhs.to_jd();
+	}
+
+	template <typename Reform>
+	auto operator<=>(Historical<Reform> const& lhs, Historical<Reform> const& rhs) {
+		return lhs.to_jd() <=> rhs.to_jd();
+	}
+
+	// Difference operator
+	template <typename Reform>
+	jd_t operator-(Historical<Reform> const& lhs, Historical<Reform> const& rhs) {
+		return lhs.to_jd() - rhs.to_jd();
+	}
+
+
+	template <typename Reform>
+	struct calendar_traits<Historical<Reform>> {
+		static jd_t to_jd(year_t y, month_t m, day_t d) { return historical_to_jd<Reform>(y, m, d); }
+		static void from_jd(jd_t jd, year_t& y, month_t& m, day_t& d) { jd_to_historical<Reform>(jd, y, m, d); }
+		static month_t months_in_year(year_t) { return 12; }
+		static day_t days_in_month(year_t y, month_t m) { return historical_days_in_month<Reform>(y, m); }
+		static bool is_date(year_t y, month_t m, day_t d) { return is_historical_date<Reform>(y, m, d); }
+		static int month_ordinal(year_t, month_t m) { return m - 1; }
+		static month_t month_at(year_t, int ordinal) { return ordinal + 1; }
+		static long long months_before(year_t y) { return 12 * y; }
+		static year_t year_of_month(long long index) { return utility::floor_div(index, 12); }
+	};
+
+} // end-of-namespace khronos
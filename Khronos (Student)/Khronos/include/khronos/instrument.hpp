@@ -0,0 +1,151 @@
+#pragma once
+
+/**	@file khronos/instrument.hpp
+	@date 2026-10-18
+
+	Khronos library hot-path instrumentation.
+
+	Build with KHRONOS_INSTRUMENT defined to count the calls of every public
+	conversion, arithmetic and formatting entry point; define
+	KHRONOS_INSTRUMENT_TIMING as well to accumulate the cycles spent in each
+	(inclusive of nested probes).  Each thread counts into its own
+	cache-line-padded slots; snapshot() sums every thread.
+
+	The Instrumented configuration of the test project defines both macros;
+	ut157 checks the counts of known calls in it.
+
+	Without KHRONOS_INSTRUMENT, KHRONOS_PROBE() expands to nothing and this
+	header declares nothing.
+	*/
+
+#if defined(KHRONOS_INSTRUMENT)
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+#if defined(KHRONOS_INSTRUMENT_TIMING)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+#endif
+
+
+/** The probes: X(name) for each instrumented entry point. */
+#define KHRONOS_PROBES(X) \
+	X(gregorian_to_jd) X(gregorian_to_jd_hms) X(jd_to_gregorian) X(jd_to_gregorian_hms) \
+	X(julian_to_jd) X(julian_to_jd_hms) X(jd_to_julian) X(jd_to_julian_hms) \
+	X(islamic_to_jd) X(islamic_to_jd_hms) X(jd_to_islamic) X(jd_to_islamic_hms) \
+	X(hebrew_to_jd) X(hebrew_to_jd_hms) X(jd_to_hebrew) X(jd_to_hebrew_hms) \
+	X(vulcan_to_jd) X(vulcan_to_jd_hms) X(jd_to_vulcan) X(jd_to_vulcan_hms) \
+	X(hebrew_delay_1) X(hebrew_delay_2) X(hebrew_year_days) X(hebrew_days_in_month) \
+	X(Gregorian_to_jd) X(Gregorian_from_jd) X(Gregorian_add_years) X(Gregorian_add_months) X(Gregorian_to_string) \
+	X(Julian_to_jd) X(Julian_from_jd) X(Julian_add_years) X(Julian_add_months) X(Julian_to_string) \
+	X(Islamic_to_jd) X(Islamic_from_jd) X(Islamic_add_years) X(Islamic_add_months) X(Islamic_to_string) \
+	X(Hebrew_to_jd) X(Hebrew_from_jd) X(Hebrew_add_years) X(Hebrew_add_months) X(Hebrew_to_string) \
+	X(Vulcan_to_jd) X(Vulcan_from_jd) X(Vulcan_add_years) X(Vulcan_add_months) X(Vulcan_to_string) \
+	X(Jd_now) X(Jd_arithmetic)
+
+
+namespace khronos {
+
+	namespace instrument {
+
+		enum class probe : unsigned {
+#define KHRONOS_PROBE_ENUMERATOR(name) name,
+			KHRONOS_PROBES(KHRONOS_PROBE_ENUMERATOR)
+#undef KHRONOS_PROBE_ENUMERATOR
+		};
+
+#define KHRONOS_PROBE_ONE(name) + 1
+		constexpr std::size_t PROBE_COUNT = 0 KHRONOS_PROBES(KHRONOS_PROBE_ONE);
+#undef KHRONOS_PROBE_ONE
+
+		char const* probe_name(probe p);
+
+		/** Totals of one probe.  'ticks' are TSC cycles (steady-clock ns off x86); 0 without KHRONOS_INSTRUMENT_TIMING. */
+		struct probe_totals {
+			std::uint64_t calls = 0;
+			std::uint64_t ticks = 0;
+		};
+		using snapshot_type = std::array<probe_totals, PROBE_COUNT>;
+
+		/** Totals of every thread, live and exited, since the last reset(). */
+		snapshot_type snapshot();
+
+		/** Zero every thread's counters.  Counts made concurrently with reset() may survive it. */
+		void reset();
+
+		/** Print the probes that were hit: calls, ticks and ticks/call. */
+		void dump(std::ostream& os, snapshot_type const& totals);
+		void dump(std::ostream& os);
+
+
+		namespace detail {
+			/** One probe's counters, alone in its cache line.  Only the owning thread writes them. */
+			struct alignas(64) slot {
+				std::atomic<std::uint64_t> calls{ 0 };
+				std::atomic<std::uint64_t> ticks{ 0 };
+			};
+
+			/** A thread's slots, registered for snapshot() while the thread lives. */
+			struct thread_slots {
+				std::array<slot, PROBE_COUNT> slots;
+				thread_slots();
+				~thread_slots();
+			};
+
+			inline slot& this_thread_slot(probe p) {
+				thread_local thread_slots block;
+				return block.slots[static_cast<std::size_t>(p)];
+			}
+
+			inline void add(std::atomic<std::uint64_t>& counter, std::uint64_t n) {
+				counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+			}
+
+#if defined(KHRONOS_INSTRUMENT_TIMING)
+			inline std::uint64_t ticks() {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+				return __rdtsc();
+#else
+				return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+			}
+#endif
+
+			/** Counts a call on construction; with timing, adds the ticks to destruction. */
+			class probe_scope {
+				slot& slot_;
+#if defined(KHRONOS_INSTRUMENT_TIMING)
+				std::uint64_t start_ = ticks();
+#endif
+			public:
+				explicit probe_scope(probe p) : slot_(this_thread_slot(p)) { add(slot_.calls, 1); }
+#if defined(KHRONOS_INSTRUMENT_TIMING)
+				~probe_scope() { add(slot_.ticks, ticks() - start_); }
+#endif
+				probe_scope(probe_scope const&) = delete;
+				void operator = (probe_scope const&) = delete;
+			};
+		}
+
+	} // end-of-namespace instrument
+
+} // end-of-namespace khronos
+
+
+/** Instruments the enclosing scope as the probe 'name'. */
+#define KHRONOS_PROBE(name) khronos::instrument::detail::probe_scope khronos_probe_scope_(khronos::instrument::probe::name)
+
+#else
+
+#define KHRONOS_PROBE(name) ((void)0)
+
+#endif
@@ -0,0 +1,123 @@
+#pragma once
+
+/**	@file khronos/interval.hpp
+	@date 2026-10-18
+
+	Time intervals and sets of intervals.
+
+	A jd_interval is the closed-open range [start, end) of ticks, so intervals
+	that touch do not overlap and the boundaries are exact to the microsecond.
+	An interval_set holds disjoint, non-touching intervals sorted by start, as
+	two parallel columns of starts and ends.  Union, intersection and
+	difference are single linear merges of the two sets; point and interval
+	queries are a branch-free binary search over the starts.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+
+namespace khronos {
+
+	/** The ticks [start, end).  Empty when end <= start. */
+	struct jd_interval {
+		tick_t	start;
+		tick_t	end;
+
+		/** The interval from 'first' up to, but not including, 'last'. */
+		static jd_interval from_jds(jd_t first, jd_t last) { return { jd_to_ticks(first), jd_to_ticks(last) }; }
+
+		jd_t start_jd() const { return ticks_to_jd(start); }
+		jd_t end_jd() const { return ticks_to_jd(end); }
+
+		bool empty() const { return end <= start; }
+		tick_t length() const { return empty() ? 0 : end - start; }
+		bool contains(tick_t t) const { return start <= t && t < end; }
+		bool overlaps(jd_interval const& other) const {
+			return !empty() && !other.empty() && start < other.end && other.start < end;
+		}
+
+		/** The boundaries in a calendar, for display. */
+		template <typename Calendar>
+		Calendar start_date() const { return Calendar(start_jd()); }
+		template <typename Calendar>
+		Calendar end_date() const { return Calendar(end_jd()); }
+	};
+
+	constexpr bool operator==(jd_interval const& lhs, jd_interval const& rhs) {
+		return lhs.start == rhs.start && lhs.end == rhs.end;
+	}
+
+
+	/** "[start, end)" with both boundaries in the calendar. */
+	template <typename Calendar>
+	std::string to_string(jd_interval const& interval) {
+		return "[" + interval.start_date<Calendar>().to_string() + ", " + interval.end_date<Calendar>().to_string() + ")";
+	}
+
+
+
+	/**	Set of ticks as sorted, disjoint intervals.
+		Adjacent and overlapping input intervals are coalesced and empty ones
+		dropped, so every set has one representation.
+		*/
+	class interval_set {
+		std::vector<tick_t>	starts_;
+		std::vector<tick_t>	ends_;
+
+		/** Number of intervals starting at or before 't'. */
+		std::size_t starting_by(tick_t t) const;
+
+	public:
+		interval_set() = default;
+
+		/** The union of 'intervals', in any order. */
+		explicit interval_set(std::span<jd_interval const> intervals);
+
+		std::size_t size() const { return starts_.size(); }
+		bool empty() const { return starts_.empty(); }
+		jd_interval operator[](std::size_t i) const { return { starts_[i], ends_[i] }; }
+		std::span<tick_t const> starts() const { return starts_; }
+		std::span<tick_t const> ends() const { return ends_; }
+
+		/** Ticks covered by the set. */
+		tick_t length() const;
+
+		/** Add an interval, coalescing it with those it touches. */
+		void insert(jd_interval const& interval);
+
+		bool contains(tick_t t) const;
+
+		/** Every tick of 'interval' is in the set (true for an empty interval). */
+		bool contains(jd_interval const& interval) const;
+
+		/** Some tick of 'interval' is in the set. */
+		bool overlaps(jd_interval const& interval) const;
+
+		/**	Containment of a tick column: bit i % 64 of mask word i / 64 is set when ticks[i] is in the set.
+			@return the number of ticks in the set.
+			*/
+		std::size_t contains(std::span<tick_t const> ticks, std::span<std::uint64_t> mask) const;
+
+		friend interval_set operator|(interval_set const& lhs, interval_set const& rhs);
+		friend interval_set operator&(interval_set const& lhs, interval_set const& rhs);
+		friend interval_set operator-(interval_set const& lhs, interval_set const& rhs);
+		friend bool operator==(interval_set const& lhs, interval_set const& rhs) = default;
+	};
+
+	/** Ticks in either set. */
+	interval_set operator|(interval_set const& lhs, interval_set const& rhs);
+
+	/** Ticks in both sets. */
+	interval_set operator&(interval_set const& lhs, interval_set const& rhs);
+
+	/** Ticks of 'lhs' not in 'rhs'. */
+	interval_set operator-(interval_set const& lhs, interval_set const& rhs);
+
+} // end-of-namespace khronos
@@ -69,8 +69,13 @@ namespace khronos {
 		hour_t& hour, minute_t& minute, second_t& second);
 
 	// CLASSES
-	/**	Islamic Calendar Date class. */
-	class Islamic {
+	struct islamic_rules;		// the arithmetic calendar, khronos/cyclic_calendar.hpp
+
+	/**	Islamic Calendar Date class of the rule set 'Rules'.
+		The members are defined in khronos/islamic_variants.hpp.
+		*/
+	template <typename Rules>
+	class basic_islamic {
 		year_t year_;
 		month_t month_;
 		day_t day_;
@@ -81,12 +86,14 @@ namespace khronos {
 		void from_jd(jd_t jd);
 
 	public:
+		using rules = Rules;
+
 		// Constructors
-		Islamic();
-		Islamic(now_t now);
-		Islamic(jd_t jd);
-		Islamic(year_t year, month_t month, day_t day);
-		Islamic(year_t year, month_t month, day_t day,
+		basic_islamic();
+		basic_islamic(now_t now);
+		basic_islamic(jd_t jd);
+		basic_islamic(year_t year, month_t month, day_t day);
+		basic_islamic(year_t year, month_t month, day_t day,
 			hour_t hour, minute_t minute, second_t second);
 
 		// Accessors
@@ -102,48 +109,65 @@ namespace khronos {
 		operator jd_t() const { return to_jd(); }
 		std::string to_string() const;
 
+		// Calendar positions
+		day_t day_of_week() const;		// [0..6], 0 = Monday
+		day_t day_of_year() const;
+		int week_of_year() const;
+
 		// Assignment
-		Islamic& operator=(jd_t jd);
+		basic_islamic& operator=(jd_t jd);
 
 		// Arithmetic operations
-		Islamic& operator+=(detail::packaged_year_real const& year);
-		Islamic& operator+=(detail::packaged_month_integer const& month);
-		Islamic operator+(detail::packaged_year_real const& year) const;
-		Islamic operator+(detail::packaged_month_integer const& month) const;
-		Islamic operator-(detail::packaged_month_integer const& month) const;
+		basic_islamic& operator+=(detail::packaged_year_real const& year);
+		basic_islamic& operator+=(detail::packaged_month_integer const& month);
+		basic_islamic operator+(detail::packaged_year_real const& year) const;
+		basic_islamic operator+(detail::packaged_month_integer const& month) const;
+		basic_islamic operator-(detail::packaged_month_integer const& month) const;
 	};
 
+	/** The arithmetic Islamic calendar, instantiated in islamic.cpp. */
+	using Islamic = basic_islamic<islamic_rules>;
+	extern template class basic_islamic<islamic_rules>;
+
 	// Relational operators
-	constexpr bool operator==(Islamic const& lhs, Islamic const& rhs) {
+	template <typename Rules>
+	constexpr bool operator==(basic_islamic<Rules> const& lhs, basic_islamic<Rules> const& rhs) {
 		return lhs.to_jd() == rhs.to_jd();
 	}
 
-	constexpr auto operator<=>(Islamic const& lhs, Islamic const& rhs) {
+	template <typename Rules>
+	constexpr auto operator<=>(basic_islamic<Rules> const& lhs, basic_islamic<Rules> const& rhs) {
 		return lhs.to_jd() <=> rhs.to_jd();
 	}
 
-	constexpr bool operator!=(Islamic const& lhs, Islamic const& rhs) {
+	template <typename Rules>
+	constexpr bool operator!=(basic_islamic<Rules> const& lhs, basic_islamic<Rules> const& rhs) {
 		return !(lhs == rhs);
 	}
 
-	constexpr bool operator<(Islamic const& lhs, Islamic const& rhs) {
+	template <typename Rules>
+	constexpr bool operator<(basic_islamic<Rules> const& lhs, basic_islamic<Rules> const& rhs) {
 		return lhs.to_jd() < rhs.to_jd();
 	}
 
-	constexpr bool operator<=(Islamic const& lhs, Islamic const& rhs) {
+	template <typename Rules>
+	constexpr bool operator<=(basic_islamic<Rules> const& lhs, basic_islamic<Rules> const& rhs) {
 		return lhs.to_jd() <= rhs.to_jd();
 	}
 
-	constexpr bool operator>(Islamic const& lhs, Islamic const& rhs) {
+	template <typename Rules>
+	constexpr bool operator>(basic_islamic<Rules> const& lhs, basic_islamic<Rules> const& rhs) {
 		return lhs.to_jd() > rhs.to_jd();
 	}
 
-	constexpr bool operator>=(Islamic const& lhs, Islamic const& rhs) {
+	template <typename Rules>
+	constexpr bool operator>=(basic_islamic<Rules> const& lhs, basic_islamic<Rules> const& rhs) {
 		return lhs.to_jd() >= rhs.to_jd();
 	}
 
 	// Difference operator
-	constexpr jd_t operator-(Islamic const& lhs, Islamic const& rhs) {
+	template <typename Rules>
+	constexpr jd_t operator-(basic_islamic<Rules> const& lhs, basic_islamic<Rules> const& rhs) {
 		return lhs.to_jd() - rhs.to_jd();
 	}
 
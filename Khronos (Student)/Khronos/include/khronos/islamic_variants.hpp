@@ -0,0 +1,479 @@
+#pragma once
+
+/**	@file khronos/islamic_variants.hpp
+	@date 2026-10-18
+
+	Variants of the Islamic calendar.
+
+	The tabular Islamic calendars differ only in which 11 years of each 30
+	are leap, and in whether the epoch is the civil (Friday, 16 July 622
+	Julian) or the astronomical (Thursday, 15 July) one.  Each variant is a
+	rule table for the cyclic calendar engine, selected at compile time:
+
+		islamic_to_jd_for<islamic_habash_rules>(1445, 9, 1)
+
+	compiles to that variant's own tables.  islamic_rules (leap years 2, 5,
+	7, 10, 13, 16, 18, 21, 24, 26, 29; civil epoch) is the one used by the
+	Islamic class.
+
+	Observational calendars such as Umm al-Qura have no cycle; their month
+	lengths come from a published table, bit-packed one 12-bit word per year.
+	islamic_table_calendar<Rules> converts through such a table in O(1) by
+	per-year prefix sums built at compile time, and umm_al_qura is the table
+	of Saudi Arabia for AH 1300-1600.  islamic_month_table does the same for
+	a table built at run time, such as one from observed_islamic_months().
+
+	basic_islamic<Rules> is the date class of any of these rule sets:
+
+		UmmAlQura ramadan(1445, 9, 1);
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/cyclic_calendar.hpp>
+#include <khronos/islamic_calendar.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/timeofday.hpp>
+#include <khronos/week.hpp>
+#include <khronos/instrument.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <iomanip>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace khronos {
+
+	// VALUES
+	constexpr jd_t ISLAMIC_ASTRONOMICAL_EPOCH = ISLAMIC_EPOCH - 1;
+
+
+	// TABULAR VARIANTS
+	/** Leap years 2, 5, 7, 10, 13, 15, 18, 21, 24, 26, 29 (Kushyar ibn Labban, Ulugh Beg). */
+	struct islamic_15_rules : islamic_rules {
+		static constexpr std::array<bool, 30> leap_years = {
+			false, true, false, false, true, false, true, false, false, true,
+			false, false, true, false, true, false, false, true, false, false,
+			true, false, false, true, false, true, false, false, true, false };
+	};
+
+	/** Leap years 2, 5, 8, 11, 13, 16, 19, 21, 24, 27, 30 (Habash al-Hasib, al-Biruni). */
+	struct islamic_habash_rules : islamic_rules {
+		static constexpr std::array<bool, 30> leap_years = {
+			false, true, false, false, true, false, false, true, false, false,
+			true, false, true, false, false, true, false, false, true, false,
+			true, false, false, true, false, false, true, false, false, true };
+	};
+
+	/** Leap years 2, 5, 8, 10, 13, 16, 19, 21, 24, 27, 29 from the astronomical epoch (Fatimid, used by the Bohras). */
+	struct islamic_bohra_rules : islamic_rules {
+		static constexpr jd_t epoch = ISLAMIC_ASTRONOMICAL_EPOCH;
+		static constexpr std::array<bool, 30> leap_years = {
+			false, true, false, false, true, false, false, true, false, true,
+			false, false, true, false, false, true, false, false, true, false,
+			true, false, false, true, false, false, true, false, true, false };
+	};
+
+
+	// MONTH TABLES
+	namespace detail {
+		/** Days from the start of a year of month-length word 'bits' to the start of 0-based month 'm'. */
+		constexpr int islamic_month_start(std::uint16_t bits, int m) {
+			return 29 * m + std::popcount(static_cast<unsigned>(bits & ((1u << m) - 1)));
+		}
+	}
+
+
+	/**	Engine for an Islamic calendar given by a table of month lengths, described by a Rules type:
+
+			static constexpr year_t first_year;							// the year of months[0]
+			static constexpr jd_t epoch;									// midnight starting 1 Muharram of first_year
+			static constexpr std::array<std::uint16_t, N> months;		// one month-length word per year
+
+		Bit m (0 = Muharram) of a year's word is set when that month has 30 days,
+		clear when it has 29.  Years outside the table have no days, so dates in them
+		are invalid; converting them throws std::out_of_range.
+		*/
+	template <typename Rules>
+	struct islamic_table_calendar {
+		using rules = Rules;
+
+		static constexpr int MONTHS = 12;
+		static constexpr year_t FIRST_YEAR = Rules::first_year;
+		static constexpr year_t LAST_YEAR = FIRST_YEAR + static_cast<year_t>(Rules::months.size()) - 1;
+
+		/** Days from the start of the table to the start of each of its years; [size] ends the table. */
+		static constexpr auto YEAR_STARTS = [] {
+			std::array<long long, Rules::months.size() + 1> starts{};
+			for (std::size_t i = 0; i < Rules::months.size(); ++i)
+				starts[i + 1] = starts[i] + detail::islamic_month_start(Rules::months[i], MONTHS);
+			return starts;
+		}();
+		static constexpr long long TABLE_DAYS = YEAR_STARTS.back();
+
+
+		static constexpr bool covers_year(year_t year) {
+			return year >= FIRST_YEAR && year <= LAST_YEAR;
+		}
+
+		static constexpr std::size_t year_index(year_t year) {
+			if (!covers_year(year))
+				throw std::out_of_range("islamic_table_calendar: year outside the table");
+			return static_cast<std::size_t>(year - FIRST_YEAR);
+		}
+
+		static constexpr day_t days_in_month(year_t year, month_t month) {
+			if (month < 1 || month > MONTHS || !covers_year(year))
+				return 0;
+			return 29 + ((Rules::months[year - FIRST_YEAR] >> (month - 1)) & 1);
+		}
+
+		static constexpr int days_in_year(year_t year) {
+			if (!covers_year(year))
+				return 0;
+			return detail::islamic_month_start(Rules::months[year - FIRST_YEAR], MONTHS);
+		}
+
+		static constexpr bool is_leapyear(year_t year) {
+			return days_in_year(year) == 355;
+		}
+
+
+		/** Days from 1 Muharram of FIRST_YEAR to a date. */
+		static constexpr long long to_days(year_t year, month_t month, day_t day) {
+			std::size_t const i = year_index(year);
+			return YEAR_STARTS[i] + detail::islamic_month_start(Rules::months[i], month - 1) + day - 1;
+		}
+
+		/** Date 'days' after 1 Muharram of FIRST_YEAR. */
+		static constexpr void from_days(long long days, year_t& year, month_t& month, day_t& day) {
+			if (days < 0 || days >= TABLE_DAYS)
+				throw std::out_of_range("islamic_table_calendar: date outside the table");
+
+			// lunar years stay within a day or two of the mean year, so the estimate is at most a step out
+			auto i = static_cast<std::size_t>(std::min<long long>(days * 30 / 10'631, static_cast<long long>(Rules::months.size()) - 1));
+			while (days < YEAR_STARTS[i])
+				--i;
+			while (days >= YEAR_STARTS[i + 1])
+				++i;
+
+			auto const dayOfYear = static_cast<int>(days - YEAR_STARTS[i]);
+			std::uint16_t const bits = Rules::months[i];
+			int m = std::min(dayOfYear * 2 / 59, MONTHS - 1);
+			while (dayOfYear < detail::islamic_month_start(bits, m))
+				--m;
+			while (m < MONTHS - 1 && dayOfYear >= detail::islamic_month_start(bits, m + 1))
+				++m;
+
+			year = FIRST_YEAR + static_cast<year_t>(i);
+			month = static_cast<month_t>(m + 1);
+			day = static_cast<day_t>(dayOfYear - detail::islamic_month_start(bits, m) + 1);
+		}
+
+
+		static bool covers(jd_t jd) {
+			long long const days = static_cast<long long>(jd_to_jdn(jd) - (Rules::epoch + 0.5));
+			return days >= 0 && days < TABLE_DAYS;
+		}
+
+		static jd_t to_jd(year_t year, month_t month, day_t day) {
+			return Rules::epoch + static_cast<jd_t>(to_days(year, month, day));
+		}
+
+		static void from_jd(jd_t jd, year_t& year, month_t& month, day_t& day) {
+			from_days(static_cast<long long>(jd_to_jdn(jd) - (Rules::epoch + 0.5)), year, month, day);
+		}
+	};
+
+
+	/**	Umm al-Qura, the calendar of Saudi Arabia, AH 1300-1600 (1882-2174 CE).
+		The month lengths are the published table, as distributed with ICU.
+		*/
+	struct umm_al_qura_rules {
+		static constexpr year_t first_year = 1300;
+		static constexpr jd_t epoch = 2408761.5;		// 1882 November 12
+		static constexpr std::array<std::uint16_t, 301> months = {
+			0x0555, 0x02AB, 0x0937, 0x02B6, 0x0576, 0x036C, 0x0B55, 0x0AAA, 0x0956, 0x049E,		// 1300
+			0x095D, 0x02BA, 0x05B5, 0x03AA, 0x0B4B, 0x0A96, 0x052E, 0x02AD, 0x056D, 0x0B5A,		// 1310
+			0x0752, 0x0F25, 0x0E8A, 0x0D16, 0x0A56, 0x0AB5, 0x06B4, 0x0DA9, 0x0B92, 0x0B25,		// 1320
+			0x064B, 0x0A9B, 0x035A, 0x06D9, 0x05D4, 0x0DA5, 0x0D4A, 0x0A95, 0x0536, 0x0975,		// 1330
+			0x02F4, 0x06E9, 0x06D4, 0x06A9, 0x0535, 0x025D, 0x04BD, 0x09BA, 0x03B4, 0x0B69,		// 1340
+			0x0B2A, 0x0A55, 0x04AD, 0x0A5D, 0x02DA, 0x06D9, 0x0EAA, 0x0E94, 0x0D2A, 0x0C56,		// 1350
+			0x04AE, 0x0A6D, 0x056A, 0x0D55, 0x0D4A, 0x0A93, 0x052B, 0x0A5B, 0x053A, 0x06B5,		// 1360
+			0x0EA9, 0x0D52, 0x0D29, 0x0A55, 0x04AD, 0x056D, 0x0AEA, 0x06E4, 0x0ED1, 0x0DA2,		// 1370
+			0x0AAA, 0x095A, 0x02DA, 0x05B9, 0x0BB2, 0x0764, 0x06C9, 0x0555, 0x02AB, 0x04DB,		// 1380
+			0x0ABA, 0x05B4, 0x0DA9, 0x0D52, 0x0AA5, 0x092D, 0x026D, 0x08ED, 0x02DA, 0x0AD5,		// 1390
+			0x0AA5, 0x0A4B, 0x0497, 0x0937, 0x02B6, 0x0975, 0x0D69, 0x0D52, 0x0C95, 0x092B,		// 1400
+			0x025B, 0x04DB, 0x09D5, 0x05D2, 0x0DA5, 0x0D4A, 0x0A95, 0x054D, 0x0AAD, 0x03AA,		// 1410
+			0x0BD2, 0x0BC4, 0x0B89, 0x0A95, 0x052D, 0x05AD, 0x0B6A, 0x06D4, 0x0DC9, 0x0D92,		// 1420
+			0x0AA6, 0x0956, 0x02AE, 0x056D, 0x036A, 0x0B55, 0x0AAA, 0x094D, 0x049D, 0x095D,		// 1430
+			0x02BA, 0x05B5, 0x05AA, 0x0D55, 0x0A9A, 0x092E, 0x026E, 0x055D, 0x0ADA, 0x06D4,		// 1440
+			0x06A5, 0x0B27, 0x0A4D, 0x04AD, 0x056D, 0x0B5A, 0x0754, 0x0F49, 0x0E92, 0x0D26,		// 1450
+			0x0A56, 0x0356, 0x06B5, 0x0BAA, 0x0B92, 0x0B25, 0x068B, 0x0A9B, 0x055A, 0x0ADA,		// 1460
+			0x05B4, 0x0DA9, 0x0B52, 0x0A9A, 0x0536, 0x0276, 0x0575, 0x0AF2, 0x06D4, 0x06A9,		// 1470
+			0x0555, 0x02AD, 0x04BD, 0x09BA, 0x0574, 0x0B69, 0x0B52, 0x0A95, 0x052D, 0x0A5D,		// 1480
+			0x04DA, 0x0AD9, 0x06B2, 0x0E95, 0x0E2A, 0x0C96, 0x092E, 0x0AAD, 0x056A, 0x0D65,		// 1490
+			0x0D4A, 0x0D15, 0x062B, 0x0C5B, 0x053A, 0x06B5, 0x0DB2, 0x0D64, 0x0D29, 0x0A55,		// 1500
+			0x04AD, 0x096D, 0x0AEA, 0x06E8, 0x0ED1, 0x0DA4, 0x0D4A, 0x0A6A, 0x02DA, 0x05B9,		// 1510
+			0x0B72, 0x0B68, 0x06D1, 0x0655, 0x04AB, 0x095B, 0x02BA, 0x05B5, 0x0DA9, 0x0D52,		// 1520
+			0x0CA6, 0x094E, 0x046E, 0x095D, 0x04DA, 0x0AD5, 0x0AAA, 0x0A4D, 0x049B, 0x0937,		// 1530
+			0x04B6, 0x0975, 0x0D6A, 0x0D52, 0x0AA5, 0x094B, 0x02AB, 0x055B, 0x0AD9, 0x05D2,		// 1540
+			0x0DC5, 0x0D92, 0x0B25, 0x0555, 0x0AB5, 0x05B4, 0x0BA9, 0x07A2, 0x0745, 0x0593,		// 1550
+			0x0AAB, 0x04D6, 0x09D6, 0x05D2, 0x0BA5, 0x0B4A, 0x0A95, 0x04AD, 0x015D, 0x02DD,		// 1560
+			0x09DA, 0x05B4, 0x05A9, 0x052D, 0x025B, 0x08B7, 0x0176, 0x056D, 0x0B6A, 0x0ACA,		// 1570
+			0x0A96, 0x052B, 0x015B, 0x02BB, 0x05B6, 0x0DAA, 0x0B94, 0x0D46, 0x0A8D, 0x052D,		// 1580
+			0x0A9D, 0x055A, 0x0755, 0x0749, 0x0F13, 0x0E4A, 0x0A96, 0x0556, 0x06B5, 0x0BAA,		// 1590
+			0x0B94 };		// 1600
+	};
+	using umm_al_qura = islamic_table_calendar<umm_al_qura_rules>;
+
+
+
+	// RULE SETS
+	namespace detail {
+		/** The engine of an Islamic rule set: a cycle of leap years, or a table of month lengths. */
+		template <typename Rules>
+		struct islamic_engine {
+			using type = cyclic_calendar<Rules>;
+		};
+
+		template <typename Rules>
+			requires requires { Rules::months; }
+		struct islamic_engine<Rules> {
+			using type = islamic_table_calendar<Rules>;
+		};
+
+		template <typename Rules>
+		using islamic_engine_t = typename islamic_engine<Rules>::type;
+	}
+
+
+	/** Leap (355-day) year test of an Islamic rule set. */
+	template <typename Rules>
+	constexpr bool is_islamic_leapyear_for(year_t year) {
+		return detail::islamic_engine_t<Rules>::is_leapyear(year);
+	}
+
+	/** Convert a date of an Islamic rule set to Julian Day Number. */
+	template <typename Rules>
+	jd_t islamic_to_jd_for(year_t year, month_t month, day_t day) {
+		return detail::islamic_engine_t<Rules>::to_jd(year, month, day);
+	}
+
+	/** Convert Julian Day Number to a date of an Islamic rule set. */
+	template <typename Rules>
+	void jd_to_islamic_for(jd_t jd, year_t& year, month_t& month, day_t& day) {
+		detail::islamic_engine_t<Rules>::from_jd(jd, year, month, day);
+	}
+
+
+
+	/**	Islamic calendar from a table of month lengths built at run time.
+		The words are those of islamic_table_calendar.
+		*/
+	class islamic_month_table {
+		year_t						firstYear_;
+		long long					firstDay_;		// JDN of 1 Muharram of firstYear_
+		std::vector<std::uint16_t>	months_;
+		std::vector<long long>		yearStarts_;	// days from firstDay_ to each year; [size] ends the table
+
+		std::size_t year_index(year_t year) const;
+
+	public:
+		/**	@param firstYear [in] the year of months[0].
+			@param firstDay [in] JD of midnight starting 1 Muharram of firstYear.
+			@param months [in] one month-length word per year.
+			*/
+		islamic_month_table(year_t firstYear, jd_t firstDay, std::span<std::uint16_t const> months);
+
+		year_t first_year() const { return firstYear_; }
+		year_t last_year() const { return firstYear_ + static_cast<year_t>(months_.size()) - 1; }
+		bool covers_year(year_t year) const { return year >= firstYear_ && year <= last_year(); }
+		bool covers(jd_t jd) const;
+
+		/** Month and year lengths; 0 for years outside the table. */
+		day_t days_in_month(year_t year, month_t month) const;
+		int days_in_year(year_t year) const;
+
+		jd_t to_jd(year_t year, month_t month, day_t day) const;
+		void from_jd(jd_t jd, year_t& year, month_t& month, day_t& day) const;
+
+		/** Month-length word of a tabular variant's year, for building and checking tables. */
+		template <typename Rules>
+		static std::uint16_t tabular_months(year_t year) {
+			std::uint16_t bits = 0;
+			for (month_t m = 1; m <= 12; ++m)
+				bits |= static_cast<std::uint16_t>(cyclic_calendar<Rules>::days_in_month(year, m) == 30) << (m - 1);
+			return bits;
+		}
+	};
+
+
+
+
+	// CLASSES
+	/** Every Islamic rule set is a calendar for the generic algorithms. */
+	template <typename Rules>
+	struct calendar_traits<basic_islamic<Rules>> {
+		using engine = detail::islamic_engine_t<Rules>;
+		static jd_t to_jd(year_t y, month_t m, day_t d) { return engine::to_jd(y, m, d); }
+		static void from_jd(jd_t jd, year_t& y, month_t& m, day_t& d) { engine::from_jd(jd, y, m, d); }
+		static month_t months_in_year(year_t) { return 12; }
+		static day_t days_in_month(year_t y, month_t m) { return engine::days_in_month(y, m); }
+		static int month_ordinal(year_t, month_t m) { return m - 1; }
+		static month_t month_at(year_t, int ordinal) { return ordinal + 1; }
+		static long long months_before(year_t y) { return 12 * y; }
+		static year_t year_of_month(long long index) { return utility::floor_div(index, 12); }
+	};
+
+	/** Umm al-Qura date class; dates outside AH 1300-1600 are invalid and converting them throws std::out_of_range. */
+	using UmmAlQura = basic_islamic<umm_al_qura_rules>;
+
+
+	namespace detail {
+		/** Julian Day of the local time now, or of its midnight for NOTIMEOFDAY; defined in islamic.cpp. */
+		jd_t local_jd_now(now_t now);
+	}
+
+	template <typename Rules>
+	void basic_islamic<Rules>::from_jd(jd_t jd) {
+		KHRONOS_PROBE(Islamic_from_jd);
+		detail::islamic_engine_t<Rules>::from_jd(jd, year_, month_, day_);
+		ns_to_hms(jd_to_ns(jd), hour_, minute_, second_);
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules>::basic_islamic() {
+		from_jd(detail::local_jd_now(WTIMEOFDAY));
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules>::basic_islamic(now_t now) {
+		from_jd(detail::local_jd_now(now));
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules>::basic_islamic(jd_t jd) {
+		from_jd(jd);
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules>::basic_islamic(year_t year, month_t month, day_t day)
+		: year_(year), month_(month), day_(day), hour_(0), minute_(0), second_(0) {
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules>::basic_islamic(year_t year, month_t month, day_t day,
+		hour_t hour, minute_t minute, second_t second)
+		: year_(year), month_(month), day_(day),
+		hour_(hour), minute_(minute), second_(second) {
+	}
+
+	template <typename Rules>
+	jd_t basic_islamic<Rules>::to_jd() const {
+		KHRONOS_PROBE(Islamic_to_jd);
+		return detail::islamic_engine_t<Rules>::to_jd(year_, month_, day_) + tod(hour_, minute_, second_);
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules>& basic_islamic<Rules>::operator=(jd_t jd) {
+		from_jd(jd);
+		return *this;
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules>& basic_islamic<Rules>::operator+=(detail::packaged_year_real const& year) {
+		KHRONOS_PROBE(Islamic_add_years);
+		long long whole_years = static_cast<long long>(year.value);
+		year_ += whole_years;
+
+		day_ = std::min(day_, detail::islamic_engine_t<Rules>::days_in_month(year_, month_));
+
+		double fractional_years = year.value - whole_years;
+		if (fractional_years != 0.0) {
+			jd_t jd = to_jd() + fractional_years * EARTH_ORBITAL_PERIOD_DAYS;
+			from_jd(jd);
+		}
+
+		return *this;
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules>& basic_islamic<Rules>::operator+=(detail::packaged_month_integer const& month) {
+		KHRONOS_PROBE(Islamic_add_months);
+		long long total_months = month_ - 1 + month.value;
+
+		year_ += utility::floor_div(total_months, 12);
+		month_ = static_cast<month_t>(utility::floor_mod(total_months, 12) + 1);
+
+		day_ = std::min(day_, detail::islamic_engine_t<Rules>::days_in_month(year_, month_));
+
+		return *this;
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules> basic_islamic<Rules>::operator+(detail::packaged_year_real const& year) const {
+		basic_islamic result(*this);
+		result += year;
+		return result;
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules> basic_islamic<Rules>::operator+(detail::packaged_month_integer const& month) const {
+		basic_islamic result(*this);
+		result += month;
+		return result;
+	}
+
+	template <typename Rules>
+	basic_islamic<Rules> basic_islamic<Rules>::operator-(detail::packaged_month_integer const& month) const {
+		return *this + detail::packaged_month_integer(-month.value);
+	}
+
+	// Calendar positions
+	template <typename Rules>
+	day_t basic_islamic<Rules>::day_of_week() const {
+		return khronos::day_of_week<basic_islamic>(year_, month_, day_);
+	}
+
+	template <typename Rules>
+	day_t basic_islamic<Rules>::day_of_year() const {
+		return khronos::day_of_year<basic_islamic>(year_, month_, day_);
+	}
+
+	template <typename Rules>
+	int basic_islamic<Rules>::week_of_year() const {
+		return khronos::week_of_year<basic_islamic>(year_, month_, day_);
+	}
+
+	template <typename Rules>
+	std::string basic_islamic<Rules>::to_string() const {
+		KHRONOS_PROBE(Islamic_to_string);
+		std::ostringstream oss;
+
+		int dow = day_of_week();
+
+		oss << civil::day_name(dow) << ", ";
+		oss << islamic_month_name(month_) << " ";
+		oss << static_cast<int>(day_) << " ";
+		oss << year_ << " A.H.";
+
+		oss << ", ";
+		int display_hour = hour_ % 12;
+		if (display_hour == 0) display_hour = 12;
+
+		oss << display_hour << ":"
+			<< std::setfill('0') << std::setw(2) << minute_ << ":"
+			<< std::setw(2) << std::setfill('0') << std::fixed << std::setprecision(0) << second_
+			<< (hour_ < 12 ? " am" : " pm");
+
+		return oss.str();
+	}
+
+} // end-of-namespace khronos
@@ -90,6 +90,11 @@ namespace khronos {
 		operator jd_t() const { return to_jd(); }
 		std::string to_string() const;
 
+		// Calendar positions
+		day_t day_of_week() const;		// [0..6], 0 = Monday
+		day_t day_of_year() const;
+		int week_of_year() const;
+
 		// Assignment
 		Julian& operator=(jd_t jd);
 
@@ -36,6 +36,7 @@ the program(s) have been supplied.
 #include <compare>
 
 #include <khronos/def.hpp>
+#include <khronos/instrument.hpp>
 #include <khronos/timeofday.hpp>
 #include <khronos/utility.hpp>
 
@@ -43,6 +44,40 @@ namespace khronos {
 
 	using jd_t = double;
 
+	/** Julian Day Number (the noon-based whole day) containing the Julian Day 'jd'. */
+	inline jd_t jd_to_jdn(jd_t jd) { return std::floor(jd + 0.5); }
+
+	/** Time-of-day [0..1) of the Julian Day 'jd', from midnight. */
+	inline tod_t jd_to_tod(jd_t jd) {
+		jd_t const x = jd + 0.5;
+		return x - std::floor(x);
+	}
+
+	/**	Nanosecond of the day of the Julian Day 'jd', from midnight.
+		A JD near the present resolves only about 40 microseconds, so a time within one ulp
+		of a whole second is taken as that second: times encoded in whole seconds decode to them.
+		*/
+	inline long long jd_to_ns(jd_t jd) {
+		jd_t const magnitude = std::abs(jd) + 0.5;
+		jd_t const ulp = std::nextafter(magnitude, HUGE_VAL) - magnitude;
+		return snap_to_second(tod_to_ns(jd_to_tod(jd)), static_cast<long long>(std::ceil(ulp * NANOSECONDS_PER_DAY)));
+	}
+
+	/** Ticks (microseconds) per day. */
+	constexpr tick_t TICKS_PER_DAY = 86'400'000'000;
+
+	/** Ticks nearest the Julian Day 'jd'.  The whole days are converted exactly. */
+	inline tick_t jd_to_ticks(jd_t jd) {
+		jd_t const day = std::floor(jd);
+		return static_cast<tick_t>(day) * TICKS_PER_DAY + std::llround((jd - day) * TICKS_PER_DAY);
+	}
+
+	/** Julian Day of 'ticks'; round trips jd_to_ticks() for JDs of the historical era. */
+	inline jd_t ticks_to_jd(tick_t ticks) {
+		return static_cast<jd_t>(utility::floor_div(ticks, TICKS_PER_DAY))
+			+ static_cast<jd_t>(utility::floor_mod(ticks, TICKS_PER_DAY)) / TICKS_PER_DAY;
+	}
+
 	// Helper types for arithmetic operations
 	namespace detail {
 		struct packaged_year_real {
@@ -156,113 +191,137 @@ namespace khronos {
 
 		// Arithmetic operations with time units
 		Jd& operator+=(detail::packaged_second const& sec) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ += sec.value / SECONDS_PER_DAY;
 			return *this;
 		}
 
 		Jd& operator+=(detail::packaged_minute const& min) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ += min.value / (24.0 * 60.0);
 			return *this;
 		}
 
 		Jd& operator+=(detail::packaged_hour const& hr) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ += hr.value / 24.0;
 			return *this;
 		}
 
 		Jd& operator+=(detail::packaged_day const& d) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ += d.value;
 			return *this;
 		}
 
 		Jd& operator+=(detail::packaged_week const& w) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ += w.value * 7.0;
 			return *this;
 		}
 
 		Jd& operator+=(detail::packaged_year_real const& y) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ += y.value * EARTH_ORBITAL_PERIOD_DAYS;
 			return *this;
 		}
 
 		// Subtraction operators
 		Jd& operator-=(detail::packaged_second const& sec) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ -= sec.value / SECONDS_PER_DAY;
 			return *this;
 		}
 
 		Jd& operator-=(detail::packaged_minute const& min) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ -= min.value / (24.0 * 60.0);
 			return *this;
 		}
 
 		Jd& operator-=(detail::packaged_hour const& hr) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ -= hr.value / 24.0;
 			return *this;
 		}
 
 		Jd& operator-=(detail::packaged_day const& d) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ -= d.value;
 			return *this;
 		}
 
 		Jd& operator-=(detail::packaged_week const& w) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ -= w.value * 7.0;
 			return *this;
 		}
 
 		Jd& operator-=(detail::packaged_year_real const& y) {
+			KHRONOS_PROBE(Jd_arithmetic);
 			jd_ -= y.value * EARTH_ORBITAL_PERIOD_DAYS;
 			return *this;
 		}
 
 		// Addition operators returning new Jd
 		Jd operator+(detail::packaged_second const& sec) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ + sec.value / SECONDS_PER_DAY);
 		}
 
 		Jd operator+(detail::packaged_minute const& min) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ + min.value / (24.0 * 60.0));
 		}
 
 		Jd operator+(detail::packaged_hour const& hr) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ + hr.value / 24.0);
 		}
 
 		Jd operator+(detail::packaged_day const& d) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ + d.value);
 		}
 
 		Jd operator+(detail::packaged_week const& w) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ + w.value * 7.0);
 		}
 
 		Jd operator+(detail::packaged_year_real const& y) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ + y.value * EARTH_ORBITAL_PERIOD_DAYS);
 		}
 
 		// Subtraction operators returning new Jd
 		Jd operator-(detail::packaged_second const& sec) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ - sec.value / SECONDS_PER_DAY);
 		}
 
 		Jd operator-(detail::packaged_minute const& min) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ - min.value / (24.0 * 60.0));
 		}
 
 		Jd operator-(detail::packaged_hour const& hr) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ - hr.value / 24.0);
 		}
 
 		Jd operator-(detail::packaged_day const& d) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ - d.value);
 		}
 
 		Jd operator-(detail::packaged_week const& w) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ - w.value * 7.0);
 		}
 
 		Jd operator-(detail::packaged_year_real const& y) const {
+			KHRONOS_PROBE(Jd_arithmetic);
 			return Jd(jd_ - y.value * EARTH_ORBITAL_PERIOD_DAYS);
 		}
 	};
@@ -0,0 +1,73 @@
+#pragma once
+
+/**	@file khronos/packed_date.hpp
+	@date 2026-10-18
+
+	Order-preserving 64-bit packed calendar dates.
+
+	Layout (most significant first):
+		38 bits		year + PACKED_YEAR_BIAS
+		 4 bits		month ordinal (position of the month in the calendar year)
+		 5 bits		day of month
+		17 bits		second of the day [0..86399]
+
+	Packed dates of the same calendar compare (as unsigned integers) in
+	chronological order, so packed columns can be radix sorted directly.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/calendar_traits.hpp>
+
+#include <cmath>
+#include <cstdint>
+
+
+namespace khronos {
+
+	using packed_date_t = std::uint64_t;
+
+	// VALUES
+	constexpr year_t PACKED_YEAR_BIAS = year_t(1) << 37;
+
+
+	/** Pack a calendar date and time into an order-preserving 64-bit key. */
+	template <typename Calendar>
+	packed_date_t pack_date(year_t year, month_t month, day_t day, hour_t hour = 0, minute_t minute = 0, second_t second = 0) {
+		auto const ordinal = static_cast<std::uint64_t>(calendar_traits<Calendar>::month_ordinal(year, month));
+		auto const sod = static_cast<std::uint64_t>(hour * 3600 + minute * 60 + static_cast<int>(std::floor(second)));
+		return (static_cast<std::uint64_t>(year + PACKED_YEAR_BIAS) << 26)
+			| (ordinal << 22)
+			| (static_cast<std::uint64_t>(day) << 17)
+			| sod;
+	}
+
+
+	/** Pack a calendar date object. */
+	template <calendar_date Calendar>
+	packed_date_t pack_date(Calendar const& date) {
+		return pack_date<Calendar>(date.year(), date.month(), date.day(), date.hour(), date.minute(), date.second());
+	}
+
+
+	/** Unpack a key produced by pack_date<Calendar>(). */
+	template <typename Calendar>
+	void unpack_date(packed_date_t packed, year_t& year, month_t& month, day_t& day, hour_t& hour, minute_t& minute, second_t& second) {
+		year = static_cast<year_t>(packed >> 26) - PACKED_YEAR_BIAS;
+		month = calendar_traits<Calendar>::month_at(year, static_cast<int>((packed >> 22) & 0xF));
+		day = static_cast<day_t>((packed >> 17) & 0x1F);
+		auto const sod = static_cast<int>(packed & 0x1FFFF);
+		hour = sod / 3600;
+		minute = sod / 60 % 60;
+		second = sod % 60;
+	}
+
+
+	/** Unpack a key produced by pack_date<Calendar>() into a calendar object. */
+	template <calendar_date Calendar>
+	Calendar unpack_date(packed_date_t packed) {
+		year_t y; month_t m; day_t d; hour_t h; minute_t mi; second_t s;
+		unpack_date<Calendar>(packed, y, m, d, h, mi, s);
+		return Calendar(y, m, d, h, mi, s);
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,61 @@
+#pragma once
+
+/**	@file khronos/parallel.hpp
+	@date 2026-10-18
+
+	Khronos library multi-threading support for column algorithms.
+	*/
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+
+namespace khronos {
+
+	/** Requests the multi-threaded variant of an algorithm.  'threads' == 0 uses every hardware thread. */
+	struct parallel_policy {
+		unsigned threads = 0;
+	};
+	inline constexpr parallel_policy par{};
+
+
+	namespace detail {
+		/** Elements below which a thread is not worth starting. */
+		constexpr std::size_t PARALLEL_GRAIN = 65'536;
+
+		/** Number of threads to use for 'n' elements under 'policy' (at least 1). */
+		unsigned thread_count(parallel_policy policy, std::size_t n, std::size_t grain = PARALLEL_GRAIN);
+
+		/**	Run fn(chunk, first, last) for 'chunks' contiguous slices of [0, n).
+			Chunk 0 runs on the calling thread.  Every chunk runs to completion; then
+			the exception of the lowest-numbered chunk that threw, if any, is rethrown. */
+		template <typename Fn>
+		void parallel_chunks(std::size_t n, unsigned chunks, Fn fn) {
+			if (chunks <= 1) {
+				fn(0u, std::size_t(0), n);
+				return;
+			}
+			std::vector<std::exception_ptr> errors(chunks);
+			auto run = [&](unsigned c) {
+				try {
+					fn(c, n * c / chunks, n * (c + 1) / chunks);
+				}
+				catch (...) {
+					errors[c] = std::current_exception();
+				}
+			};
+			{
+				std::vector<std::jthread> workers;
+				for (unsigned c = 1; c < chunks; ++c)
+					workers.emplace_back(run, c);
+				run(0u);
+			}	// joins the workers
+			for (auto const& error : errors)
+				if (error)
+					std::rethrow_exception(error);
+		}
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,123 @@
+#pragma once
+
+/**	@file khronos/period.hpp
+	@date 2026-10-18
+
+	Calendar-aware differences between two dates: whole years, months, days
+	and the remaining time of day.
+
+	period_between(a, b) counts the whole months M for which a + M months
+	(operator+=, with the day clamped to the length of the month) is not
+	after b, then the days and seconds from there to b.  The months are
+	split into whole years, where a year step keeps the month number and
+	clamps the day, as operator+= for years does (Feb 29 + 1 year is Feb 28;
+	Hebrew Adar II becomes Adar in a common year).  Everything is computed
+	in O(1) from absolute month indices and Julian Day Numbers.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/calendar_traits.hpp>
+#include <khronos/timeofday.hpp>
+#include <khronos/week.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+
+
+namespace khronos {
+
+	/** Years, months, days and seconds between two dates.  All fields are <= 0 when the end precedes the start. */
+	struct date_period {
+		long long	years;
+		int			months;
+		long long	days;
+		second_t	seconds;
+	};
+
+	constexpr bool operator==(date_period const& lhs, date_period const& rhs) {
+		return lhs.years == rhs.years && lhs.months == rhs.months && lhs.days == rhs.days && lhs.seconds == rhs.seconds;
+	}
+
+
+	namespace detail {
+		/** Absolute index of a month (see calendar_traits). */
+		template <typename Calendar>
+		long long month_index(year_t year, month_t month) {
+			using traits = calendar_traits<Calendar>;
+			return traits::months_before(year) + traits::month_ordinal(year, month);
+		}
+
+		/** JDN of 'day' in the month at 'index', clamped to the month's length. */
+		template <typename Calendar>
+		long long clamped_jdn(long long index, day_t day) {
+			using traits = calendar_traits<Calendar>;
+			year_t const year = traits::year_of_month(index);
+			month_t const month = traits::month_at(year, static_cast<int>(index - traits::months_before(year)));
+			return date_jdn<Calendar>(year, month, std::min(day, traits::days_in_month(year, month)));
+		}
+
+		template <typename Calendar>
+		second_t second_of_day(Calendar const& date) {
+			return date.hour() * 3600.0 + date.minute() * 60.0 + date.second();
+		}
+	}
+
+
+	/** Period from 'from' to 'to' in the calendar of the dates. */
+	template <typename Calendar>
+	date_period period_between(Calendar const& from, Calendar const& to) {
+		using traits = calendar_traits<Calendar>;
+		second_t const fromSecond = detail::second_of_day(from), toSecond = detail::second_of_day(to);
+		long long const toDay = date_jdn<Calendar>(to.year(), to.month(), to.day());
+		long long const fromDay = date_jdn<Calendar>(from.year(), from.month(), from.day());
+		if (toDay < fromDay || (toDay == fromDay && toSecond < fromSecond)) {
+			date_period p = period_between(to, from);
+			return { -p.years, -p.months, -p.days, -p.seconds };
+		}
+
+		// whole months: the month of 'to', unless the anchor in it is still ahead
+		long long const fromIndex = detail::month_index<Calendar>(from.year(), from.month());
+		long long months = detail::month_index<Calendar>(to.year(), to.month()) - fromIndex;
+		long long anchor = detail::clamped_jdn<Calendar>(fromIndex + months, from.day());
+		if (anchor > toDay || (anchor == toDay && fromSecond > toSecond))
+			anchor = detail::clamped_jdn<Calendar>(fromIndex + --months, from.day());
+
+		// whole years: the year of 'to', unless the anniversary in it is still ahead
+		year_t years = to.year() - from.year();
+		auto anniversary = [&](year_t y) {
+			month_t const month = std::min<month_t>(from.month(), traits::months_in_year(y));
+			return detail::month_index<Calendar>(y, month);
+		};
+		long long yearIndex = anniversary(from.year() + years);
+		long long const yearDay = detail::clamped_jdn<Calendar>(yearIndex, from.day());
+		if (yearDay > toDay || (yearDay == toDay && fromSecond > toSecond))
+			yearIndex = anniversary(from.year() + --years);
+
+		long long days = toDay - anchor;
+		second_t seconds = toSecond - fromSecond;
+		if (seconds < 0) {
+			seconds += SECONDS_PER_DAY;
+			--days;
+		}
+		return { years, static_cast<int>(months - (yearIndex - fromIndex)), days, seconds };
+	}
+
+
+	/** Period between two JDs in the calendar. */
+	template <typename Calendar>
+	date_period period_between(jd_t from, jd_t to) {
+		return period_between(Calendar(from), Calendar(to));
+	}
+
+
+	/** Periods between two JD columns, row by row. */
+	template <typename Calendar>
+	void period_between(std::span<jd_t const> from, std::span<jd_t const> to, std::span<date_period> out) {
+		assert(to.size() >= from.size() && out.size() >= from.size());
+		for (std::size_t i = 0; i < from.size(); ++i)
+			out[i] = period_between(Calendar(from[i]), Calendar(to[i]));
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,71 @@
+#pragma once
+
+/**	@file khronos/persian_calendar.hpp
+	@date 2026-10-18
+
+	Arithmetic Persian (Solar Hijri) calendar.
+
+	The first six months have 31 days, the next five 30 and Esfand 29, 30
+	in a leap year.  Leap years follow Birashk's 2820-year cycle of 683 leap
+	years: year y is leap when mod((mod(y - 474, 2820) + 474 + 38) * 682, 2816)
+	< 682.  The cycle is rotated to start at year 1 and the calendar is
+	defined on the cyclic calendar engine.  The official calendar of Iran is
+	astronomical and differs from this one in a few years of each century.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/cyclic_calendar.hpp>
+#include <khronos/utility.hpp>
+
+#include <array>
+
+
+namespace khronos {
+
+	// VALUES
+	constexpr jd_t PERSIAN_EPOCH = 1'948'320.5;		// 1 Farvardin 1 A.P. = 19 March 622 (Julian)
+
+
+	struct persian_rules {
+		static constexpr jd_t epoch = PERSIAN_EPOCH;
+		static constexpr std::array<bool, 2820> leap_years = [] {
+			std::array<bool, 2820> leap{};
+			for (year_t y = 1; y <= 2820; ++y)
+				leap[y - 1] = (utility::floor_mod(y - 474, 2820) + 474 + 38) * 682 % 2816 < 682;
+			return leap;
+		}();
+		static constexpr std::array<day_t, 12> month_days = { 31, 31, 31, 31, 31, 31, 30, 30, 30, 30, 30, 29 };
+		static constexpr month_t leap_month = 12;
+	};
+	using persian_calendar = cyclic_calendar<persian_rules>;
+
+
+	// OPERATIONS
+	/** Leap year test for the arithmetic Persian calendar. */
+	constexpr bool is_persian_leapyear(year_t year) {
+		return persian_calendar::is_leapyear(year);
+	}
+
+	/** Provide the name of the given month in the Persian calendar. */
+	constexpr char const* persian_month_name(month_t month) {
+		constexpr char const* const names[13] = {
+			"",
+			"Farvardin", "Ordibehesht", "Khordad", "Tir", "Mordad", "Shahrivar",
+			"Mehr", "Aban", "Azar", "Dey", "Bahman", "Esfand"
+		};
+		return names[month];
+	}
+
+
+	// FUNCTIONS
+	/** Convert Persian date to Julian Day Number. */
+	inline jd_t persian_to_jd(year_t year, month_t month, day_t day) {
+		return persian_calendar::to_jd(year, month, day);
+	}
+
+	/** Convert Julian Day Number to Persian date. */
+	inline void jd_to_persian(jd_t jd, year_t& year, month_t& month, day_t& day) {
+		persian_calendar::from_jd(jd, year, month, day);
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,162 @@
+#pragma once
+
+/**	@file khronos/rollup.hpp
+	@date 2026-10-18
+
+	Calendar-aware time bucketing and rollup aggregation.
+
+	The bucket boundaries of the query range are generated once with the
+	calendar's *_to_jd conversion; points are then assigned to buckets with a
+	branchless binary search over the boundaries, so no per-point calendar
+	conversion is made.  Aggregation runs over structure-of-arrays value
+	columns in a single pass through the points.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/calendar_traits.hpp>
+#include <khronos/parallel.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+
+namespace khronos {
+
+	/**	Boundaries of the consecutive calendar periods covering [first, last].
+		@return edges, where period i is [edges[i], edges[i+1]).
+		*/
+	template <typename Calendar>
+	std::vector<jd_t> period_edges(jd_t first, jd_t last, period p) {
+		using traits = calendar_traits<Calendar>;
+
+		jd_t begin, end;
+		period_bounds<Calendar>(first, p, begin, end);
+		std::vector<jd_t> edges{ begin, end };
+
+		if (p == period::day || p == period::week) {
+			jd_t const step = end - begin;
+			while (edges.back() <= last)
+				edges.push_back(edges.back() + step);
+			return edges;
+		}
+
+		// step through (year, month ordinal) space, one *_to_jd per boundary
+		year_t y; month_t m; day_t d;
+		traits::from_jd(first, y, m, d);
+		int ordinal = traits::month_ordinal(y, m);
+		if (p == period::quarter)
+			ordinal = std::min(ordinal / 3, 3) * 3;
+		else if (p == period::year)
+			ordinal = 0;
+
+		auto advance = [&] {
+			switch (p) {
+			case period::month:
+				if (++ordinal == traits::months_in_year(y)) { ++y; ordinal = 0; }
+				break;
+			case period::quarter:
+				if ((ordinal += 3) >= 12) { ++y; ordinal = 0; }
+				break;
+			default:
+				++y;
+				ordinal = 0;
+			}
+		};
+
+		advance();	// (y, ordinal) now starts at 'end'
+		while (edges.back() <= last) {
+			advance();
+			edges.push_back(traits::to_jd(y, traits::month_at(y, ordinal), 1));
+		}
+		return edges;
+	}
+
+
+	/**	Branchless search of the period containing 'jd'.
+		@return i such that edges[i] <= jd < edges[i+1], or -1 if 'jd' is outside the edges.
+		*/
+	inline std::ptrdiff_t locate_period(std::span<jd_t const> edges, jd_t jd) {
+		jd_t const* base = edges.data();
+		std::size_t n = edges.size();
+		while (n > 1) {
+			std::size_t const half = n / 2;
+			base = base[half] <= jd ? base + half : base;
+			n -= half;
+		}
+		return (jd >= edges.front() && jd < edges.back()) ? base - edges.data() : -1;
+	}
+
+
+	/** Assign each JD of 'jds' to its period index in 'out' (-1 when outside 'edges'). */
+	void assign_periods(std::span<jd_t const> edges, std::span<jd_t const> jds, std::span<std::int32_t> out);
+
+
+
+	/** Aggregates of value columns per period. */
+	struct rollup_table {
+		struct column {
+			std::vector<double> sum;
+			std::vector<double> min;
+			std::vector<double> max;
+		};
+
+		std::vector<jd_t> edges;				// period i is [edges[i], edges[i+1])
+		std::vector<std::uint64_t> counts;		// points per period
+		std::vector<column> columns;			// one per input value column
+
+		std::size_t size() const { return counts.size(); }
+		jd_t begin(std::size_t period) const { return edges[period]; }
+		jd_t end(std::size_t period) const { return edges[period + 1]; }
+
+		/** Mean of a column in a period (NaN for an empty period). */
+		double mean(std::size_t column, std::size_t period) const {
+			return counts[period]
+				? columns[column].sum[period] / static_cast<double>(counts[period])
+				: std::numeric_limits<double>::quiet_NaN();
+		}
+	};
+
+
+	/**	Aggregate value columns over the given period edges.
+		@param edges [in] ascending period boundaries (see period_edges()).
+		@param jds [in] the time of each point.
+		@param columns [in] value columns, each the same length as 'jds'.
+		@param policy [in] threads to use; inputs below detail::PARALLEL_GRAIN run serially.
+		*/
+	rollup_table rollup(std::vector<jd_t> edges, std::span<jd_t const> jds,
+		std::span<std::span<double const> const> columns, parallel_policy policy = {});
+
+
+	/** Aggregate value columns by the periods of 'Calendar' covering [first, last]. */
+	template <typename Calendar>
+	rollup_table rollup(std::span<jd_t const> jds, std::span<std::span<double const> const> columns,
+		period p, jd_t first, jd_t last, parallel_policy policy = {}) {
+		return rollup(period_edges<Calendar>(first, last, p), jds, columns, policy);
+	}
+
+
+	/** Aggregate value columns by the periods of 'Calendar' covering every point. */
+	template <typename Calendar>
+	rollup_table rollup(std::span<jd_t const> jds, std::span<std::span<double const> const> columns,
+		period p, parallel_policy policy = {}) {
+		if (jds.empty())
+			return rollup({}, jds, columns, policy);
+		auto const [lo, hi] = std::minmax_element(jds.begin(), jds.end());
+		return rollup<Calendar>(jds, columns, p, *lo, *hi, policy);
+	}
+
+
+	/** Aggregate a single value column by the periods of 'Calendar' covering every point. */
+	template <typename Calendar>
+	rollup_table rollup(std::span<jd_t const> jds, std::span<double const> values,
+		period p, parallel_policy policy = {}) {
+		std::span<double const> const columns[] = { values };
+		return rollup<Calendar>(jds, columns, p, policy);
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,251 @@
+#pragma once
+
+/**	@file khronos/sort.hpp
+	@date 2026-10-18
+
+	Sorting, selection and bucketing of date columns.
+
+	JD columns are ordered by an order-preserving unsigned key derived from the
+	bits of the double, so the LSD radix sort never calls a comparison operator.
+	Columns of calendar objects compute each element's JD exactly once and sort
+	(key, index) pairs before permuting the objects into place.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/calendar_traits.hpp>
+#include <khronos/packed_date.hpp>
+#include <khronos/parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+namespace khronos {
+
+	/** Order-preserving unsigned key of a JD: key(a) < key(b) iff a < b (for non-NaN values). */
+	constexpr std::uint64_t order_key(jd_t jd) {
+		auto const bits = std::bit_cast<std::uint64_t>(jd);
+		return (bits & 0x8000'0000'0000'0000ull) ? ~bits : bits | 0x8000'0000'0000'0000ull;
+	}
+
+
+	namespace detail {
+		/* Pair sorted in place of a (possibly large) calendar object. */
+		struct keyed_index {
+			std::uint64_t key;
+			std::size_t index;
+		};
+
+		/* Below this size a comparison sort beats the eight histogram passes. */
+		constexpr std::size_t RADIX_SORT_THRESHOLD = 64;
+
+
+		/*	Stable LSD radix sort of 'items' on the 64-bit key given by 'key'.
+			Passes where every element shares the same digit are skipped. */
+		template <typename T, typename KeyFn>
+		void radix_sort(std::span<T> items, KeyFn key) {
+			std::size_t const n = items.size();
+			if (n < RADIX_SORT_THRESHOLD) {
+				std::stable_sort(items.begin(), items.end(), [&](T const& a, T const& b) { return key(a) < key(b); });
+				return;
+			}
+
+			std::array<std::array<std::size_t, 256>, 8> counts{};
+			for (auto const& item : items) {
+				auto const k = key(item);
+				for (int digit = 0; digit < 8; ++digit)
+					++counts[digit][(k >> (8 * digit)) & 0xFF];
+			}
+
+			std::vector<T> buffer(n);
+			T* src = items.data();
+			T* dst = buffer.data();
+			for (int digit = 0; digit < 8; ++digit) {
+				auto& count = counts[digit];
+				int const shift = 8 * digit;
+				if (count[(key(src[0]) >> shift) & 0xFF] == n)
+					continue;
+
+				std::size_t offset = 0;
+				for (auto& c : count) {
+					auto const c0 = c;
+					c = offset;
+					offset += c0;
+				}
+				for (std::size_t i = 0; i < n; ++i)
+					dst[count[(key(src[i]) >> shift) & 0xFF]++] = std::move(src[i]);
+				std::swap(src, dst);
+			}
+			if (src != items.data())
+				std::move(src, src + n, items.data());
+		}
+
+
+		/*	MSD radix selection: afterwards items[nth] holds the element that a sort would place there,
+			no element before it has a greater key and no element after it has a smaller key. */
+		template <typename T, typename KeyFn>
+		void radix_select(std::span<T> items, std::size_t nth, KeyFn key) {
+			if (nth >= items.size())
+				return;
+
+			std::vector<T> buffer;
+			std::size_t lo = 0, hi = items.size();
+			for (int shift = 56; shift >= 0 && hi - lo > RADIX_SORT_THRESHOLD; shift -= 8) {
+				std::array<std::size_t, 257> bounds{};
+				for (std::size_t i = lo; i < hi; ++i)
+					++bounds[((key(items[i]) >> shift) & 0xFF) + 1];
+				for (std::size_t d = 1; d < bounds.size(); ++d)
+					bounds[d] += bounds[d - 1];
+
+				std::size_t const target = nth - lo;
+				std::size_t bucket = 0;
+				while (bounds[bucket + 1] <= target)
+					++bucket;
+				if (bounds[bucket + 1] - bounds[bucket] == hi - lo)
+					continue;	// every element shares this digit
+
+				buffer.resize(hi - lo);
+				auto next = bounds;
+				for (std::size_t i = lo; i < hi; ++i)
+					buffer[next[(key(items[i]) >> shift) & 0xFF]++] = std::move(items[i]);
+				std::move(buffer.begin(), buffer.begin() + (hi - lo), items.begin() + lo);
+
+				hi = lo + bounds[bucket + 1];
+				lo = lo + bounds[bucket];
+			}
+			std::nth_element(items.begin() + lo, items.begin() + nth, items.begin() + hi,
+				[&](T const& a, T const& b) { return key(a) < key(b); });
+		}
+
+
+		/* Multi-threaded radix sort: sort one chunk per thread, then merge the runs pairwise. */
+		void parallel_radix_sort(std::span<std::uint64_t> keys, unsigned threads);
+		void parallel_radix_sort(std::span<jd_t> jds, unsigned threads);
+
+
+		/* Compute each calendar object's key once. */
+		template <typename Calendar>
+		std::vector<keyed_index> make_keys(std::span<Calendar const> dates) {
+			std::vector<keyed_index> keys(dates.size());
+			for (std::size_t i = 0; i < dates.size(); ++i)
+				keys[i] = { order_key(dates[i].to_jd()), i };
+			return keys;
+		}
+
+
+		/* Rearrange 'dates' so that dates[i] = original[keys[i].index]. */
+		template <typename Calendar>
+		void apply_permutation(std::span<Calendar> dates, std::vector<keyed_index> const& keys) {
+			std::vector<Calendar> sorted;
+			sorted.reserve(dates.size());
+			for (auto const& k : keys)
+				sorted.push_back(std::move(dates[k.index]));
+			std::move(sorted.begin(), sorted.end(), dates.begin());
+		}
+	}
+
+
+
+	// JD AND PACKED COLUMNS
+	// --------------------------------------------------------------------------------------
+
+	/** Sort a JD column into ascending order (stable). */
+	void sort(std::span<jd_t> jds);
+	void sort(std::span<Jd> jds);
+	void sort(std::span<packed_date_t> dates);
+	void sort(parallel_policy policy, std::span<jd_t> jds);
+	void sort(parallel_policy policy, std::span<packed_date_t> dates);
+
+	/** The radix sort is stable; these are provided for symmetry with the standard library. */
+	inline void stable_sort(std::span<jd_t> jds) { sort(jds); }
+	inline void stable_sort(std::span<Jd> jds) { sort(jds); }
+	inline void stable_sort(std::span<packed_date_t> dates) { sort(dates); }
+	inline void stable_sort(parallel_policy policy, std::span<jd_t> jds) { sort(policy, jds); }
+	inline void stable_sort(parallel_policy policy, std::span<packed_date_t> dates) { sort(policy, dates); }
+
+	/** Partially order a column so that element 'nth' is the one a full sort would put there. */
+	void nth_element(std::span<jd_t> jds, std::size_t nth);
+	void nth_element(std::span<Jd> jds, std::size_t nth);
+	void nth_element(std::span<packed_date_t> dates, std::size_t nth);
+
+
+
+	// CALENDAR OBJECT COLUMNS
+	// --------------------------------------------------------------------------------------
+
+	/** Sort a contiguous range of calendar objects into chronological order (stable). */
+	template <std::ranges::contiguous_range Range>
+		requires calendar_date<std::ranges::range_value_t<Range>>
+	void sort(Range&& dates) {
+		using calendar_type = std::ranges::range_value_t<Range>;
+		std::span<calendar_type> span(dates);
+		auto keys = detail::make_keys<calendar_type>(span);
+		detail::radix_sort(std::span(keys), [](detail::keyed_index const& k) { return k.key; });
+		detail::apply_permutation(span, keys);
+	}
+
+
+	template <std::ranges::contiguous_range Range>
+		requires calendar_date<std::ranges::range_value_t<Range>>
+	void stable_sort(Range&& dates) {
+		sort(std::forward<Range>(dates));
+	}
+
+
+	/** Partially order calendar objects so that element 'nth' is the one a full sort would put there. */
+	template <std::ranges::contiguous_range Range>
+		requires calendar_date<std::ranges::range_value_t<Range>>
+	void nth_element(Range&& dates, std::size_t nth) {
+		using calendar_type = std::ranges::range_value_t<Range>;
+		std::span<calendar_type> span(dates);
+		auto keys = detail::make_keys<calendar_type>(span);
+		detail::radix_select(std::span(keys), nth, [](detail::keyed_index const& k) { return k.key; });
+		detail::apply_permutation(span, keys);
+	}
+
+
+
+	// BUCKETING
+	// --------------------------------------------------------------------------------------
+
+	/** A run of a sorted column falling in one calendar period [begin, end). */
+	struct date_bucket {
+		jd_t begin;
+		jd_t end;
+		std::size_t first;
+		std::size_t count;
+	};
+
+
+	/**	Split a sorted JD column into calendar periods.
+		Only one calendar conversion is made per non-empty period; the end of each
+		run is found by binary search, so the cost is O(buckets * log(n)).
+		@param sorted [in] JD column in ascending order.
+		@param p [in] the period kind (day, week, month or year of 'Calendar').
+		@return the non-empty periods in ascending order.
+		*/
+	template <typename Calendar>
+	std::vector<date_bucket> bucket(std::span<jd_t const> sorted, period p) {
+		std::vector<date_bucket> buckets;
+		std::size_t first = 0;
+		while (first < sorted.size()) {
+			date_bucket b{};
+			period_bounds<Calendar>(sorted[first], p, b.begin, b.end);
+			auto const last = std::lower_bound(sorted.begin() + first + 1, sorted.end(), b.end);
+			b.first = first;
+			b.count = static_cast<std::size_t>(last - sorted.begin()) - first;
+			buckets.push_back(b);
+			first += b.count;
+		}
+		return buckets;
+	}
+
+} // end-of-namespace khronos
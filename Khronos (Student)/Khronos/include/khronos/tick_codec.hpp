@@ -0,0 +1,88 @@
+#pragma once
+
+/**	@file khronos/tick_codec.hpp
+	@date 2026-10-18
+
+	Delta-of-delta compression of tick columns.
+
+	Each row is coded as the change in the interval since the previous row
+	(the delta-of-delta, 'dod'; the rows before the first are taken as 0).
+	The stream is a sequence of LEB128 varints, each one of:
+
+		zigzag(dod)		one row with a non-zero delta-of-delta
+		0, n			n rows with a delta-of-delta of 0
+
+	so a stream sampled at a constant interval costs a few bytes per run,
+	and jittered intervals cost one or two bytes per row.  Differences wrap
+	modulo 2^64, so every tick_t column round trips.  The decoder expands a
+	run as an affine fill, which the compiler vectorizes.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+namespace khronos {
+
+	namespace detail {
+		constexpr std::uint64_t zigzag_encode(std::int64_t v) {
+			return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63);
+		}
+
+		constexpr std::int64_t zigzag_decode(std::uint64_t u) {
+			return static_cast<std::int64_t>(u >> 1) ^ -static_cast<std::int64_t>(u & 1);
+		}
+	}
+
+
+
+	/**	Streaming tick encoder.
+		Rows may be appended in chunks of any size; flush() writes the pending
+		run so that bytes() decodes to every row appended so far.  Appending
+		after a flush continues the same stream.
+		*/
+	class tick_encoder {
+		std::vector<std::uint8_t>	bytes_;
+		std::uint64_t				rows_ = 0;
+		std::uint64_t				run_ = 0;
+		std::uint64_t				prev_ = 0;
+		std::uint64_t				delta_ = 0;
+
+		void put(std::uint64_t v);
+		void push(tick_t tick);
+
+	public:
+		void append(std::span<tick_t const> ticks);
+		void append(std::span<jd_t const> jds);
+		void flush();
+
+		/** The stream; complete up to the last flush(). */
+		std::span<std::uint8_t const> bytes() const { return bytes_; }
+		std::uint64_t rows() const { return rows_; }
+
+		/** Starts a new stream. */
+		void clear() { *this = tick_encoder(); }
+	};
+
+
+	/** Compress a tick column. */
+	std::vector<std::uint8_t> encode_ticks(std::span<tick_t const> ticks);
+
+
+	/**	Decode a stream into 'out'.
+		@return the number of rows written: all of the stream's rows, or out.size() if the stream is longer.
+		*/
+	std::size_t decode_ticks(std::span<std::uint8_t const> bytes, std::span<tick_t> out);
+
+	/** Decode a stream directly into a JD column. */
+	std::size_t decode_jds(std::span<std::uint8_t const> bytes, std::span<jd_t> out);
+
+	/** Number of rows in a stream. */
+	std::size_t decoded_size(std::span<std::uint8_t const> bytes);
+
+} // end-of-namespace khronos
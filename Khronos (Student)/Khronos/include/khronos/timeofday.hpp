@@ -12,6 +12,10 @@ Khronos library 'time-of-day' declarations.
 
 #include <khronos/def.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
 
 namespace khronos {
 	// LITERALS
@@ -33,18 +37,63 @@ namespace khronos {
 		return (hours * 3600.0 + minutes * 60.0 + seconds) / SECONDS_PER_DAY;
 	}
 
+	/* Nanoseconds per day. */
+	constexpr long long NANOSECONDS_PER_DAY = 86'400'000'000'000;
+
+	/**	Split a second of the day [0..86399] into hours, minutes and seconds.
+		Uses multiply-shift in 32 bits, exact over the whole day, so span loops vectorize.
+		*/
+	constexpr void sod_to_hms(int sod, hour_t& hours, minute_t& minutes, int& seconds) {
+		auto const s = static_cast<std::uint32_t>(sod);
+		auto const h = (s * 37'283u) >> 27;			// s / 3600
+		auto const rest = s - h * 3'600u;
+		auto const m = (rest * 17'477u) >> 20;		// rest / 60
+		hours = static_cast<hour_t>(h);
+		minutes = static_cast<minute_t>(m);
+		seconds = static_cast<int>(rest - m * 60u);
+	}
+
+	/** Nanosecond of the day [0..NANOSECONDS_PER_DAY) nearest a time-of-day [0..1). */
+	inline long long tod_to_ns(tod_t tod) {
+		return std::clamp(std::llround(tod * NANOSECONDS_PER_DAY), 0LL, NANOSECONDS_PER_DAY - 1);
+	}
+
+	/**	Split a nanosecond of the day into hours, minutes, seconds and nanoseconds.
+		@param ns [in] 0 .. NANOSECONDS_PER_DAY-1
+		*/
+	constexpr void ns_to_hms(long long ns, hour_t& hours, minute_t& minutes, int& seconds, int& nanoseconds) {
+		sod_to_hms(static_cast<int>(ns / 1'000'000'000), hours, minutes, seconds);
+		nanoseconds = static_cast<int>(ns % 1'000'000'000);
+	}
+
+	/**	Split a nanosecond of the day into hours, minutes and seconds.
+		@param ns [in] 0 .. NANOSECONDS_PER_DAY-1
+		@param seconds [out] [0.0..60.0)
+		*/
+	constexpr void ns_to_hms(long long ns, hour_t& hours, minute_t& minutes, second_t& seconds) {
+		int s, nanoseconds;
+		ns_to_hms(ns, hours, minutes, s, nanoseconds);
+		seconds = s + nanoseconds * 1e-9;
+	}
+
+	/**	The nanosecond of the day 'ns', or the whole second within 'resolution' nanoseconds of it.
+		The midnight that ends the day is never a snap target, so the date of 'ns' does not change.
+		*/
+	constexpr long long snap_to_second(long long ns, long long resolution) {
+		long long const second = (ns + 500'000'000) / 1'000'000'000 * 1'000'000'000;
+		long long const offset = ns < second ? second - ns : ns - second;
+		return offset <= resolution && second < NANOSECONDS_PER_DAY ? second : ns;
+	}
+
 	/**	Convert Time-of-day (TOD) to hours, minutes, seconds.  Civil days run from midnight to midnight.
+		The time is rounded to the nanosecond and split exactly, so seconds never reach 60.
 		@param tod [in] a time-of-day [0..1)
 		@param hours [out] 0-23
 		@param minutes [out] 0-59
 		@param seconds [out] [0.0..60.0)
 		*/
 	inline void jd_to_hms(tod_t tod, hour_t& hours, minute_t& minutes, second_t& seconds) {
-		double total_seconds = tod * SECONDS_PER_DAY;
-		hours = static_cast<hour_t>(total_seconds / 3600.0);
-		total_seconds -= hours * 3600.0;
-		minutes = static_cast<minute_t>(total_seconds / 60.0);
-		seconds = total_seconds - minutes * 60.0;
+		ns_to_hms(tod_to_ns(tod), hours, minutes, seconds);
 	}
 
 } // end-of-namespace khronos
@@ -8,6 +8,17 @@ namespace khronos {
 	namespace utility {
 		inline double mod(double a, double b) { return a - b * floor(a / b); }
 		inline double jwday(double j) { return mod(floor(j + 1.5), 7.0); }
+
+		/** Integer division rounding towards negative infinity. */
+		constexpr long long floor_div(long long a, long long b) {
+			long long q = a / b;
+			return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+		}
+
+		/** Integer modulus with the sign of the divisor. */
+		constexpr long long floor_mod(long long a, long long b) {
+			return a - b * floor_div(a, b);
+		}
 	}
 
-} // end-of-namespace khronos
\ No newline at end of file
+} // end-of-namespace khronos
@@ -0,0 +1,196 @@
+#pragma once
+
+/**	@file khronos/validate.hpp
+	@date 2026-10-18
+
+	Calendar date validation.
+
+	The calendar constructors store whatever fields they are given.
+	is_valid<C>() checks the fields against the rules of calendar C and
+	make_date<C>() builds a date only from valid fields.  validate<C>()
+	checks whole columns (one span per field) into a bitmask: bit i % 64 of
+	word i / 64 is set when row i is valid.  The column loop is branch-free
+	over 64-row words so the compiler can vectorize it.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/calendar_traits.hpp>
+#include <khronos/parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+
+
+namespace khronos {
+
+	/** The first invalid field of a rejected date. */
+	enum class date_error { month, day, hour, minute, second };
+
+	/** Description of a date_error. */
+	constexpr char const* to_string(date_error error) {
+		constexpr char const* const names[] = {
+			"month out of range", "day out of range", "hour out of range", "minute out of range", "second out of range" };
+		return names[static_cast<int>(error)];
+	}
+
+
+	namespace detail {
+		/** The row's fields are a date of the calendar.  Evaluates every condition, without branches. */
+		template <typename Calendar>
+		bool date_fields_valid(year_t year, month_t month, day_t day) {
+			using traits = calendar_traits<Calendar>;
+			bool const monthValid = (month >= 1) & (month <= traits::months_in_year(year));
+			month_t const safeMonth = monthValid ? month : 1;
+			bool const valid = monthValid & (day >= 1) & (day <= traits::days_in_month(year, safeMonth));
+			if constexpr (calendar_with_gaps<Calendar>)
+				return valid & traits::is_date(year, safeMonth, day);
+			else
+				return valid;
+		}
+
+		inline bool time_fields_valid(hour_t hour, minute_t minute, second_t second) {
+			return (hour >= 0) & (hour <= 23) & (minute >= 0) & (minute <= 59) & (second >= 0.0) & (second < 60.0);
+		}
+
+		template <typename Calendar>
+		std::expected<void, date_error> check_date(year_t year, month_t month, day_t day) {
+			using traits = calendar_traits<Calendar>;
+			if (month < 1 || month > traits::months_in_year(year))
+				return std::unexpected(date_error::month);
+			if (day < 1 || day > traits::days_in_month(year, month))
+				return std::unexpected(date_error::day);
+			if constexpr (calendar_with_gaps<Calendar>)
+				if (!traits::is_date(year, month, day))
+					return std::unexpected(date_error::day);
+			return {};
+		}
+
+		inline std::expected<void, date_error> check_time(hour_t hour, minute_t minute, second_t second) {
+			if (hour < 0 || hour > 23)
+				return std::unexpected(date_error::hour);
+			if (minute < 0 || minute > 59)
+				return std::unexpected(date_error::minute);
+			if (!(second >= 0.0 && second < 60.0))
+				return std::unexpected(date_error::second);
+			return {};
+		}
+
+		/** Validate rows [64 * firstWord, min(64 * lastWord, n)) into mask words; returns the valid row count. */
+		template <typename Row>
+		std::size_t validate_words(std::size_t n, std::size_t firstWord, std::size_t lastWord, std::span<std::uint64_t> mask, Row row) {
+			std::size_t nValid = 0;
+			for (std::size_t w = firstWord; w < lastWord; ++w) {
+				std::size_t const first = w * 64;
+				std::size_t const count = std::min<std::size_t>(64, n - first);
+				std::uint64_t bits = 0;
+				for (std::size_t i = 0; i < count; ++i)
+					bits |= std::uint64_t(row(first + i)) << i;
+				mask[w] = bits;
+				nValid += std::popcount(bits);
+			}
+			return nValid;
+		}
+
+		template <typename Row>
+		std::size_t validate_rows(parallel_policy policy, std::size_t n, std::span<std::uint64_t> mask, Row row) {
+			std::size_t const nWords = (n + 63) / 64;
+			assert(mask.size() >= nWords);
+			std::atomic<std::size_t> nValid{ 0 };
+			parallel_chunks(nWords, thread_count(policy, n), [&](unsigned, std::size_t first, std::size_t last) {
+				nValid += validate_words(n, first, last, mask, row);
+			});
+			return nValid;
+		}
+	}
+
+
+
+	// SINGLE DATES
+	// --------------------------------------------------------------------------------------
+
+	/** Is (year, month, day) a date of the calendar. */
+	template <typename Calendar>
+	bool is_valid(year_t year, month_t month, day_t day) {
+		return detail::check_date<Calendar>(year, month, day).has_value();
+	}
+
+	/** Is (year, month, day) a date of the calendar, with a time of day in [00:00:00, 24:00:00). */
+	template <typename Calendar>
+	bool is_valid(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second) {
+		return is_valid<Calendar>(year, month, day) && detail::check_time(hour, minute, second).has_value();
+	}
+
+
+	/** The date, or the first invalid field. */
+	template <typename Calendar>
+	std::expected<Calendar, date_error> make_date(year_t year, month_t month, day_t day) {
+		if (auto valid = detail::check_date<Calendar>(year, month, day); !valid)
+			return std::unexpected(valid.error());
+		return Calendar(year, month, day);
+	}
+
+	template <typename Calendar>
+	std::expected<Calendar, date_error> make_date(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second) {
+		if (auto valid = detail::check_date<Calendar>(year, month, day); !valid)
+			return std::unexpected(valid.error());
+		if (auto valid = detail::check_time(hour, minute, second); !valid)
+			return std::unexpected(valid.error());
+		return Calendar(year, month, day, hour, minute, second);
+	}
+
+
+
+	// COLUMNS
+	// --------------------------------------------------------------------------------------
+
+	/** Number of mask words for 'rows' rows. */
+	constexpr std::size_t validity_mask_words(std::size_t rows) { return (rows + 63) / 64; }
+
+	/**	Validate date columns of equal length.
+		@param mask [out] at least validity_mask_words(rows) words; bit i % 64 of mask[i / 64] is set when row i is valid.
+		@return the number of valid rows.
+		*/
+	template <typename Calendar>
+	std::size_t validate(parallel_policy policy,
+		std::span<year_t const> years, std::span<month_t const> months, std::span<day_t const> days,
+		std::span<std::uint64_t> mask) {
+		assert(months.size() == years.size() && days.size() == years.size());
+		return detail::validate_rows(policy, years.size(), mask, [=](std::size_t i) {
+			return detail::date_fields_valid<Calendar>(years[i], months[i], days[i]);
+		});
+	}
+
+	template <typename Calendar>
+	std::size_t validate(std::span<year_t const> years, std::span<month_t const> months, std::span<day_t const> days,
+		std::span<std::uint64_t> mask) {
+		return validate<Calendar>(parallel_policy{ 1 }, years, months, days, mask);
+	}
+
+	/** Validate date and time columns of equal length. */
+	template <typename Calendar>
+	std::size_t validate(parallel_policy policy,
+		std::span<year_t const> years, std::span<month_t const> months, std::span<day_t const> days,
+		std::span<hour_t const> hours, std::span<minute_t const> minutes, std::span<second_t const> seconds,
+		std::span<std::uint64_t> mask) {
+		assert(months.size() == years.size() && days.size() == years.size());
+		assert(hours.size() == years.size() && minutes.size() == years.size() && seconds.size() == years.size());
+		return detail::validate_rows(policy, years.size(), mask, [=](std::size_t i) {
+			return detail::date_fields_valid<Calendar>(years[i], months[i], days[i])
+				& detail::time_fields_valid(hours[i], minutes[i], seconds[i]);
+		});
+	}
+
+	template <typename Calendar>
+	std::size_t validate(std::span<year_t const> years, std::span<month_t const> months, std::span<day_t const> days,
+		std::span<hour_t const> hours, std::span<minute_t const> minutes, std::span<second_t const> seconds,
+		std::span<std::uint64_t> mask) {
+		return validate<Calendar>(parallel_policy{ 1 }, years, months, days, hours, minutes, seconds, mask);
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,226 @@
+#pragma once
+
+/**	@file khronos/week.hpp
+	@date 2026-10-18
+
+	Weekdays, days of the year and week numbers for every calendar.
+
+	Everything is derived in O(1) from the integer Julian Day Number of the
+	date: weekdays are floor_mod(JDN, 7) with 0 = Monday, so no floating
+	floor or modulus is involved.  Weeks start on Monday.  In every calendar
+	week 1 of a year is the week containing its first day; the Gregorian
+	calendar also has ISO 8601 weeks, whose week 1 contains the first Thursday.
+
+	Weekday queries ("third Tuesday of the month", "first Sunday after a
+	holiday") are closed-form too: no day-by-day search.
+	*/
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/utility.hpp>
+#include <khronos/calendar_traits.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+
+namespace khronos {
+
+	/** Julian Day Number of a calendar date. */
+	template <typename Calendar>
+	long long date_jdn(year_t year, month_t month, day_t day) {
+		// to_jd() is the preceding midnight, a whole number + 0.5: the sum is exact
+		return static_cast<long long>(calendar_traits<Calendar>::to_jd(year, month, day) + 0.5);
+	}
+
+
+	/** Day of the week of a Julian Day Number [0..6], where 0 = Monday. */
+	constexpr day_t jdn_day_of_week(long long jdn) {
+		return static_cast<day_t>(utility::floor_mod(jdn, 7));
+	}
+
+	/** Day of the week of 'jd' [0..6], where 0 = Monday. */
+	inline day_t day_of_week(jd_t jd) {
+		return jdn_day_of_week(static_cast<long long>(jd_to_jdn(jd)));
+	}
+
+
+	template <typename Calendar>
+	day_t day_of_week(year_t year, month_t month, day_t day) {
+		return jdn_day_of_week(date_jdn<Calendar>(year, month, day));
+	}
+
+
+	/** Day of the year [1..], counted from the first month of the calendar year. */
+	template <typename Calendar>
+	day_t day_of_year(year_t year, month_t month, day_t day) {
+		using traits = calendar_traits<Calendar>;
+		return static_cast<day_t>(date_jdn<Calendar>(year, month, day) - date_jdn<Calendar>(year, traits::month_at(year, 0), 1) + 1);
+	}
+
+
+	/** Week of the year [1..]: weeks start on Monday and week 1 contains the first day of the year. */
+	template <typename Calendar>
+	int week_of_year(year_t year, month_t month, day_t day) {
+		using traits = calendar_traits<Calendar>;
+		long long const first = date_jdn<Calendar>(year, traits::month_at(year, 0), 1);
+		return static_cast<int>((date_jdn<Calendar>(year, month, day) - first + jdn_day_of_week(first)) / 7 + 1);
+	}
+
+
+	// WEEKDAY-RELATIVE DAYS
+	// --------------------------------------------------------------------------------------
+
+	/** Julian Day Number of the 'weekday' on or after 'jdn'. */
+	constexpr long long jdn_weekday_on_or_after(long long jdn, day_t weekday) {
+		return jdn + utility::floor_mod(weekday - jdn_day_of_week(jdn), 7);
+	}
+
+	/** Julian Day Number of the 'weekday' on or before 'jdn'. */
+	constexpr long long jdn_weekday_on_or_before(long long jdn, day_t weekday) {
+		return jdn - utility::floor_mod(jdn_day_of_week(jdn) - weekday, 7);
+	}
+
+
+	/** JD (midnight) of the first 'weekday' strictly after the day containing 'jd'. */
+	inline jd_t next_weekday(jd_t jd, day_t weekday) {
+		return static_cast<jd_t>(jdn_weekday_on_or_after(static_cast<long long>(jd_to_jdn(jd)) + 1, weekday)) - 0.5;
+	}
+
+	/** JD (midnight) of the last 'weekday' strictly before the day containing 'jd'. */
+	inline jd_t prev_weekday(jd_t jd, day_t weekday) {
+		return static_cast<jd_t>(jdn_weekday_on_or_before(static_cast<long long>(jd_to_jdn(jd)) - 1, weekday)) - 0.5;
+	}
+
+	/** JD (midnight) of the 'weekday' on or after the day containing 'jd'. */
+	inline jd_t weekday_on_or_after(jd_t jd, day_t weekday) {
+		return static_cast<jd_t>(jdn_weekday_on_or_after(static_cast<long long>(jd_to_jdn(jd)), weekday)) - 0.5;
+	}
+
+	/** JD (midnight) of the 'weekday' on or before the day containing 'jd'. */
+	inline jd_t weekday_on_or_before(jd_t jd, day_t weekday) {
+		return static_cast<jd_t>(jdn_weekday_on_or_before(static_cast<long long>(jd_to_jdn(jd)), weekday)) - 0.5;
+	}
+
+
+
+	/**	Day of the month of the n-th 'weekday' of a month; n = -1 is the last, -2 the second last, ...
+		@return 0 if the month has no such day.
+		*/
+	template <typename Calendar>
+	day_t nth_weekday(year_t year, month_t month, day_t weekday, int n) {
+		assert(weekday >= 0 && weekday < 7 && n != 0);
+		day_t const length = calendar_traits<Calendar>::days_in_month(year, month);
+		day_t day;
+		if (n > 0) {
+			day_t const first = day_of_week<Calendar>(year, month, 1);
+			day = 1 + (weekday - first + 7) % 7 + 7 * (n - 1);
+		}
+		else {
+			day_t const last = day_of_week<Calendar>(year, month, length);
+			day = length - (last - weekday + 7) % 7 + 7 * (n + 1);
+		}
+		return day >= 1 && day <= length ? day : 0;
+	}
+
+
+
+	/**	JDs of the n-th 'weekday' of every month of the years [firstYear..lastYear], in date order.
+		Months without such a day are skipped.
+		*/
+	template <typename Calendar>
+	std::vector<jd_t> nth_weekdays(year_t firstYear, year_t lastYear, day_t weekday, int n) {
+		using traits = calendar_traits<Calendar>;
+		std::vector<jd_t> jds;
+		if (lastYear >= firstYear)
+			jds.reserve(static_cast<std::size_t>(lastYear - firstYear + 1) * 13);
+		for (year_t year = firstYear; year <= lastYear; ++year)
+			for (int i = 0, months = traits::months_in_year(year); i < months; ++i) {
+				month_t const month = traits::month_at(year, i);
+				if (day_t const day = nth_weekday<Calendar>(year, month, weekday, n))
+					jds.push_back(traits::to_jd(year, month, day));
+			}
+		return jds;
+	}
+
+
+
+	// ISO 8601 WEEKS
+	// --------------------------------------------------------------------------------------
+
+	/** ISO week date of a Julian Day Number. */
+	inline iso_week_date jdn_iso_week(long long jdn) {
+		day_t const dow = jdn_day_of_week(jdn);
+		long long const thursday = jdn - dow + 3;		// the Thursday of the week decides its year
+		year_t year; month_t month; day_t day;
+		jd_to_gregorian(static_cast<jd_t>(thursday), year, month, day);
+		long long const jan1 = date_jdn<Gregorian>(year, 1, 1);
+		return { year, static_cast<int>((thursday - jan1) / 7 + 1), dow + 1 };
+	}
+
+	inline iso_week_date iso_week(year_t year, month_t month, day_t day) {
+		return jdn_iso_week(date_jdn<Gregorian>(year, month, day));
+	}
+
+
+
+	// COLUMNS
+	// --------------------------------------------------------------------------------------
+
+	/** Days of the week of a JD column. */
+	inline void day_of_week(std::span<jd_t const> jds, std::span<day_t> out) {
+		assert(out.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			out[i] = day_of_week(jds[i]);
+	}
+
+
+	/** Days of the year of a JD column in the calendar. */
+	template <typename Calendar>
+	void day_of_year(std::span<jd_t const> jds, std::span<day_t> out) {
+		assert(out.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i) {
+			year_t y; month_t m; day_t d;
+			calendar_traits<Calendar>::from_jd(jds[i], y, m, d);
+			out[i] = day_of_year<Calendar>(y, m, d);
+		}
+	}
+
+
+	/** Weeks of the year of a JD column in the calendar. */
+	template <typename Calendar>
+	void week_of_year(std::span<jd_t const> jds, std::span<int> out) {
+		assert(out.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i) {
+			year_t y; month_t m; day_t d;
+			calendar_traits<Calendar>::from_jd(jds[i], y, m, d);
+			out[i] = week_of_year<Calendar>(y, m, d);
+		}
+	}
+
+
+	/** ISO week dates of a JD column. */
+	inline void iso_week(std::span<jd_t const> jds, std::span<iso_week_date> out) {
+		assert(out.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			out[i] = jdn_iso_week(static_cast<long long>(jd_to_jdn(jds[i])));
+	}
+
+	/** Next 'weekday' (strictly after) of every JD of a column. */
+	inline void next_weekday(std::span<jd_t const> jds, day_t weekday, std::span<jd_t> out) {
+		assert(out.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			out[i] = next_weekday(jds[i], weekday);
+	}
+
+
+	/** Previous 'weekday' (strictly before) of every JD of a column. */
+	inline void prev_weekday(std::span<jd_t const> jds, day_t weekday, std::span<jd_t> out) {
+		assert(out.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			out[i] = prev_weekday(jds[i], weekday);
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,298 @@
+/**	@file arrow.cpp
+	@date 2026-10-18
+
+	Arrow C Data Interface export and import implementation.
+	*/
+
+#include <khronos/arrow.hpp>
+
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace khronos {
+
+	namespace {
+		constexpr std::int64_t NS_PER_TICK = 1'000;
+
+		/* Owner of an exported array's buffers and children. */
+		struct exported_array {
+			std::vector<std::int32_t>	i32;
+			std::vector<std::int64_t>	i64;
+			std::vector<std::uint8_t>	validity;
+			std::vector<void const*>	buffers;
+			std::vector<ArrowArray>		children;
+			std::vector<ArrowArray*>	childPointers;
+		};
+
+		/* Owner of an exported schema's strings and children. */
+		struct exported_schema {
+			std::string					format;
+			std::string					name;
+			std::vector<ArrowSchema>	children;
+			std::vector<ArrowSchema*>	childPointers;
+		};
+
+
+		void release_array(ArrowArray* array) {
+			auto* owner = static_cast<exported_array*>(array->private_data);
+			for (auto& child : owner->children)
+				if (child.release)
+					child.release(&child);
+			delete owner;
+			array->release = nullptr;
+		}
+
+		void release_schema(ArrowSchema* schema) {
+			auto* owner = static_cast<exported_schema*>(schema->private_data);
+			for (auto& child : owner->children)
+				if (child.release)
+					child.release(&child);
+			delete owner;
+			schema->release = nullptr;
+		}
+
+
+		void make_schema(ArrowSchema* schema, std::string format, std::string name, bool nullable) {
+			auto* owner = new exported_schema{ std::move(format), std::move(name), {}, {} };
+			*schema = ArrowSchema{};
+			schema->format = owner->format.c_str();
+			schema->name = owner->name.c_str();
+			schema->flags = nullable ? ARROW_FLAG_NULLABLE : 0;
+			schema->release = release_schema;
+			schema->private_data = owner;
+		}
+
+		/* An array of 'length' rows over the owner's validity and value buffers. */
+		void make_array(ArrowArray* array, exported_array* owner, std::int64_t length, std::int64_t nullCount, void const* values) {
+			if (nullCount == 0)
+				owner->validity.clear();
+			owner->buffers = { owner->validity.empty() ? nullptr : owner->validity.data(), values };
+			*array = ArrowArray{};
+			array->length = length;
+			array->null_count = nullCount;
+			array->n_buffers = static_cast<std::int64_t>(owner->buffers.size());
+			array->buffers = owner->buffers.data();
+			array->release = release_array;
+			array->private_data = owner;
+		}
+
+		/* Validity bitmap with every row valid. */
+		std::vector<std::uint8_t> all_valid(std::size_t n) {
+			return std::vector<std::uint8_t>((n + 7) / 8, 0xFF);
+		}
+
+		void set_null(std::vector<std::uint8_t>& validity, std::size_t i) {
+			validity[i / 8] &= static_cast<std::uint8_t>(~(1u << (i % 8)));
+		}
+
+
+		/* Can the day containing 'jd' be a date32: false for NaN and days outside int32. */
+		bool to_unix_day(jd_t jd, std::int32_t& day) {
+			jd_t const days = std::floor(jd - UNIX_EPOCH_JD);
+			if (!(days >= std::numeric_limits<std::int32_t>::min() && days <= std::numeric_limits<std::int32_t>::max()))
+				return false;
+			day = static_cast<std::int32_t>(days);
+			return true;
+		}
+
+		/* Can 'jd' be a timestamp[ns]: false for NaN and instants outside 1677-2262. */
+		bool to_unix_ns(jd_t jd, std::int64_t& ns) {
+			constexpr tick_t LIMIT = std::numeric_limits<std::int64_t>::max() / NS_PER_TICK;
+			if (!(std::abs(jd - UNIX_EPOCH_JD) * TICKS_PER_DAY < LIMIT))
+				return false;
+			ns = (jd_to_ticks(jd) - UNIX_EPOCH_TICKS) * NS_PER_TICK;
+			return true;
+		}
+
+
+		/* Ticks since the Unix epoch of a row of 'array', by the schema's format. */
+		struct import_format {
+			int		width;		// bytes per value
+			tick_t	numerator;	// value * numerator / denominator = ticks
+			tick_t	denominator;
+		};
+
+		import_format parse_format(std::string_view format) {
+			if (format == "tdD")
+				return { 4, TICKS_PER_DAY, 1 };
+			if (format == "tdm")
+				return { 8, 1'000, 1 };
+			if (format.size() >= 4 && format.substr(0, 2) == "ts" && format[3] == ':') {
+				switch (format[2]) {
+				case 's': return { 8, 1'000'000, 1 };
+				case 'm': return { 8, 1'000, 1 };
+				case 'u': return { 8, 1, 1 };
+				case 'n': return { 8, 1, NS_PER_TICK };
+				}
+			}
+			throw std::invalid_argument("import_arrow: not a date or timestamp array: " + std::string(format));
+		}
+
+		/*	JD of a value in the format's units: exact through ticks where they hold it,
+			otherwise in double, as the tick count would overflow int64. */
+		jd_t from_unix(std::int64_t value, import_format const& format) {
+			if (format.denominator != 1)
+				return ticks_to_jd(UNIX_EPOCH_TICKS + static_cast<tick_t>(utility::floor_div(value, format.denominator)));
+			tick_t const limit = (std::numeric_limits<tick_t>::max() - UNIX_EPOCH_TICKS) / format.numerator;
+			if (value >= -limit && value <= limit)
+				return ticks_to_jd(UNIX_EPOCH_TICKS + value * format.numerator);
+			return UNIX_EPOCH_JD + static_cast<jd_t>(value) * (static_cast<jd_t>(format.numerator) / TICKS_PER_DAY);
+		}
+	}
+
+
+
+	// CONVERSIONS
+	// --------------------------------------------------------------------------------------
+
+	void jd_to_unix_days(std::span<jd_t const> jds, std::span<std::int32_t> days) {
+		assert(days.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			if (!to_unix_day(jds[i], days[i]))
+				throw std::out_of_range("jd_to_unix_days: JD " + std::to_string(jds[i]) + " at row " + std::to_string(i) + " is not an int32 day");
+	}
+
+
+	void jd_to_unix_ns(std::span<jd_t const> jds, std::span<std::int64_t> ns) {
+		assert(ns.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			if (!to_unix_ns(jds[i], ns[i]))
+				throw std::out_of_range("jd_to_unix_ns: JD " + std::to_string(jds[i]) + " at row " + std::to_string(i) + " is not an int64 nanosecond");
+	}
+
+
+
+	// EXPORT
+	// --------------------------------------------------------------------------------------
+
+	void export_arrow(std::span<jd_t const> jds, arrow_date_type type, ArrowArray* array, ArrowSchema* schema) {
+		auto* owner = new exported_array;
+		owner->validity = all_valid(jds.size());
+		std::int64_t nulls = 0;
+
+		if (type == arrow_date_type::date32) {
+			owner->i32.resize(jds.size());
+			for (std::size_t i = 0; i < jds.size(); ++i)
+				if (!to_unix_day(jds[i], owner->i32[i])) {
+					set_null(owner->validity, i);
+					++nulls;
+				}
+			make_array(array, owner, static_cast<std::int64_t>(jds.size()), nulls, owner->i32.data());
+			make_schema(schema, "tdD", "", nulls != 0);
+			return;
+		}
+
+		owner->i64.resize(jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			if (!to_unix_ns(jds[i], owner->i64[i])) {
+				set_null(owner->validity, i);
+				++nulls;
+			}
+		make_array(array, owner, static_cast<std::int64_t>(jds.size()), nulls, owner->i64.data());
+		make_schema(schema, "tsn:", "", nulls != 0);
+	}
+
+
+	void export_arrow(std::vector<std::int32_t>&& unixDays, ArrowArray* array, ArrowSchema* schema) {
+		auto* owner = new exported_array;
+		owner->i32 = std::move(unixDays);
+		make_array(array, owner, static_cast<std::int64_t>(owner->i32.size()), 0, owner->i32.data());
+		make_schema(schema, "tdD", "", false);
+	}
+
+
+	void export_arrow(std::vector<std::int64_t>&& unixNs, ArrowArray* array, ArrowSchema* schema) {
+		auto* owner = new exported_array;
+		owner->i64 = std::move(unixNs);
+		make_array(array, owner, static_cast<std::int64_t>(owner->i64.size()), 0, owner->i64.data());
+		make_schema(schema, "tsn:", "", false);
+	}
+
+
+	namespace detail {
+		void export_date_fields(std::vector<std::int32_t>&& years, std::vector<std::int32_t>&& months, std::vector<std::int32_t>&& days,
+			std::vector<bool> const& valid, ArrowArray* array, ArrowSchema* schema) {
+			auto const n = years.size();
+			auto* owner = new exported_array;
+			owner->validity = all_valid(n);
+			std::int64_t nulls = 0;
+			for (std::size_t i = 0; i < n; ++i)
+				if (!valid[i]) {
+					set_null(owner->validity, i);
+					++nulls;
+				}
+
+			make_schema(schema, "+s", "", nulls != 0);
+			auto* schemaOwner = static_cast<exported_schema*>(schema->private_data);
+			schemaOwner->children.resize(3);
+
+			owner->children.resize(3);
+			std::vector<std::int32_t>* columns[] = { &years, &months, &days };
+			char const* const names[] = { "year", "month", "day" };
+			for (int c = 0; c < 3; ++c) {
+				auto* childOwner = new exported_array;
+				childOwner->i32 = std::move(*columns[c]);
+				make_array(&owner->children[c], childOwner, static_cast<std::int64_t>(n), 0, childOwner->i32.data());
+				make_schema(&schemaOwner->children[c], "i", names[c], false);
+				owner->childPointers.push_back(&owner->children[c]);
+				schemaOwner->childPointers.push_back(&schemaOwner->children[c]);
+			}
+			schema->n_children = 3;
+			schema->children = schemaOwner->childPointers.data();
+
+			if (nulls == 0)
+				owner->validity.clear();
+			owner->buffers = { owner->validity.empty() ? nullptr : owner->validity.data() };
+			*array = ArrowArray{};
+			array->length = static_cast<std::int64_t>(n);
+			array->null_count = nulls;
+			array->n_buffers = 1;
+			array->buffers = owner->buffers.data();
+			array->n_children = 3;
+			array->children = owner->childPointers.data();
+			array->release = release_array;
+			array->private_data = owner;
+		}
+	}
+
+
+
+	// IMPORT
+	// --------------------------------------------------------------------------------------
+
+	std::vector<jd_t> import_arrow(ArrowArray const* array, ArrowSchema const* schema) {
+		auto const format = parse_format(schema->format);
+		if (array->n_buffers != 2)
+			throw std::invalid_argument("import_arrow: expected a validity and a value buffer");
+
+		auto const n = static_cast<std::size_t>(array->length);
+		auto const offset = static_cast<std::size_t>(array->offset);
+		auto const* validity = static_cast<std::uint8_t const*>(array->buffers[0]);
+		auto const* values = static_cast<std::byte const*>(array->buffers[1]);
+
+		std::vector<jd_t> jds(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			std::size_t const row = offset + i;
+			if (validity && array->null_count != 0 && !(validity[row / 8] & (1u << (row % 8)))) {
+				jds[i] = std::numeric_limits<jd_t>::quiet_NaN();
+				continue;
+			}
+			std::int64_t value;
+			if (format.width == 4) {
+				std::int32_t v;
+				std::memcpy(&v, values + row * 4, 4);
+				value = v;
+			}
+			else
+				std::memcpy(&value, values + row * 8, 8);
+			jds[i] = from_unix(value, format);
+		}
+		return jds;
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,121 @@
+/**	@file astronomical_time.cpp
+	@date 2026-10-18
+
+	Sidereal time, nutation and equation of time implementation.
+	*/
+
+#include <khronos/astronomical_time.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+
+namespace khronos {
+
+	namespace {
+		constexpr double DEG = std::numbers::pi / 180.0;
+
+		inline nutation_angles nutation_kernel(double T) {
+			double const omega = (125.044'52 - 1'934.136'261 * T) * DEG;
+			double const L = (280.466'5 + 36'000.769'8 * T) * DEG;		// mean longitude of the Sun
+			double const Lp = (218.316'5 + 481'267.881'3 * T) * DEG;	// mean longitude of the Moon
+			return {
+				-17.20 * std::sin(omega) - 1.32 * std::sin(2 * L) - 0.23 * std::sin(2 * Lp) + 0.21 * std::sin(2 * omega),
+				9.20 * std::cos(omega) + 0.57 * std::cos(2 * L) + 0.10 * std::cos(2 * Lp) - 0.09 * std::cos(2 * omega) };
+		}
+
+		/** GAST from the split UT: the equation of the equinoxes is delta psi * cos(epsilon). */
+		inline double gast_kernel(split_jd ut) {
+			double const T = julian_centuries(ut);
+			nutation_angles const n = nutation_kernel(T);
+			double const epsilon = (detail::mean_obliquity(T) + n.obliquity / 3'600.0) * DEG;
+			double const degrees = gmst(ut) + n.longitude * std::cos(epsilon) / 3'600.0;
+			return degrees < 0.0 ? degrees + 360.0 : degrees >= 360.0 ? degrees - 360.0 : degrees;
+		}
+
+		inline double equation_of_time_kernel(double T) {
+			double const L0 = (280.466'46 + (36'000.769'83 + 0.000'303'2 * T) * T) * DEG;
+			double const M = (357.529'11 + (35'999.050'29 - 0.000'153'7 * T) * T) * DEG;
+			double const e = 0.016'708'634 - (0.000'042'037 + 0.000'000'126'7 * T) * T;
+			double const epsilon = (detail::mean_obliquity(T) + nutation_kernel(T).obliquity / 3'600.0) * DEG;
+			double const tanHalf = std::tan(epsilon / 2);
+			double const y = tanHalf * tanHalf;
+			double const E = y * std::sin(2 * L0) - 2 * e * std::sin(M) + 4 * e * y * std::sin(M) * std::cos(2 * L0)
+				- 0.5 * y * y * std::sin(4 * L0) - 1.25 * e * e * std::sin(2 * M);
+			return E / DEG * 4.0;		// one degree of hour angle is four minutes of time
+		}
+	}
+
+
+
+	nutation_angles nutation(jd_t jde) {
+		return nutation_kernel(julian_centuries(jde));
+	}
+
+	double gast(split_jd ut) {
+		return gast_kernel(ut);
+	}
+
+	double gast(jd_t ut) {
+		return gast_kernel(split(ut));
+	}
+
+	double equation_of_time(jd_t jde) {
+		return equation_of_time_kernel(julian_centuries(jde));
+	}
+
+
+
+	// SPAN KERNELS
+	// ----------------------------------------------------------------------------------
+
+	void julian_centuries(std::span<jd_t const> jds, std::span<double> centuries) {
+		assert(centuries.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			centuries[i] = julian_centuries(jds[i]);
+	}
+
+	void days_since(std::span<jd_t const> jds, jd_t epoch, std::span<double> days) {
+		assert(days.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			days[i] = jds[i] - epoch;
+	}
+
+	void days_since(std::span<tick_t const> ticks, jd_t epoch, std::span<double> days) {
+		assert(days.size() >= ticks.size());
+		for (std::size_t i = 0; i < ticks.size(); ++i)
+			days[i] = days_since(split_ticks(ticks[i]), epoch);
+	}
+
+	void gmst(std::span<jd_t const> uts, std::span<double> degrees) {
+		assert(degrees.size() >= uts.size());
+		for (std::size_t i = 0; i < uts.size(); ++i)
+			degrees[i] = gmst(split(uts[i]));
+	}
+
+	void gmst(std::span<tick_t const> uts, std::span<double> degrees) {
+		assert(degrees.size() >= uts.size());
+		for (std::size_t i = 0; i < uts.size(); ++i)
+			degrees[i] = gmst(split_ticks(uts[i]));
+	}
+
+	void gast(std::span<jd_t const> uts, std::span<double> degrees) {
+		assert(degrees.size() >= uts.size());
+		for (std::size_t i = 0; i < uts.size(); ++i)
+			degrees[i] = gast_kernel(split(uts[i]));
+	}
+
+	void gast(std::span<tick_t const> uts, std::span<double> degrees) {
+		assert(degrees.size() >= uts.size());
+		for (std::size_t i = 0; i < uts.size(); ++i)
+			degrees[i] = gast_kernel(split_ticks(uts[i]));
+	}
+
+	void equation_of_time(std::span<jd_t const> jdes, std::span<double> minutes) {
+		assert(minutes.size() >= jdes.size());
+		for (std::size_t i = 0; i < jdes.size(); ++i)
+			minutes[i] = equation_of_time_kernel(julian_centuries(jdes[i]));
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,348 @@
+/**	@file column_file.cpp
+	@date 2026-10-18
+
+	Memory-mapped columnar date file implementation.
+	*/
+
+#include <khronos/column_file.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace khronos {
+
+	static_assert(std::endian::native == std::endian::little, "column files are little-endian");
+	static_assert(sizeof(column_block_info) == 32);
+
+	namespace {
+		constexpr char MAGIC[8] = { 'K', 'H', 'R', 'N', 'C', 'O', 'L', '1' };
+		constexpr std::uint32_t FORMAT_VERSION = 2;
+		constexpr std::size_t BLOCK_ALIGNMENT = 64;
+		constexpr std::uint32_t CHECKPOINT_ROWS = 64;		// rows per stored tick of a delta block
+
+		struct file_header {
+			char			magic[8];
+			std::uint32_t	version;
+			std::uint32_t	rowsPerBlock;
+			std::byte		reserved[48];
+		};
+		static_assert(sizeof(file_header) == BLOCK_ALIGNMENT);
+
+		struct file_trailer {
+			std::uint64_t	indexOffset;
+			std::uint64_t	blockCount;
+			std::uint64_t	rows;
+			char			magic[8];
+		};
+		static_assert(sizeof(file_trailer) == 32);
+
+
+		/** Checkpoint ticks stored at the start of a delta block of 'rows' rows. */
+		constexpr std::uint64_t checkpoint_count(std::uint64_t rows) {
+			return (rows + CHECKPOINT_ROWS - 1) / CHECKPOINT_ROWS;
+		}
+
+		/** Size of a block's data, without the padding that follows it. */
+		std::uint64_t block_bytes(column_block_info const& block) {
+			if (block.encoding == column_encoding::delta)
+				return checkpoint_count(block.rows) * sizeof(tick_t) + (block.rows - std::uint64_t(1)) * sizeof(std::int32_t);
+			return block.rows * sizeof(tick_t);
+		}
+
+
+		/** Do the consecutive differences of 'ticks' all fit an int32. */
+		bool fits_delta(std::span<tick_t const> ticks) {
+			constexpr tick_t lo = std::numeric_limits<std::int32_t>::min(), hi = std::numeric_limits<std::int32_t>::max();
+			for (std::size_t i = 1; i < ticks.size(); ++i) {
+				// subtract as unsigned: the difference of distant ticks may overflow
+				auto const diff = static_cast<tick_t>(static_cast<std::uint64_t>(ticks[i]) - static_cast<std::uint64_t>(ticks[i - 1]));
+				if (diff < lo || diff > hi || (ticks[i] < ticks[i - 1]) != (diff < 0))
+					return false;
+			}
+			return true;
+		}
+	}
+
+
+
+	// WRITER
+	// --------------------------------------------------------------------------------------
+
+	column_file_writer::column_file_writer(std::filesystem::path const& path, column_file_options options)
+		: out_(path, std::ios::binary | std::ios::trunc), options_(options) {
+		if (!out_)
+			throw std::runtime_error("Could not open: " + path.string());
+		if (options_.rows_per_block == 0)
+			throw std::invalid_argument("column_file_writer: rows_per_block must be positive");
+
+		file_header header{};
+		std::memcpy(header.magic, MAGIC, sizeof MAGIC);
+		header.version = FORMAT_VERSION;
+		header.rowsPerBlock = options_.rows_per_block;
+		out_.write(reinterpret_cast<char const*>(&header), sizeof header);
+		offset_ = sizeof header;
+		pending_.reserve(options_.rows_per_block);
+	}
+
+
+	column_file_writer::~column_file_writer() {
+		try {
+			close();
+		}
+		catch (...) {
+			// destructors must not throw; call close() to observe write errors
+		}
+	}
+
+
+	void column_file_writer::append(std::span<tick_t const> ticks) {
+		while (!ticks.empty()) {
+			auto const n = std::min<std::size_t>(ticks.size(), options_.rows_per_block - pending_.size());
+			pending_.insert(pending_.end(), ticks.begin(), ticks.begin() + n);
+			ticks = ticks.subspan(n);
+			rows_ += n;
+			if (pending_.size() == options_.rows_per_block)
+				write_block();
+		}
+	}
+
+
+	void column_file_writer::append(std::span<jd_t const> jds) {
+		for (jd_t jd : jds) {
+			pending_.push_back(jd_to_ticks(jd));
+			++rows_;
+			if (pending_.size() == options_.rows_per_block)
+				write_block();
+		}
+	}
+
+
+	void column_file_writer::pad_to_block_boundary() {
+		static constexpr char zeros[BLOCK_ALIGNMENT] = {};
+		auto const padding = (BLOCK_ALIGNMENT - offset_ % BLOCK_ALIGNMENT) % BLOCK_ALIGNMENT;
+		out_.write(zeros, padding);
+		offset_ += padding;
+	}
+
+
+	void column_file_writer::write_block() {
+		if (pending_.empty())
+			return;
+
+		auto const [lo, hi] = std::minmax_element(pending_.begin(), pending_.end());
+		column_block_info info{ offset_, static_cast<std::uint32_t>(pending_.size()), column_encoding::raw, *lo, *hi };
+
+		if (options_.encoding == column_encoding::delta && fits_delta(pending_)) {
+			info.encoding = column_encoding::delta;
+			std::vector<tick_t> checkpoints;
+			checkpoints.reserve(checkpoint_count(pending_.size()));
+			for (std::size_t i = 0; i < pending_.size(); i += CHECKPOINT_ROWS)
+				checkpoints.push_back(pending_[i]);
+			std::vector<std::int32_t> deltas(pending_.size() - 1);
+			for (std::size_t i = 1; i < pending_.size(); ++i)
+				deltas[i - 1] = static_cast<std::int32_t>(pending_[i] - pending_[i - 1]);
+			out_.write(reinterpret_cast<char const*>(checkpoints.data()), checkpoints.size() * sizeof(tick_t));
+			out_.write(reinterpret_cast<char const*>(deltas.data()), deltas.size() * sizeof(std::int32_t));
+		}
+		else
+			out_.write(reinterpret_cast<char const*>(pending_.data()), pending_.size() * sizeof(tick_t));
+		offset_ += block_bytes(info);
+		pad_to_block_boundary();
+
+		index_.push_back(info);
+		pending_.clear();
+	}
+
+
+	void column_file_writer::close() {
+		if (!out_.is_open())
+			return;
+		write_block();
+
+		file_trailer trailer{ offset_, index_.size(), rows_, {} };
+		std::memcpy(trailer.magic, MAGIC, sizeof MAGIC);
+		out_.write(reinterpret_cast<char const*>(index_.data()), index_.size() * sizeof(column_block_info));
+		out_.write(reinterpret_cast<char const*>(&trailer), sizeof trailer);
+
+		bool const ok = static_cast<bool>(out_.flush());
+		out_.close();
+		if (!ok)
+			throw std::runtime_error("column_file_writer: write failed");
+	}
+
+
+
+	// READER
+	// --------------------------------------------------------------------------------------
+
+	column_file::column_file(std::filesystem::path const& path) {
+#ifdef _WIN32
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			throw std::runtime_error("Could not open: " + path.string());
+		LARGE_INTEGER size{};
+		if (!GetFileSizeEx(file, &size)) {
+			CloseHandle(file);
+			throw std::runtime_error("Could not get the size of: " + path.string());
+		}
+		size_ = static_cast<std::size_t>(size.QuadPart);
+		HANDLE mapping = size_ ? CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+		CloseHandle(file);
+		if (mapping) {
+			data_ = static_cast<std::byte const*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			CloseHandle(mapping);	// the view keeps the mapping alive
+		}
+#else
+		int const fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			throw std::runtime_error("Could not open: " + path.string());
+		struct stat st {};
+		if (::fstat(fd, &st) != 0) {
+			::close(fd);
+			throw std::runtime_error("Could not get the size of: " + path.string());
+		}
+		size_ = static_cast<std::size_t>(st.st_size);
+		if (size_) {
+			void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+			data_ = p == MAP_FAILED ? nullptr : static_cast<std::byte const*>(p);
+		}
+		::close(fd);	// the mapping keeps the file open
+#endif
+		if (!data_)
+			throw std::runtime_error("Could not map: " + path.string());
+
+		auto invalid = [&] {
+			unmap();
+			return std::runtime_error("Not a Khronos column file: " + path.string());
+		};
+		if (size_ < sizeof(file_header) + sizeof(file_trailer))
+			throw invalid();
+
+		auto const& header = *reinterpret_cast<file_header const*>(data_);
+		auto const& trailer = *reinterpret_cast<file_trailer const*>(data_ + size_ - sizeof(file_trailer));
+		if (std::memcmp(header.magic, MAGIC, sizeof MAGIC) || std::memcmp(trailer.magic, MAGIC, sizeof MAGIC)
+			|| header.version != FORMAT_VERSION || header.rowsPerBlock == 0
+			|| trailer.indexOffset % BLOCK_ALIGNMENT
+			|| trailer.indexOffset > size_ - sizeof(file_trailer)
+			|| trailer.blockCount != (size_ - sizeof(file_trailer) - trailer.indexOffset) / sizeof(column_block_info))
+			throw invalid();
+
+		rows_ = trailer.rows;
+		rowsPerBlock_ = header.rowsPerBlock;
+		index_ = { reinterpret_cast<column_block_info const*>(data_ + trailer.indexOffset), static_cast<std::size_t>(trailer.blockCount) };
+
+		std::uint64_t counted = 0;
+		blockEnds_.reserve(index_.size());
+		for (auto const& block : index_) {
+			if (block.rows == 0 || block.rows > rowsPerBlock_ || block.offset % BLOCK_ALIGNMENT
+				|| (block.encoding != column_encoding::raw && block.encoding != column_encoding::delta)
+				|| block.offset > trailer.indexOffset || block_bytes(block) > trailer.indexOffset - block.offset)
+				throw invalid();
+			counted += block.rows;
+			blockEnds_.push_back(counted);
+		}
+		if (counted != rows_)
+			throw invalid();
+	}
+
+
+	column_file::column_file(column_file&& other) noexcept
+		: data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+		rows_(std::exchange(other.rows_, 0)), rowsPerBlock_(std::exchange(other.rowsPerBlock_, 0)),
+		index_(std::exchange(other.index_, {})), blockEnds_(std::move(other.blockEnds_)) {
+	}
+
+
+	column_file& column_file::operator=(column_file&& other) noexcept {
+		if (this != &other) {
+			unmap();
+			data_ = std::exchange(other.data_, nullptr);
+			size_ = std::exchange(other.size_, 0);
+			rows_ = std::exchange(other.rows_, 0);
+			rowsPerBlock_ = std::exchange(other.rowsPerBlock_, 0);
+			index_ = std::exchange(other.index_, {});
+			blockEnds_ = std::move(other.blockEnds_);
+		}
+		return *this;
+	}
+
+
+	void column_file::unmap() {
+		if (!data_)
+			return;
+#ifdef _WIN32
+		UnmapViewOfFile(data_);
+#else
+		::munmap(const_cast<std::byte*>(data_), size_);
+#endif
+		data_ = nullptr;
+		size_ = 0;
+	}
+
+
+	std::span<tick_t const> column_file::block_ticks(std::size_t b, std::vector<tick_t>& buffer) const {
+		if (b >= index_.size())
+			throw std::out_of_range("column_file: block " + std::to_string(b) + " of " + std::to_string(index_.size()));
+		auto const& block = index_[b];
+		std::byte const* p = data_ + block.offset;
+		if (block.encoding == column_encoding::raw)
+			return { reinterpret_cast<tick_t const*>(p), block.rows };
+
+		buffer.resize(block.rows);
+		auto const* deltas = reinterpret_cast<std::int32_t const*>(p + checkpoint_count(block.rows) * sizeof(tick_t));
+		tick_t t = *reinterpret_cast<tick_t const*>(p);
+		buffer[0] = t;
+		for (std::size_t i = 1; i < block.rows; ++i)
+			buffer[i] = t += deltas[i - 1];
+		return buffer;
+	}
+
+
+	tick_t column_file::tick(std::uint64_t row) const {
+		if (row >= rows_)
+			throw std::out_of_range("column_file: row " + std::to_string(row) + " of " + std::to_string(rows_));
+
+		// the writer fills every block but the last, so the row's block is usually row / rowsPerBlock;
+		// a file with shorter blocks is searched
+		auto b = static_cast<std::size_t>(row / rowsPerBlock_);
+		if (b >= index_.size() || row >= blockEnds_[b] || row < blockEnds_[b] - index_[b].rows)
+			b = static_cast<std::size_t>(std::upper_bound(blockEnds_.begin(), blockEnds_.end(), row) - blockEnds_.begin());
+		auto const& block = index_[b];
+		auto const i = static_cast<std::size_t>(row - (blockEnds_[b] - block.rows));
+		std::byte const* p = data_ + block.offset;
+		if (block.encoding == column_encoding::raw)
+			return reinterpret_cast<tick_t const*>(p)[i];
+
+		// continue from the row's checkpoint
+		auto const* checkpoints = reinterpret_cast<tick_t const*>(p);
+		auto const* deltas = reinterpret_cast<std::int32_t const*>(p + checkpoint_count(block.rows) * sizeof(tick_t));
+		tick_t t = checkpoints[i / CHECKPOINT_ROWS];
+		for (std::size_t k = i / CHECKPOINT_ROWS * CHECKPOINT_ROWS; k < i; ++k)
+			t += deltas[k];
+		return t;
+	}
+
+
+	std::vector<jd_t> column_file::select(jd_t first, jd_t last) const {
+		std::vector<jd_t> jds;
+		scan(first, last, [&](std::uint64_t, tick_t t) { jds.push_back(ticks_to_jd(t)); });
+		return jds;
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,36 @@
+/**	@file datetime_columns.cpp
+	@date 2026-10-18
+
+	Date and time-of-day column decoder implementation.
+	*/
+
+#include <khronos/datetime_columns.hpp>
+
+namespace khronos {
+
+	namespace {
+		constexpr long long NANOSECONDS_PER_TICK = NANOSECONDS_PER_DAY / TICKS_PER_DAY;
+	}
+
+
+	void jd_to_hms(std::span<jd_t const> jds,
+		std::span<hour_t> hours, std::span<minute_t> minutes, std::span<int> seconds, std::span<int> nanoseconds) {
+		assert(hours.size() >= jds.size() && minutes.size() >= jds.size());
+		assert(seconds.size() >= jds.size() && nanoseconds.size() >= jds.size());
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			ns_to_hms(jd_to_ns(jds[i]), hours[i], minutes[i], seconds[i], nanoseconds[i]);
+	}
+
+
+	void ticks_to_hms(std::span<tick_t const> ticks,
+		std::span<hour_t> hours, std::span<minute_t> minutes, std::span<int> seconds, std::span<int> nanoseconds) {
+		assert(hours.size() >= ticks.size() && minutes.size() >= ticks.size());
+		assert(seconds.size() >= ticks.size() && nanoseconds.size() >= ticks.size());
+		// JD 0.0 is noon: shift by half a day so the day starts at midnight
+		for (std::size_t i = 0; i < ticks.size(); ++i) {
+			auto const tickOfDay = utility::floor_mod(ticks[i] + TICKS_PER_DAY / 2, TICKS_PER_DAY);
+			ns_to_hms(tickOfDay * NANOSECONDS_PER_TICK, hours[i], minutes[i], seconds[i], nanoseconds[i]);
+		}
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,533 @@
+/**	@file ephemeris.cpp
+	@date 2026-10-18
+
+	Sun and Moon ephemeris implementation.
+	*/
+
+#include <khronos/ephemeris.hpp>
+#include <khronos/astronomical_time.hpp>
+#include <khronos/calendar_traits.hpp>
+#include <khronos/hebrew_calendar.hpp>
+#include <khronos/islamic_calendar.hpp>
+#include <khronos/timeofday.hpp>
+#include <khronos/utility.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+namespace khronos {
+
+	namespace {
+		constexpr double DEG = std::numbers::pi / 180.0;
+		constexpr double EARTH_RADIUS_KM = 6'378.14;
+		constexpr jd_t NaN = std::numeric_limits<jd_t>::quiet_NaN();
+
+		/** Series are evaluated this many JDs at a time. */
+		constexpr std::size_t BLOCK = 64;
+
+		inline double norm360(double degrees) {
+			degrees = std::fmod(degrees, 360.0);
+			return degrees < 0.0 ? degrees + 360.0 : degrees;
+		}
+
+		inline double norm180(double degrees) {
+			degrees = norm360(degrees);
+			return degrees > 180.0 ? degrees - 360.0 : degrees;
+		}
+
+		inline jd_t to_tt(jd_t ut) {
+			return ut + delta_t(ut) / SECONDS_PER_DAY;
+		}
+
+
+
+		// SUN
+		// ----------------------------------------------------------------------------------
+
+		/** Meeus ch. 25, low accuracy: apparent longitude and radius vector. */
+		inline ecliptic_position sun_kernel(jd_t jde) {
+			double const T = julian_centuries(jde);
+			double const L0 = 280.466'46 + 36'000.769'83 * T + 0.000'303'2 * T * T;
+			double const M = (357.529'11 + 35'999.050'29 * T - 0.000'153'7 * T * T) * DEG;
+			double const e = 0.016'708'634 - 0.000'042'037 * T - 0.000'000'126'7 * T * T;
+			double const C = (1.914'602 - 0.004'817 * T - 0.000'014 * T * T) * std::sin(M)
+				+ (0.019'993 - 0.000'101 * T) * std::sin(2 * M)
+				+ 0.000'289 * std::sin(3 * M);
+			double const nu = M + C * DEG;
+			double const omega = (125.04 - 1'934.136 * T) * DEG;
+			return {
+				norm360(L0 + C - 0.005'69 - 0.004'78 * std::sin(omega)),
+				0.0,
+				1.000'001'018 * (1 - e * e) / (1 + e * std::cos(nu)) };
+		}
+
+
+
+		// MOON
+		// ----------------------------------------------------------------------------------
+
+		/** Periodic terms of the Moon's longitude (1e-6 degree) and distance (1e-3 km), Meeus table 47.A. */
+		struct longitude_term {
+			std::int8_t		d, m, mp, f;
+			std::int32_t	l, r;
+		};
+
+		constexpr longitude_term LONGITUDE_TERMS[] = {
+			{ 0, 0, 1, 0, 6'288'774, -20'905'355 },	{ 2, 0, -1, 0, 1'274'027, -3'699'111 },
+			{ 2, 0, 0, 0, 658'314, -2'955'968 },	{ 0, 0, 2, 0, 213'618, -569'925 },
+			{ 0, 1, 0, 0, -185'116, 48'888 },		{ 0, 0, 0, 2, -114'332, -3'149 },
+			{ 2, 0, -2, 0, 58'793, 246'158 },		{ 2, -1, -1, 0, 57'066, -152'138 },
+			{ 2, 0, 1, 0, 53'322, -170'733 },		{ 2, -1, 0, 0, 45'758, -204'586 },
+			{ 0, 1, -1, 0, -40'923, -129'620 },		{ 1, 0, 0, 0, -34'720, 108'743 },
+			{ 0, 1, 1, 0, -30'383, 104'755 },		{ 2, 0, 0, -2, 15'327, 10'321 },
+			{ 0, 0, 1, 2, -12'528, 0 },				{ 0, 0, 1, -2, 10'980, 79'661 },
+			{ 4, 0, -1, 0, 10'675, -34'782 },		{ 0, 0, 3, 0, 10'034, -23'210 },
+			{ 4, 0, -2, 0, 8'548, -21'636 },		{ 2, 1, -1, 0, -7'888, 24'208 },
+			{ 2, 1, 0, 0, -6'766, 30'824 },			{ 1, 0, -1, 0, -5'163, -8'379 },
+			{ 1, 1, 0, 0, 4'987, -16'675 },			{ 2, -1, 1, 0, 4'036, -12'831 },
+			{ 2, 0, 2, 0, 3'994, -10'445 },			{ 4, 0, 0, 0, 3'861, -11'650 },
+			{ 2, 0, -3, 0, 3'665, 14'403 },			{ 0, 1, -2, 0, -2'689, -7'003 },
+			{ 2, 0, -1, 2, -2'602, 0 },				{ 2, -1, -2, 0, 2'390, 10'056 },
+			{ 1, 0, 1, 0, -2'348, 6'322 },			{ 2, -2, 0, 0, 2'236, -9'884 },
+			{ 0, 1, 2, 0, -2'120, 5'751 },			{ 0, 2, 0, 0, -2'069, 0 },
+			{ 2, -2, -1, 0, 2'048, -4'950 },		{ 2, 0, 1, -2, -1'773, 4'130 },
+			{ 2, 0, 0, 2, -1'595, 0 },				{ 4, -1, -1, 0, 1'215, -3'958 },
+			{ 0, 0, 2, 2, -1'110, 0 },				{ 3, 0, -1, 0, -892, 3'258 },
+			{ 2, 1, 1, 0, -810, 2'616 },			{ 4, -1, -2, 0, 759, -1'897 },
+			{ 0, 2, -1, 0, -713, -2'117 },			{ 2, 2, -1, 0, -700, 2'354 },
+			{ 2, 1, -2, 0, 691, 0 },				{ 2, -1, 0, -2, 596, 0 },
+			{ 4, 0, 1, 0, 549, -1'423 },			{ 0, 0, 4, 0, 537, -1'117 },
+			{ 4, -1, 0, 0, 520, -1'571 },			{ 1, 0, -2, 0, -487, -1'739 },
+			{ 2, 1, 0, -2, -399, 0 },				{ 0, 0, 2, -2, -381, -4'421 },
+			{ 1, 1, 1, 0, 351, 0 },					{ 3, 0, -2, 0, -340, 0 },
+			{ 4, 0, -3, 0, 330, 0 },				{ 2, -1, 2, 0, 327, 0 },
+			{ 0, 2, 1, 0, -323, 1'165 },			{ 1, 1, -1, 0, 299, 0 },
+			{ 2, 0, 3, 0, 294, 0 },					{ 2, 0, -1, -2, 0, 8'752 },
+		};
+
+		/** Periodic terms of the Moon's latitude (1e-6 degree), Meeus table 47.B. */
+		struct latitude_term {
+			std::int8_t		d, m, mp, f;
+			std::int32_t	b;
+		};
+
+		constexpr latitude_term LATITUDE_TERMS[] = {
+			{ 0, 0, 0, 1, 5'128'122 },	{ 0, 0, 1, 1, 280'602 },	{ 0, 0, 1, -1, 277'693 },	{ 2, 0, 0, -1, 173'237 },
+			{ 2, 0, -1, 1, 55'413 },	{ 2, 0, -1, -1, 46'271 },	{ 2, 0, 0, 1, 32'573 },		{ 0, 0, 2, 1, 17'198 },
+			{ 2, 0, 1, -1, 9'266 },		{ 0, 0, 2, -1, 8'822 },		{ 2, -1, 0, -1, 8'216 },	{ 2, 0, -2, -1, 4'324 },
+			{ 2, 0, 1, 1, 4'200 },		{ 2, 1, 0, -1, -3'359 },	{ 2, -1, -1, 1, 2'463 },	{ 2, -1, 0, 1, 2'211 },
+			{ 2, -1, -1, -1, 2'065 },	{ 0, 1, -1, -1, -1'870 },	{ 4, 0, -1, -1, 1'828 },	{ 0, 1, 0, 1, -1'794 },
+			{ 0, 0, 0, 3, -1'749 },		{ 0, 1, -1, 1, -1'565 },	{ 1, 0, 0, 1, -1'491 },		{ 0, 1, 1, 1, -1'475 },
+			{ 0, 1, 1, -1, -1'410 },	{ 0, 1, 0, -1, -1'344 },	{ 1, 0, 0, -1, -1'335 },	{ 0, 0, 3, 1, 1'107 },
+			{ 4, 0, 0, -1, 1'021 },		{ 4, 0, -1, 1, 833 },		{ 0, 0, 1, -3, 777 },		{ 4, 0, -2, 1, 671 },
+			{ 2, 0, 0, -3, 607 },		{ 2, 0, 2, -1, 596 },		{ 2, -1, 1, -1, 491 },		{ 2, 0, -2, 1, -451 },
+			{ 0, 0, 3, -1, 439 },		{ 2, 0, 2, 1, 422 },		{ 2, 0, -3, -1, 421 },		{ 2, 1, -1, 1, -366 },
+			{ 2, 1, 0, 1, -351 },		{ 4, 0, 0, 1, 331 },		{ 2, -1, 1, 1, 315 },		{ 2, -2, 0, -1, 302 },
+			{ 0, 0, 1, 3, -283 },		{ 2, 1, 1, -1, -229 },		{ 1, 1, 0, -1, 223 },		{ 1, 1, 0, 1, 223 },
+			{ 0, 1, -2, -1, -220 },		{ 2, 1, -1, -1, -220 },		{ 1, 0, 1, 1, -185 },		{ 2, -1, -2, -1, 181 },
+			{ 0, 1, 2, 1, -177 },		{ 4, 0, -2, -1, 176 },		{ 4, -1, -1, -1, 166 },		{ 1, 0, 1, -1, -164 },
+			{ 4, 0, 1, -1, 132 },		{ 1, 0, -1, -1, -119 },		{ 4, -1, 0, -1, 115 },		{ 2, -2, 0, 1, 107 },
+		};
+
+
+		/** Meeus ch. 47 for up to BLOCK JDEs. */
+		void moon_block(jd_t const* jdes, std::size_t n, ecliptic_position* positions) {
+			assert(n <= BLOCK);
+			double T[BLOCK], Lp[BLOCK], D[BLOCK], M[BLOCK], Mp[BLOCK], F[BLOCK];
+			double E[3][BLOCK];		// E^|m| for the terms in M
+			double sumL[BLOCK], sumR[BLOCK], sumB[BLOCK];
+
+			for (std::size_t i = 0; i < n; ++i) {
+				double const t = julian_centuries(jdes[i]);
+				double const t2 = t * t, t3 = t2 * t, t4 = t3 * t;
+				T[i] = t;
+				Lp[i] = 218.316'447'7 + 481'267.881'234'21 * t - 0.001'578'6 * t2 + t3 / 538'841 - t4 / 65'194'000;
+				D[i] = (297.850'192'1 + 445'267.111'403'4 * t - 0.001'881'9 * t2 + t3 / 545'868 - t4 / 113'065'000) * DEG;
+				M[i] = (357.529'109'2 + 35'999.050'290'9 * t - 0.000'153'6 * t2 + t3 / 24'490'000) * DEG;
+				Mp[i] = (134.963'396'4 + 477'198.867'505'5 * t + 0.008'741'4 * t2 + t3 / 69'699 - t4 / 14'712'000) * DEG;
+				F[i] = (93.272'095'0 + 483'202.017'523'3 * t - 0.003'653'9 * t2 - t3 / 3'526'000 + t4 / 863'310'000) * DEG;
+				E[0][i] = 1.0;
+				E[1][i] = 1 - 0.002'516 * t - 0.000'007'4 * t2;
+				E[2][i] = E[1][i] * E[1][i];
+				sumL[i] = sumR[i] = sumB[i] = 0.0;
+			}
+
+			// one term across the block per pass
+			for (auto const& term : LONGITUDE_TERMS) {
+				double const* const e = E[std::abs(term.m)];
+				for (std::size_t i = 0; i < n; ++i) {
+					double const arg = term.d * D[i] + term.m * M[i] + term.mp * Mp[i] + term.f * F[i];
+					sumL[i] += term.l * e[i] * std::sin(arg);
+					sumR[i] += term.r * e[i] * std::cos(arg);
+				}
+			}
+			for (auto const& term : LATITUDE_TERMS) {
+				double const* const e = E[std::abs(term.m)];
+				for (std::size_t i = 0; i < n; ++i)
+					sumB[i] += term.b * e[i] * std::sin(term.d * D[i] + term.m * M[i] + term.mp * Mp[i] + term.f * F[i]);
+			}
+
+			for (std::size_t i = 0; i < n; ++i) {
+				double const t = T[i];
+				double const lp = Lp[i] * DEG;
+				double const A1 = (119.75 + 131.849 * t) * DEG;
+				double const A2 = (53.09 + 479'264.290 * t) * DEG;
+				double const A3 = (313.45 + 481'266.484 * t) * DEG;
+				sumL[i] += 3'958 * std::sin(A1) + 1'962 * std::sin(lp - F[i]) + 318 * std::sin(A2);
+				sumB[i] += -2'235 * std::sin(lp) + 382 * std::sin(A3) + 175 * std::sin(A1 - F[i]) + 175 * std::sin(A1 + F[i])
+					+ 127 * std::sin(lp - Mp[i]) - 115 * std::sin(lp + Mp[i]);
+
+				// nutation in longitude, principal terms
+				double const omega = (125.044'52 - 1'934.136'261 * t) * DEG;
+				double const Ls = (280.466'5 + 36'000.769'8 * t) * DEG;
+				double const dpsi = (-17.20 * std::sin(omega) - 1.32 * std::sin(2 * Ls) - 0.23 * std::sin(2 * lp) + 0.21 * std::sin(2 * omega)) / 3'600;
+
+				positions[i] = { norm360(Lp[i] + sumL[i] / 1e6 + dpsi), sumB[i] / 1e6, 385'000.56 + sumR[i] / 1e3 };
+			}
+		}
+
+
+
+		// NEW MOON
+		// ----------------------------------------------------------------------------------
+
+		/** Corrections to the mean new moon (days), Meeus ch. 49. */
+		struct phase_term {
+			double		coefficient;
+			std::int8_t	e;				// power of E
+			std::int8_t	m, mp, f, omega;
+		};
+
+		constexpr phase_term NEW_MOON_TERMS[] = {
+			{ -0.407'20, 0, 0, 1, 0, 0 },	{ 0.172'41, 1, 1, 0, 0, 0 },	{ 0.016'08, 0, 0, 2, 0, 0 },
+			{ 0.010'39, 0, 0, 0, 2, 0 },	{ 0.007'39, 1, -1, 1, 0, 0 },	{ -0.005'14, 1, 1, 1, 0, 0 },
+			{ 0.002'08, 2, 2, 0, 0, 0 },	{ -0.001'11, 0, 0, 1, -2, 0 },	{ -0.000'57, 0, 0, 1, 2, 0 },
+			{ 0.000'56, 1, 1, 2, 0, 0 },	{ -0.000'42, 0, 0, 3, 0, 0 },	{ 0.000'42, 1, 1, 0, 2, 0 },
+			{ 0.000'38, 1, 1, 0, -2, 0 },	{ -0.000'24, 1, -1, 2, 0, 0 },	{ -0.000'17, 0, 0, 0, 0, 1 },
+			{ -0.000'07, 0, 2, 1, 0, 0 },	{ 0.000'04, 0, 0, 2, -2, 0 },	{ 0.000'04, 0, 3, 0, 0, 0 },
+			{ 0.000'03, 0, 1, 1, -2, 0 },	{ 0.000'03, 0, 0, 2, 2, 0 },	{ -0.000'03, 0, 1, 1, 2, 0 },
+			{ 0.000'03, 0, -1, 1, 2, 0 },	{ -0.000'02, 0, -1, 1, -2, 0 },	{ -0.000'02, 0, 1, 3, 0, 0 },
+			{ 0.000'02, 0, 0, 4, 0, 0 },
+		};
+
+		/** Planetary arguments: degrees, degrees per lunation, and the coefficient (days). */
+		struct planetary_term {
+			double	base, rate, coefficient;
+		};
+
+		constexpr planetary_term PLANETARY_TERMS[] = {
+			{ 299.77, 0.107'408, 0.000'325 },	{ 251.88, 0.016'321, 0.000'165 },	{ 251.83, 26.651'886, 0.000'164 },
+			{ 349.42, 36.412'478, 0.000'126 },	{ 84.66, 18.206'239, 0.000'110 },	{ 141.74, 53.303'771, 0.000'062 },
+			{ 207.14, 2.453'732, 0.000'060 },	{ 154.84, 7.306'860, 0.000'056 },	{ 34.52, 27.261'239, 0.000'047 },
+			{ 207.19, 0.121'824, 0.000'042 },	{ 291.34, 1.844'379, 0.000'040 },	{ 161.72, 24.198'154, 0.000'037 },
+			{ 239.56, 25.513'099, 0.000'035 },	{ 331.55, 3.592'518, 0.000'023 },
+		};
+
+
+		/** New moons of lunations first, first + 1, ... for up to BLOCK lunations. */
+		void new_moon_block(long long first, std::size_t n, jd_t* jdes) {
+			assert(n <= BLOCK);
+			double K[BLOCK], T2[BLOCK], M[BLOCK], Mp[BLOCK], F[BLOCK], Omega[BLOCK];
+			double E[3][BLOCK];
+
+			for (std::size_t i = 0; i < n; ++i) {
+				double const k = static_cast<double>(first + static_cast<long long>(i));
+				double const t = k / 1'236.85;
+				double const t2 = t * t, t3 = t2 * t, t4 = t3 * t;
+				K[i] = k;
+				T2[i] = t2;
+				jdes[i] = 2'451'550.097'66 + SYNODIC_MONTH * k + 0.000'154'37 * t2 - 0.000'000'150 * t3 + 0.000'000'000'73 * t4;
+				M[i] = (2.553'4 + 29.105'356'70 * k - 0.000'001'4 * t2 - 0.000'000'11 * t3) * DEG;
+				Mp[i] = (201.564'3 + 385.816'935'28 * k + 0.010'758'2 * t2 + 0.000'012'38 * t3 - 0.000'000'058 * t4) * DEG;
+				F[i] = (160.710'8 + 390.670'502'84 * k - 0.001'611'8 * t2 - 0.000'002'27 * t3 + 0.000'000'011 * t4) * DEG;
+				Omega[i] = (124.774'6 - 1.563'755'88 * k + 0.002'067'2 * t2 + 0.000'002'15 * t3) * DEG;
+				E[0][i] = 1.0;
+				E[1][i] = 1 - 0.002'516 * t - 0.000'007'4 * t2;
+				E[2][i] = E[1][i] * E[1][i];
+			}
+
+			for (auto const& term : NEW_MOON_TERMS) {
+				double const* const e = E[term.e];
+				for (std::size_t i = 0; i < n; ++i)
+					jdes[i] += term.coefficient * e[i] * std::sin(term.m * M[i] + term.mp * Mp[i] + term.f * F[i] + term.omega * Omega[i]);
+			}
+			for (std::size_t j = 0; j < std::size(PLANETARY_TERMS); ++j) {
+				auto const& term = PLANETARY_TERMS[j];
+				double const quadratic = j == 0 ? -0.009'173 : 0.0;
+				for (std::size_t i = 0; i < n; ++i)
+					jdes[i] += term.coefficient * std::sin((term.base + term.rate * K[i] + quadratic * T2[i]) * DEG);
+			}
+		}
+
+
+
+		// RISING AND SETTING
+		// ----------------------------------------------------------------------------------
+
+		struct equatorial {
+			double	ra;		// degrees
+			double	dec;	// degrees
+		};
+
+		/** Equatorial coordinates of an ecliptic position at 'jde'. */
+		equatorial to_equatorial(ecliptic_position const& p, jd_t jde) {
+			double const T = julian_centuries(jde);
+			double const omega = (125.04 - 1'934.136 * T) * DEG;
+			double const epsilon = (23.439'291'1 - 0.013'004'2 * T - 1.64e-7 * T * T + 5.04e-7 * T * T * T + 0.002'56 * std::cos(omega)) * DEG;
+			double const lambda = p.longitude * DEG, beta = p.latitude * DEG;
+			return {
+				norm360(std::atan2(std::sin(lambda) * std::cos(epsilon) - std::tan(beta) * std::sin(epsilon), std::cos(lambda)) / DEG),
+				std::asin(std::sin(beta) * std::cos(epsilon) + std::cos(beta) * std::sin(epsilon) * std::sin(lambda)) / DEG };
+		}
+
+		/** Local hour angle of a body at 'ut', degrees (-180..180]. */
+		double hour_angle(equatorial const& eq, jd_t ut, geo_location const& site) {
+			return norm180(gmst(ut) + site.longitude - eq.ra);
+		}
+
+		double altitude(equatorial const& eq, double hourAngle, geo_location const& site) {
+			double const phi = site.latitude * DEG, dec = eq.dec * DEG;
+			return std::asin(std::sin(phi) * std::sin(dec) + std::cos(phi) * std::cos(dec) * std::cos(hourAngle * DEG)) / DEG;
+		}
+
+
+		/** Where a body is, and the altitude it rises and sets at. */
+		struct sky_position {
+			equatorial	eq;
+			double		horizon;	// degrees
+		};
+
+		sky_position sun_sky(jd_t ut) {
+			jd_t const jde = to_tt(ut);
+			return { to_equatorial(sun_kernel(jde), jde), SUNSET_ALTITUDE };
+		}
+
+		sky_position moon_sky(jd_t ut) {
+			jd_t const jde = to_tt(ut);
+			ecliptic_position p;
+			moon_block(&jde, 1, &p);
+			double const parallax = std::asin(EARTH_RADIUS_KM / p.distance) / DEG;
+			return { to_equatorial(p, jde), 0.727'5 * parallax - 0.566'7 };
+		}
+
+		/**	The rising ('direction' = -1) or setting (+1) nearest 't', found by moving to where
+			the hour angle reaches the horizon's; 'rate' is the body's hour angle in degrees per day.
+			*/
+		template <typename Sky>
+		jd_t nearest_horizon_crossing(jd_t t, geo_location const& site, int direction, double rate, Sky sky) {
+			double const phi = site.latitude * DEG;
+			for (int iteration = 0; iteration < 10; ++iteration) {
+				sky_position const s = sky(t);
+				double const dec = s.eq.dec * DEG;
+				double const cosH0 = (std::sin(s.horizon * DEG) - std::sin(phi) * std::sin(dec)) / (std::cos(phi) * std::cos(dec));
+				if (!(std::abs(cosH0) <= 1.0))
+					return NaN;
+				double const H0 = direction * std::acos(cosH0) / DEG;
+				double const step = norm180(H0 - hour_angle(s.eq, t, site)) / rate;
+				t += step;
+				if (std::abs(step) < 1e-6)		// a tenth of a second
+					break;
+			}
+			return t;
+		}
+
+		constexpr double SUN_HOUR_RATE = 360.0;
+		constexpr double MOON_HOUR_RATE = 347.8;
+
+		/** UT of local mean noon on the date of 'day'. */
+		inline jd_t local_noon(jd_t day, geo_location const& site) {
+			return jd_to_jdn(day) - site.longitude / 360.0;
+		}
+	}
+
+
+
+	// TIME SCALES
+	// --------------------------------------------------------------------------------------
+
+	double delta_t(jd_t jd) {
+		double const u = (jd - 2'385'800.5) / 36'524.25;	// centuries from 1820
+		return -20.0 + 32.0 * u * u;
+	}
+
+
+
+	// POSITIONS
+	// --------------------------------------------------------------------------------------
+
+	ecliptic_position sun_position(jd_t jde) {
+		return sun_kernel(jde);
+	}
+
+
+	ecliptic_position moon_position(jd_t jde) {
+		ecliptic_position p;
+		moon_block(&jde, 1, &p);
+		return p;
+	}
+
+
+	void sun_positions(std::span<jd_t const> jdes, std::span<ecliptic_position> positions) {
+		assert(positions.size() >= jdes.size());
+		for (std::size_t i = 0; i < jdes.size(); ++i)
+			positions[i] = sun_kernel(jdes[i]);
+	}
+
+
+	void moon_positions(std::span<jd_t const> jdes, std::span<ecliptic_position> positions) {
+		assert(positions.size() >= jdes.size());
+		for (std::size_t first = 0; first < jdes.size(); first += BLOCK)
+			moon_block(jdes.data() + first, std::min(BLOCK, jdes.size() - first), positions.data() + first);
+	}
+
+
+
+	// NEW MOONS
+	// --------------------------------------------------------------------------------------
+
+	jd_t new_moon(long long lunation) {
+		jd_t jde;
+		new_moon_block(lunation, 1, &jde);
+		return jde;
+	}
+
+
+	void new_moons(long long firstLunation, std::span<jd_t> jdes) {
+		for (std::size_t first = 0; first < jdes.size(); first += BLOCK)
+			new_moon_block(firstLunation + static_cast<long long>(first), std::min(BLOCK, jdes.size() - first), jdes.data() + first);
+	}
+
+
+	long long lunation_of(jd_t jde) {
+		// true new moons stray less than a day from the mean: the estimate is at most one out
+		auto k = static_cast<long long>(std::floor((jde - 2'451'550.097'66) / SYNODIC_MONTH));
+		while (new_moon(k) > jde)
+			--k;
+		while (new_moon(k + 1) <= jde)
+			++k;
+		return k;
+	}
+
+
+	jd_t hebrew_molad(year_t year, month_t month) {
+		// Tishri 1 AM was a Monday; its molad (BaHaRaD) was 11 hours 204 parts after noon on the Sunday
+		jd_t const sundayNoon = hebrew_to_jd(1, 7, 1) - 0.5;
+		long long const months = hebrew_months_elapsed(year) + calendar_traits<Hebrew>::month_ordinal(year, month);
+		long long const parts = 12'084 + 13'753 * months;		// 25,920 parts to a day; a month is 29 days 13,753 parts
+		return sundayNoon + static_cast<jd_t>(29 * months + utility::floor_div(parts, 25'920))
+			+ static_cast<jd_t>(utility::floor_mod(parts, 25'920)) / 25'920.0;
+	}
+
+
+
+	// RISING AND SETTING
+	// --------------------------------------------------------------------------------------
+
+	jd_t sunrise(jd_t day, geo_location const& site) {
+		return nearest_horizon_crossing(local_noon(day, site) - 0.25, site, -1, SUN_HOUR_RATE, sun_sky);
+	}
+
+
+	jd_t sunset(jd_t day, geo_location const& site) {
+		return nearest_horizon_crossing(local_noon(day, site) + 0.25, site, +1, SUN_HOUR_RATE, sun_sky);
+	}
+
+
+	jd_t moonset(jd_t jd, geo_location const& site) {
+		return nearest_horizon_crossing(jd, site, +1, MOON_HOUR_RATE, moon_sky);
+	}
+
+
+	void sunsets(std::span<jd_t const> days, geo_location const& site, std::span<jd_t> jds) {
+		assert(jds.size() >= days.size());
+		for (std::size_t i = 0; i < days.size(); ++i)
+			jds[i] = sunset(days[i], site);
+	}
+
+
+	jd_t sunset_date(jd_t jd, geo_location const& site) {
+		jd_t const localDate = jd_to_jdn(jd + site.longitude / 360.0);
+		return jd >= sunset(localDate, site) ? localDate + 0.5 : localDate - 0.5;
+	}
+
+
+
+	// CRESCENT
+	// --------------------------------------------------------------------------------------
+
+	crescent_observation observe_crescent(jd_t day, geo_location const& site) {
+		crescent_observation obs{ sunset(day, site), NaN, NaN, NaN, NaN, NaN, NaN, crescent_visibility::not_visible };
+		if (std::isnan(obs.sunset))
+			return obs;
+		obs.moonset = moonset(obs.sunset, site);
+		if (!(obs.moonset > obs.sunset))
+			return obs;
+
+		// Yallop (1997), at the best time
+		obs.best_time = obs.sunset + 4.0 / 9.0 * (obs.moonset - obs.sunset);
+		jd_t const jde = to_tt(obs.best_time);
+		ecliptic_position const sun = sun_kernel(jde);
+		ecliptic_position moon;
+		moon_block(&jde, 1, &moon);
+		equatorial const sunEq = to_equatorial(sun, jde), moonEq = to_equatorial(moon, jde);
+		double const sunAltitude = altitude(sunEq, hour_angle(sunEq, obs.best_time, site), site);
+		double const moonAltitude = altitude(moonEq, hour_angle(moonEq, obs.best_time, site), site);
+
+		obs.arcl = std::acos(std::cos(moon.latitude * DEG) * std::cos((moon.longitude - sun.longitude) * DEG)) / DEG;
+		obs.arcv = moonAltitude - sunAltitude;
+		double const parallax = std::asin(EARTH_RADIUS_KM / moon.distance);
+		double const semidiameter = 0.272'45 * parallax / DEG * 60.0 * (1 + std::sin(moonAltitude * DEG) * std::sin(parallax));
+		double const w = obs.width = semidiameter * (1 - std::cos(obs.arcl * DEG));
+		obs.q = (obs.arcv - (11.837'1 - 6.322'6 * w + 0.731'9 * w * w - 0.101'8 * w * w * w)) / 10.0;
+
+		obs.visibility = obs.q > 0.216 ? crescent_visibility::easily_visible
+			: obs.q > -0.014 ? crescent_visibility::perfect_conditions
+			: obs.q > -0.160 ? crescent_visibility::optical_aid_to_find
+			: obs.q > -0.232 ? crescent_visibility::optical_aid_only
+			: obs.q > -0.293 ? crescent_visibility::below_telescope
+			: crescent_visibility::not_visible;
+		return obs;
+	}
+
+
+	jd_t observed_month_start(long long lunation, geo_location const& site, crescent_visibility required) {
+		jd_t const conjunction = new_moon(lunation);
+		jd_t const conjunctionUt = conjunction - delta_t(conjunction) / SECONDS_PER_DAY;
+		jd_t const date = jd_to_jdn(conjunctionUt + site.longitude / 360.0);
+		for (int evening = 0; evening < 3; ++evening) {
+			crescent_observation const obs = observe_crescent(date + evening, site);
+			if (obs.sunset > conjunctionUt && obs.visibility <= required)
+				return date + evening + 0.5;
+		}
+		return date + 2.5;
+	}
+
+
+	islamic_month_table observed_islamic_months(year_t firstYear, year_t lastYear, geo_location const& site, crescent_visibility required) {
+		if (lastYear < firstYear)
+			throw std::invalid_argument("observed_islamic_months: no years");
+
+		// the conjunction is a day or two before the arithmetic calendar's month
+		auto lunation = static_cast<long long>(std::llround((islamic_to_jd(firstYear, 1, 1) - new_moon(0)) / SYNODIC_MONTH));
+		jd_t const firstDay = observed_month_start(lunation, site, required);
+
+		std::vector<std::uint16_t> months(static_cast<std::size_t>(lastYear - firstYear + 1));
+		jd_t start = firstDay;
+		for (auto& bits : months)
+			for (int m = 0; m < 12; ++m) {
+				jd_t const next = observed_month_start(++lunation, site, required);
+				bool const thirty = next - start > 29.5;
+				bits |= static_cast<std::uint16_t>(thirty) << m;
+				start += thirty ? 30 : 29;
+			}
+		return islamic_month_table(firstYear, firstDay, months);
+	}
+
+} // end-of-namespace khronos
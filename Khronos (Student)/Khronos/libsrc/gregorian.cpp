@@ -6,7 +6,9 @@
 	*/
 
 #include <khronos/gregorian_calendar.hpp>
+#include <khronos/week.hpp>
 #include <khronos/timeofday.hpp>
+#include <khronos/instrument.hpp>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
@@ -15,6 +17,7 @@ namespace khronos {
 
 	// Helper function to convert JD to Gregorian date
 	void Gregorian::from_jd(jd_t jd) {
+		KHRONOS_PROBE(Gregorian_from_jd);
 		jd_to_gregorian(jd, year_, month_, day_, hour_, minute_, second_);
 	}
 
@@ -73,6 +76,7 @@ namespace khronos {
 
 	// Convert to Julian Day
 	jd_t Gregorian::to_jd() const {
+		KHRONOS_PROBE(Gregorian_to_jd);
 		return gregorian_to_jd(year_, month_, day_, hour_, minute_, second_);
 	}
 
@@ -84,6 +88,7 @@ namespace khronos {
 
 	// Add years (orbital period)
 	Gregorian& Gregorian::operator+=(detail::packaged_year_real const& year) {
+		KHRONOS_PROBE(Gregorian_add_years);
 		// Handle whole years
 		long long whole_years = static_cast<long long>(year.value);
 		year_ += whole_years;
@@ -105,6 +110,7 @@ namespace khronos {
 
 	// Add months
 	Gregorian& Gregorian::operator+=(detail::packaged_month_integer const& month) {
+		KHRONOS_PROBE(Gregorian_add_months);
 		int total_months = month_ + month.value;
 
 		// Calculate new year and month
@@ -149,13 +155,30 @@ namespace khronos {
 		return *this + detail::packaged_month_integer(-month.value);
 	}
 
+	// Calendar positions
+	day_t Gregorian::day_of_week() const {
+		return khronos::day_of_week<Gregorian>(year_, month_, day_);
+	}
+
+	day_t Gregorian::day_of_year() const {
+		return khronos::day_of_year<Gregorian>(year_, month_, day_);
+	}
+
+	int Gregorian::week_of_year() const {
+		return khronos::week_of_year<Gregorian>(year_, month_, day_);
+	}
+
+	iso_week_date Gregorian::iso_week() const {
+		return khronos::iso_week(year_, month_, day_);
+	}
+
 	// to_string method
 	std::string Gregorian::to_string() const {
+		KHRONOS_PROBE(Gregorian_to_string);
 		std::ostringstream oss;
 
 		// Get day of week
-		jd_t jd = to_jd();
-		int dow = static_cast<int>(utility::jwday(jd));
+		int dow = day_of_week();
 
 		// Day of week name
 		oss << civil::day_name(dow) << ", ";
@@ -9,6 +9,8 @@ Khronos library 'gregorian::to_jdn' implementation.
 
 #include <khronos/gregorian_calendar.hpp>
 #include <khronos/timeofday.hpp>
+#include <khronos/instrument.hpp>
+#include <khronos/utility.hpp>
 #include <cmath>
 
 namespace khronos {
@@ -22,13 +24,15 @@ namespace khronos {
 	 * @return Julian Day Number at noon of the given date
 	 */
 	jd_t gregorian_to_jd(year_t year, month_t month, day_t day) {
+		KHRONOS_PROBE(gregorian_to_jd);
 		// Adjust the month and year for the algorithm
 		long long a = (14 - month) / 12;
 		long long y = year + 4800 - a;
 		long long m = month + 12 * a - 3;
 
-		// Calculate Julian Day Number (at noon, hence the .5)
-		long long jdn = day + (153 * m + 2) / 5 + 365 * y + y / 4 - y / 100 + y / 400 - 32045;
+		// Calculate Julian Day Number (at noon, hence the .5); floored division keeps years before -4800 correct
+		using utility::floor_div;
+		long long jdn = day + (153 * m + 2) / 5 + 365 * y + floor_div(y, 4) - floor_div(y, 100) + floor_div(y, 400) - 32045;
 
 		return static_cast<jd_t>(jdn) - 0.5;  // JD 0 is at noon, so subtract 0.5 for midnight
 	}
@@ -45,6 +49,7 @@ namespace khronos {
 	 */
 	jd_t gregorian_to_jd(year_t year, month_t month, day_t day,
 		hour_t hour, minute_t minute, second_t second) {
+		KHRONOS_PROBE(gregorian_to_jd_hms);
 		jd_t jd = gregorian_to_jd(year, month, day);
 
 		// Add the time of day as a fraction
@@ -6,8 +6,10 @@
 	*/
 
 #include <khronos/hebrew_calendar.hpp>
+#include <khronos/week.hpp>
 #include <khronos/gregorian_calendar.hpp>
 #include <khronos/timeofday.hpp>
+#include <khronos/instrument.hpp>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
@@ -15,6 +17,7 @@
 namespace khronos {
 
 	void Hebrew::from_jd(jd_t jd) {
+		KHRONOS_PROBE(Hebrew_from_jd);
 		jd_to_hebrew(jd, year_, month_, day_, hour_, minute_, second_);
 	}
 
@@ -77,6 +80,7 @@ namespace khronos {
 	}
 
 	jd_t Hebrew::to_jd() const {
+		KHRONOS_PROBE(Hebrew_to_jd);
 		return hebrew_to_jd(year_, month_, day_, hour_, minute_, second_);
 	}
 
@@ -86,9 +90,19 @@ namespace khronos {
 	}
 
 	Hebrew& Hebrew::operator+=(detail::packaged_year_real const& year) {
+		KHRONOS_PROBE(Hebrew_add_years);
 		long long whole_years = static_cast<long long>(year.value);
 		year_ += whole_years;
 
+		// Adar II becomes Adar in a common year, and the day is clamped to the month's length
+		if (month_ == 13 && !is_hebrew_leapyear(year_)) {
+			month_ = 12;
+		}
+		int max_day = hebrew_days_in_month(month_, year_);
+		if (day_ > max_day) {
+			day_ = max_day;
+		}
+
 		double fractional_years = year.value - whole_years;
 		if (fractional_years != 0.0) {
 			jd_t jd = to_jd() + fractional_years * EARTH_ORBITAL_PERIOD_DAYS;
@@ -99,22 +113,16 @@ namespace khronos {
 	}
 
 	Hebrew& Hebrew::operator+=(detail::packaged_month_integer const& month) {
-		int total_months = month_ + month.value;
-		int months_in_year = hebrew_year_months(year_);
-
-		while (total_months > months_in_year) {
-			total_months -= months_in_year;
-			year_++;
-			months_in_year = hebrew_year_months(year_);
-		}
+		KHRONOS_PROBE(Hebrew_add_months);
+		// Months are counted from Tishri (7), where the year begins; Nisan (1) to Elul (6) close the year
+		long long months_in_year = hebrew_year_months(year_);
+		long long since_tishri = month_ >= 7 ? month_ - 7 : month_ + months_in_year - 7;
+		long long total_months = hebrew_months_elapsed(year_) + since_tishri + month.value;
 
-		while (total_months < 1) {
-			year_--;
-			months_in_year = hebrew_year_months(year_);
-			total_months += months_in_year;
-		}
-
-		month_ = static_cast<month_t>(total_months);
+		year_ = hebrew_year_of_month(total_months);
+		since_tishri = total_months - hebrew_months_elapsed(year_);
+		months_in_year = hebrew_year_months(year_);
+		month_ = static_cast<month_t>(since_tishri < months_in_year - 6 ? since_tishri + 7 : since_tishri - (months_in_year - 7));
 
 		int max_day = hebrew_days_in_month(month_, year_);
 		if (day_ > max_day) {
@@ -140,11 +148,24 @@ namespace khronos {
 		return *this + detail::packaged_month_integer(-month.value);
 	}
 
+	// Calendar positions
+	day_t Hebrew::day_of_week() const {
+		return khronos::day_of_week<Hebrew>(year_, month_, day_);
+	}
+
+	day_t Hebrew::day_of_year() const {
+		return khronos::day_of_year<Hebrew>(year_, month_, day_);
+	}
+
+	int Hebrew::week_of_year() const {
+		return khronos::week_of_year<Hebrew>(year_, month_, day_);
+	}
+
 	std::string Hebrew::to_string() const {
+		KHRONOS_PROBE(Hebrew_to_string);
 		std::ostringstream oss;
 
-		jd_t jd = to_jd();
-		int dow = static_cast<int>(utility::jwday(jd));
+		int dow = day_of_week();
 
 		oss << civil::day_name(dow) << ", ";
 		oss << hebrew_month_name(month_, year_) << " ";
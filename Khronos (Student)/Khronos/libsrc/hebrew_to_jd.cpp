@@ -7,23 +7,28 @@
 
 #include <khronos/hebrew_calendar.hpp>
 #include <khronos/timeofday.hpp>
+#include <khronos/instrument.hpp>
+#include <khronos/utility.hpp>
 #include <cmath>
 
 namespace khronos {
 
 	// Hebrew calendar helper functions
 	long long hebrew_delay_1(year_t year) {
-		long long months = ((235 * year - 234) / 19);
+		KHRONOS_PROBE(hebrew_delay_1);
+		using utility::floor_div;
+		long long months = floor_div(235 * year - 234, 19);
 		long long parts = 12084 + 13753 * months;
-		long long day = months * 29 + parts / 25920;
+		long long day = months * 29 + floor_div(parts, 25920);
 
-		if ((3 * (day + 1)) % 7 < 3) {
+		if (utility::floor_mod(3 * (day + 1), 7) < 3) {
 			day++;
 		}
 		return day;
 	}
 
 	long long hebrew_delay_2(year_t year) {
+		KHRONOS_PROBE(hebrew_delay_2);
 		long long last = hebrew_delay_1(year - 1);
 		long long present = hebrew_delay_1(year);
 		long long next = hebrew_delay_1(year + 1);
@@ -38,7 +43,8 @@ namespace khronos {
 	}
 
 	long long hebrew_year_days(year_t year) {
-		return hebrew_delay_1(year + 1) - hebrew_delay_1(year);
+		KHRONOS_PROBE(hebrew_year_days);
+		return hebrew_delay_1(year + 1) + hebrew_delay_2(year + 1) - hebrew_delay_1(year) - hebrew_delay_2(year);
 	}
 
 	long long hebrew_year_months(year_t year) {
@@ -46,8 +52,8 @@ namespace khronos {
 	}
 
 	day_t hebrew_days_in_month(month_t month, year_t year) {
+		KHRONOS_PROBE(hebrew_days_in_month);
 		bool is_leap = is_hebrew_leapyear(year);
-		long long year_length = hebrew_year_days(year);
 
 		switch (month) {
 		case 1:  // Nisan
@@ -62,9 +68,14 @@ namespace khronos {
 		case 10: // Tevet
 			return 29;
 		case 8:  // Cheshvan
-			return (year_length == 355 || year_length == 385) ? 30 : 29;
 		case 9:  // Kislev
+		{
+			// only these depend on the length of the year
+			long long year_length = hebrew_year_days(year);
+			if (month == 8)
+				return (year_length == 355 || year_length == 385) ? 30 : 29;
 			return (year_length == 353 || year_length == 383) ? 29 : 30;
+		}
 		case 12: // Adar (or Adar I in leap years)
 			return is_leap ? 30 : 29;
 		case 13: // Adar II (only in leap years)
@@ -89,27 +100,31 @@ namespace khronos {
 	}
 
 	jd_t hebrew_to_jd(year_t year, month_t month, day_t day) {
-		long long months_elapsed;
+		KHRONOS_PROBE(hebrew_to_jd);
+		// The year begins with Tishri (7); Nisan (1) to Elul (6) follow the last month
+		long long days_elapsed = 0;
 		if (month < 7) {
-			months_elapsed = month - 1;
 			for (int m = 7; m <= hebrew_year_months(year); ++m) {
-				months_elapsed += hebrew_days_in_month(m, year);
+				days_elapsed += hebrew_days_in_month(m, year);
+			}
+			for (int m = 1; m < month; ++m) {
+				days_elapsed += hebrew_days_in_month(m, year);
 			}
 		}
 		else {
-			months_elapsed = 0;
 			for (int m = 7; m < month; ++m) {
-				months_elapsed += hebrew_days_in_month(m, year);
+				days_elapsed += hebrew_days_in_month(m, year);
 			}
 		}
 
-		long long day_of_year = hebrew_delay_1(year) + hebrew_delay_2(year) + months_elapsed + day;
+		long long day_of_year = hebrew_delay_1(year) + hebrew_delay_2(year) + days_elapsed + day;
 
-		return HEBREW_EPOCH + day_of_year - 1;
+		return HEBREW_EPOCH + day_of_year + 1;
 	}
 
 	jd_t hebrew_to_jd(year_t year, month_t month, day_t day,
 		hour_t hour, minute_t minute, second_t second) {
+		KHRONOS_PROBE(hebrew_to_jd_hms);
 		jd_t jd = hebrew_to_jd(year, month, day);
 		jd += tod(hour, minute, second);
 		return jd;
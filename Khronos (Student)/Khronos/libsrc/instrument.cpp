@@ -0,0 +1,119 @@
+/**	@file instrument.cpp
+	@date 2026-10-18
+
+	Khronos library hot-path instrumentation implementation.
+	*/
+
+#include <khronos/instrument.hpp>
+
+#if defined(KHRONOS_INSTRUMENT)
+
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace khronos {
+
+	namespace instrument {
+
+		namespace {
+			/** Live threads' slots, and the totals of threads that have exited. */
+			struct registry {
+				std::mutex							mutex;
+				std::vector<detail::thread_slots*>	threads;
+				snapshot_type						retired{};
+			};
+
+			registry& the_registry() {
+				static registry* r = new registry;	// never destroyed: threads may exit after static destruction
+				return *r;
+			}
+		}
+
+
+
+		detail::thread_slots::thread_slots() {
+			auto& r = the_registry();
+			std::lock_guard lock(r.mutex);
+			r.threads.push_back(this);
+		}
+
+
+
+		detail::thread_slots::~thread_slots() {
+			auto& r = the_registry();
+			std::lock_guard lock(r.mutex);
+			for (std::size_t p = 0; p < PROBE_COUNT; ++p) {
+				r.retired[p].calls += slots[p].calls.load(std::memory_order_relaxed);
+				r.retired[p].ticks += slots[p].ticks.load(std::memory_order_relaxed);
+			}
+			r.threads.erase(std::find(r.threads.begin(), r.threads.end(), this));
+		}
+
+
+
+		char const* probe_name(probe p) {
+			static char const* const names[PROBE_COUNT] = {
+#define KHRONOS_PROBE_NAME(name) #name,
+				KHRONOS_PROBES(KHRONOS_PROBE_NAME)
+#undef KHRONOS_PROBE_NAME
+			};
+			return names[static_cast<std::size_t>(p)];
+		}
+
+
+
+		snapshot_type snapshot() {
+			auto& r = the_registry();
+			std::lock_guard lock(r.mutex);
+			snapshot_type totals = r.retired;
+			for (auto block : r.threads)
+				for (std::size_t p = 0; p < PROBE_COUNT; ++p) {
+					totals[p].calls += block->slots[p].calls.load(std::memory_order_relaxed);
+					totals[p].ticks += block->slots[p].ticks.load(std::memory_order_relaxed);
+				}
+			return totals;
+		}
+
+
+
+		void reset() {
+			auto& r = the_registry();
+			std::lock_guard lock(r.mutex);
+			r.retired = snapshot_type{};
+			for (auto block : r.threads)
+				for (auto& s : block->slots) {
+					s.calls.store(0, std::memory_order_relaxed);
+					s.ticks.store(0, std::memory_order_relaxed);
+				}
+		}
+
+
+
+		void dump(std::ostream& os, snapshot_type const& totals) {
+			auto const flags = os.flags();
+			os << std::left << std::setw(24) << "probe" << std::right << std::setw(16) << "calls" << std::setw(20) << "ticks" << std::setw(14) << "ticks/call" << '\n';
+			for (std::size_t p = 0; p < PROBE_COUNT; ++p) {
+				if (totals[p].calls == 0)
+					continue;
+				os << std::left << std::setw(24) << probe_name(static_cast<probe>(p)) << std::right
+					<< std::setw(16) << totals[p].calls
+					<< std::setw(20) << totals[p].ticks
+					<< std::setw(14) << std::fixed << std::setprecision(1) << double(totals[p].ticks) / double(totals[p].calls) << '\n';
+			}
+			os.flags(flags);
+		}
+
+
+
+		void dump(std::ostream& os) {
+			dump(os, snapshot());
+		}
+
+	} // end-of-namespace instrument
+
+} // end-of-namespace khronos
+
+#endif
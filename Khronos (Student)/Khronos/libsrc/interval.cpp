@@ -0,0 +1,192 @@
+/**	@file interval.cpp
+	@date 2026-10-18
+
+	Interval set implementation.
+	*/
+
+#include <khronos/interval.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+namespace khronos {
+
+	namespace {
+		/** Builds a set from intervals appended in order of start, coalescing those that touch. */
+		struct set_builder {
+			std::vector<tick_t>& starts;
+			std::vector<tick_t>& ends;
+
+			void push(tick_t start, tick_t end) {
+				if (end <= start)
+					return;
+				if (!ends.empty() && start <= ends.back()) {
+					ends.back() = std::max(ends.back(), end);
+					return;
+				}
+				starts.push_back(start);
+				ends.push_back(end);
+			}
+		};
+	}
+
+
+
+	// CONSTRUCTION
+	// --------------------------------------------------------------------------------------
+
+	interval_set::interval_set(std::span<jd_interval const> intervals) {
+		std::vector<jd_interval> sorted(intervals.begin(), intervals.end());
+		std::ranges::sort(sorted, {}, &jd_interval::start);
+		starts_.reserve(sorted.size());
+		ends_.reserve(sorted.size());
+		set_builder out{ starts_, ends_ };
+		for (auto const& interval : sorted)
+			out.push(interval.start, interval.end);
+	}
+
+
+	void interval_set::insert(jd_interval const& interval) {
+		if (interval.empty())
+			return;
+		// [first, last) are the intervals touching 'interval'
+		auto const first = static_cast<std::size_t>(std::ranges::lower_bound(ends_, interval.start) - ends_.begin());
+		auto const last = starting_by(interval.end);
+		if (first == last) {
+			starts_.insert(starts_.begin() + first, interval.start);
+			ends_.insert(ends_.begin() + first, interval.end);
+			return;
+		}
+		starts_[first] = std::min(starts_[first], interval.start);
+		ends_[first] = std::max(ends_[last - 1], interval.end);
+		starts_.erase(starts_.begin() + first + 1, starts_.begin() + last);
+		ends_.erase(ends_.begin() + first + 1, ends_.begin() + last);
+	}
+
+
+
+	// QUERIES
+	// --------------------------------------------------------------------------------------
+
+	std::size_t interval_set::starting_by(tick_t t) const {
+		std::size_t n = starts_.size();
+		if (n == 0)
+			return 0;
+		// halve the range with a conditional move rather than a branch
+		tick_t const* base = starts_.data();
+		while (n > 1) {
+			std::size_t const half = n / 2;
+			base = base[half] <= t ? base + half : base;
+			n -= half;
+		}
+		return static_cast<std::size_t>(base - starts_.data()) + (*base <= t);
+	}
+
+
+	tick_t interval_set::length() const {
+		tick_t total = 0;
+		for (std::size_t i = 0; i < starts_.size(); ++i)
+			total += ends_[i] - starts_[i];
+		return total;
+	}
+
+
+	bool interval_set::contains(tick_t t) const {
+		std::size_t const i = starting_by(t);
+		return i != 0 && t < ends_[i - 1];
+	}
+
+
+	bool interval_set::contains(jd_interval const& interval) const {
+		if (interval.empty())
+			return true;
+		std::size_t const i = starting_by(interval.start);
+		return i != 0 && interval.end <= ends_[i - 1];
+	}
+
+
+	bool interval_set::overlaps(jd_interval const& interval) const {
+		if (interval.empty())
+			return false;
+		std::size_t const i = starting_by(interval.start);
+		return (i != 0 && interval.start < ends_[i - 1]) || (i < size() && starts_[i] < interval.end);
+	}
+
+
+	std::size_t interval_set::contains(std::span<tick_t const> ticks, std::span<std::uint64_t> mask) const {
+		assert(mask.size() >= (ticks.size() + 63) / 64);
+		std::size_t count = 0;
+		for (std::size_t word = 0; word * 64 < ticks.size(); ++word) {
+			std::size_t const n = std::min<std::size_t>(64, ticks.size() - word * 64);
+			std::uint64_t bits = 0;
+			for (std::size_t b = 0; b < n; ++b)
+				bits |= std::uint64_t(contains(ticks[word * 64 + b])) << b;
+			mask[word] = bits;
+			count += static_cast<std::size_t>(std::popcount(bits));
+		}
+		return count;
+	}
+
+
+
+	// ALGEBRA
+	// --------------------------------------------------------------------------------------
+
+	interval_set operator|(interval_set const& lhs, interval_set const& rhs) {
+		interval_set result;
+		result.starts_.reserve(lhs.size() + rhs.size());
+		result.ends_.reserve(lhs.size() + rhs.size());
+		set_builder out{ result.starts_, result.ends_ };
+		std::size_t i = 0, j = 0;
+		while (i < lhs.size() || j < rhs.size()) {
+			bool const takeLeft = j == rhs.size() || (i < lhs.size() && lhs.starts_[i] <= rhs.starts_[j]);
+			if (takeLeft) {
+				out.push(lhs.starts_[i], lhs.ends_[i]);
+				++i;
+			}
+			else {
+				out.push(rhs.starts_[j], rhs.ends_[j]);
+				++j;
+			}
+		}
+		return result;
+	}
+
+
+	interval_set operator&(interval_set const& lhs, interval_set const& rhs) {
+		interval_set result;
+		set_builder out{ result.starts_, result.ends_ };
+		std::size_t i = 0, j = 0;
+		while (i < lhs.size() && j < rhs.size()) {
+			out.push(std::max(lhs.starts_[i], rhs.starts_[j]), std::min(lhs.ends_[i], rhs.ends_[j]));
+			// the interval ending first cannot meet anything later in the other set
+			if (lhs.ends_[i] < rhs.ends_[j])
+				++i;
+			else
+				++j;
+		}
+		return result;
+	}
+
+
+	interval_set operator-(interval_set const& lhs, interval_set const& rhs) {
+		interval_set result;
+		set_builder out{ result.starts_, result.ends_ };
+		std::size_t j = 0;
+		for (std::size_t i = 0; i < lhs.size(); ++i) {
+			tick_t const end = lhs.ends_[i];
+			tick_t cursor = lhs.starts_[i];
+			while (j < rhs.size() && rhs.ends_[j] <= cursor)
+				++j;
+			// the holes rhs punches in this interval; the last hole may reach into the next one
+			for (std::size_t k = j; k < rhs.size() && rhs.starts_[k] < end; ++k) {
+				out.push(cursor, rhs.starts_[k]);
+				cursor = std::max(cursor, rhs.ends_[k]);
+			}
+			out.push(cursor, end);
+		}
+		return result;
+	}
+
+} // end-of-namespace khronos
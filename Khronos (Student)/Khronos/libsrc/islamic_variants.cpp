@@ -0,0 +1,91 @@
+/**	@file islamic_variants.cpp
+	@date 2026-10-18
+
+	Islamic month table implementation.
+	*/
+
+#include <khronos/islamic_variants.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace khronos {
+
+	namespace {
+		constexpr std::uint16_t MONTH_MASK = 0x0FFF;
+
+		constexpr int month_start(std::uint16_t bits, int m) { return detail::islamic_month_start(bits, m); }
+	}
+
+
+	islamic_month_table::islamic_month_table(year_t firstYear, jd_t firstDay, std::span<std::uint16_t const> months)
+		: firstYear_(firstYear), firstDay_(static_cast<long long>(jd_to_jdn(firstDay))), months_(months.begin(), months.end()) {
+		yearStarts_.resize(months_.size() + 1);
+		for (std::size_t i = 0; i < months_.size(); ++i) {
+			months_[i] &= MONTH_MASK;
+			yearStarts_[i + 1] = yearStarts_[i] + month_start(months_[i], 12);
+		}
+	}
+
+
+	std::size_t islamic_month_table::year_index(year_t year) const {
+		if (!covers_year(year))
+			throw std::out_of_range("islamic_month_table: year outside the table: " + std::to_string(year));
+		return static_cast<std::size_t>(year - firstYear_);
+	}
+
+
+	bool islamic_month_table::covers(jd_t jd) const {
+		long long const day = static_cast<long long>(jd_to_jdn(jd)) - firstDay_;
+		return day >= 0 && day < yearStarts_.back();
+	}
+
+
+	day_t islamic_month_table::days_in_month(year_t year, month_t month) const {
+		if (month < 1 || month > 12 || !covers_year(year))
+			return 0;
+		return 29 + ((months_[year - firstYear_] >> (month - 1)) & 1);
+	}
+
+
+	int islamic_month_table::days_in_year(year_t year) const {
+		if (!covers_year(year))
+			return 0;
+		return month_start(months_[year - firstYear_], 12);
+	}
+
+
+	jd_t islamic_month_table::to_jd(year_t year, month_t month, day_t day) const {
+		std::size_t const i = year_index(year);
+		long long const jdn = firstDay_ + yearStarts_[i] + month_start(months_[i], month - 1) + day - 1;
+		return static_cast<jd_t>(jdn) - 0.5;
+	}
+
+
+	void islamic_month_table::from_jd(jd_t jd, year_t& year, month_t& month, day_t& day) const {
+		long long const days = static_cast<long long>(jd_to_jdn(jd)) - firstDay_;
+		if (days < 0 || days >= yearStarts_.back())
+			throw std::out_of_range("islamic_month_table: date outside the table");
+
+		// lunar years stay within a day or two of the mean year, so the estimate is at most a step out
+		auto i = static_cast<std::size_t>(std::min<long long>(days * 30 / 10'631, static_cast<long long>(months_.size()) - 1));
+		while (days < yearStarts_[i])
+			--i;
+		while (days >= yearStarts_[i + 1])
+			++i;
+
+		auto const dayOfYear = static_cast<int>(days - yearStarts_[i]);
+		std::uint16_t const bits = months_[i];
+		int m = std::min(dayOfYear * 2 / 59, 11);
+		while (dayOfYear < month_start(bits, m))
+			--m;
+		while (m < 11 && dayOfYear >= month_start(bits, m + 1))
+			++m;
+
+		year = firstYear_ + static_cast<year_t>(i);
+		month = static_cast<month_t>(m + 1);
+		day = static_cast<day_t>(dayOfYear - month_start(bits, m) + 1);
+	}
+
+} // end-of-namespace khronos
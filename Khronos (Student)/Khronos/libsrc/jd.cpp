@@ -8,12 +8,14 @@
 
 #include <khronos/julian_day.hpp>
 #include <khronos/gregorian_calendar.hpp>
+#include <khronos/instrument.hpp>
 #include <ctime>
 
 namespace khronos {
 
 	// Default constructor - initializes to now with time
 	Jd::Jd() {
+		KHRONOS_PROBE(Jd_now);
 		time_t now = time(nullptr);
 		struct tm local_time;
 		localtime_s(&local_time, &now);
@@ -30,6 +32,7 @@ namespace khronos {
 
 	// Constructor with now_t parameter
 	Jd::Jd(now_t now) {
+		KHRONOS_PROBE(Jd_now);
 		time_t current_time = time(nullptr);
 		struct tm local_time;
 		localtime_s(&local_time, &current_time);
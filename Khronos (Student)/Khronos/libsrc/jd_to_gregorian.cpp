@@ -9,6 +9,8 @@ Khronos library 'gregorian::from_jdn' implementation.
 
 #include <khronos/gregorian_calendar.hpp>
 #include <khronos/timeofday.hpp>
+#include <khronos/instrument.hpp>
+#include <khronos/utility.hpp>
 #include <cmath>
 
 namespace khronos {
@@ -21,12 +23,15 @@ namespace khronos {
 	 * @param day Output: day of month [1..31]
 	 */
 	void jd_to_gregorian(jd_t jd, year_t& year, month_t& month, day_t& day) {
+		KHRONOS_PROBE(jd_to_gregorian);
 		// Add 0.5 to convert from JD (noon-based) to integer day number
 		long long jdn = static_cast<long long>(std::floor(jd + 0.5));
 
+		// floored division keeps days before JDN -32044 correct
+		using utility::floor_div;
 		long long a = jdn + 32044;
-		long long b = (4 * a + 3) / 146097;
-		long long c = a - (146097 * b) / 4;
+		long long b = floor_div(4 * a + 3, 146097);
+		long long c = a - floor_div(146097 * b, 4);
 
 		long long d = (4 * c + 3) / 1461;
 		long long e = c - (1461 * d) / 4;
@@ -49,18 +54,12 @@ namespace khronos {
 	 */
 	void jd_to_gregorian(jd_t jd, year_t& year, month_t& month, day_t& day,
 		hour_t& hour, minute_t& minute, second_t& second) {
+		KHRONOS_PROBE(jd_to_gregorian_hms);
 		// Get the date part
 		jd_to_gregorian(jd, year, month, day);
 
 		// Extract the time of day
-		double jd_floor = std::floor(jd + 0.5);
-		double tod_fraction = jd - (jd_floor - 0.5);
-
-		// Make sure tod_fraction is in [0,1)
-		if (tod_fraction < 0) tod_fraction += 1.0;
-		if (tod_fraction >= 1.0) tod_fraction -= 1.0;
-
-		jd_to_hms(tod_fraction, hour, minute, second);
+		ns_to_hms(jd_to_ns(jd), hour, minute, second);
 	}
 
 } // end-of-namespace khronos
@@ -7,28 +7,34 @@
 
 #include <khronos/hebrew_calendar.hpp>
 #include <khronos/timeofday.hpp>
+#include <khronos/instrument.hpp>
+#include <khronos/utility.hpp>
 #include <cmath>
 
 namespace khronos {
 
-	void jd_to_hebrew(jd_t jd, year_t& year, month_t& month, day_t& day) {
-		long long d = static_cast<long long>(std::floor(jd - HEBREW_EPOCH + 1));
+	namespace {
+		/** Day number (JD + 0.5) of 1 Tishri of the given year. */
+		long long hebrew_new_year(year_t year) {
+			return static_cast<long long>(HEBREW_EPOCH + 0.5) + hebrew_delay_1(year) + hebrew_delay_2(year) + 2;
+		}
+	}
 
-		// Approximate year
-		year = static_cast<year_t>(d / 366);
+	void jd_to_hebrew(jd_t jd, year_t& year, month_t& month, day_t& day) {
+		KHRONOS_PROBE(jd_to_hebrew);
+		long long jdn = static_cast<long long>(std::floor(jd + 0.5));
 
-		// Refine year
-		while (d >= hebrew_delay_1(year + 1)) {
+		// Approximate the year from the mean year of 35975351/98496 days, then refine
+		year = utility::floor_div((jdn - static_cast<long long>(HEBREW_EPOCH + 0.5)) * 98496, 35975351) + 1;
+		while (jdn >= hebrew_new_year(year + 1)) {
 			year++;
 		}
+		while (jdn < hebrew_new_year(year)) {
+			year--;
+		}
 
 		// Calculate days from start of year
-		long long year_start = hebrew_delay_1(year) + hebrew_delay_2(year);
-		long long days_remaining = d - year_start + 1;
-
-		// Determine if we're before or after Tishrei
-		long long days_from_tishrei = 0;
-		month = 7; // Start from Tishrei
+		long long days_remaining = jdn - hebrew_new_year(year) + 1;
 
 		// Count through months starting from Tishrei
 		int total_months = hebrew_year_months(year);
@@ -60,15 +66,10 @@ namespace khronos {
 
 	void jd_to_hebrew(jd_t jd, year_t& year, month_t& month, day_t& day,
 		hour_t& hour, minute_t& minute, second_t& second) {
+		KHRONOS_PROBE(jd_to_hebrew_hms);
 		jd_to_hebrew(jd, year, month, day);
 
-		double jd_floor = std::floor(jd + 0.5);
-		double tod_fraction = jd - (jd_floor - 0.5);
-
-		if (tod_fraction < 0) tod_fraction += 1.0;
-		if (tod_fraction >= 1.0) tod_fraction -= 1.0;
-
-		jd_to_hms(tod_fraction, hour, minute, second);
+		ns_to_hms(jd_to_ns(jd), hour, minute, second);
 	}
 
 } // end-of-namespace khronos
@@ -7,7 +7,10 @@ Khronos library 'julian::from_jd' implementation.
 */
 
 #include <khronos/julian_calendar.hpp>
+#include <khronos/cyclic_calendar.hpp>
 #include <khronos/timeofday.hpp>
+#include <khronos/instrument.hpp>
+#include <khronos/utility.hpp>
 #include <cmath>
 
 namespace khronos {
@@ -20,18 +23,8 @@ namespace khronos {
 	 * @param day Output: day of month [1..31]
 	 */
 	void jd_to_julian(jd_t jd, year_t& year, month_t& month, day_t& day) {
-		long long jdn = static_cast<long long>(std::floor(jd + 0.5));
-
-		long long a = jdn + 32082;
-		long long b = (4 * a + 3) / 1461;
-		long long c = a - (1461 * b) / 4;
-		long long d = (4 * c + 3) / 1461;
-		long long e = c - (1461 * d) / 4;
-		long long m = (5 * e + 2) / 153;
-
-		day = static_cast<day_t>(e - (153 * m + 2) / 5 + 1);
-		month = static_cast<month_t>(m + 3 - 12 * (m / 10));
-		year = static_cast<year_t>(100 * b + d - 4800 + m / 10);
+		KHRONOS_PROBE(jd_to_julian);
+		julian_calendar::from_jd(jd, year, month, day);
 	}
 
 	/**
@@ -46,15 +39,10 @@ namespace khronos {
 	 */
 	void jd_to_julian(jd_t jd, year_t& year, month_t& month, day_t& day,
 		hour_t& hour, minute_t& minute, second_t& second) {
+		KHRONOS_PROBE(jd_to_julian_hms);
 		jd_to_julian(jd, year, month, day);
 
-		double jd_floor = std::floor(jd + 0.5);
-		double tod_fraction = jd - (jd_floor - 0.5);
-
-		if (tod_fraction < 0) tod_fraction += 1.0;
-		if (tod_fraction >= 1.0) tod_fraction -= 1.0;
-
-		jd_to_hms(tod_fraction, hour, minute, second);
+		ns_to_hms(jd_to_ns(jd), hour, minute, second);
 	}
 
 } // end-of-namespace khronos
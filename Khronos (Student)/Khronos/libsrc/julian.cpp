@@ -6,8 +6,10 @@
 	*/
 
 #include <khronos/julian_calendar.hpp>
+#include <khronos/week.hpp>
 #include <khronos/gregorian_calendar.hpp>
 #include <khronos/timeofday.hpp>
+#include <khronos/instrument.hpp>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
@@ -15,6 +17,7 @@
 namespace khronos {
 
 	void Julian::from_jd(jd_t jd) {
+		KHRONOS_PROBE(Julian_from_jd);
 		jd_to_julian(jd, year_, month_, day_, hour_, minute_, second_);
 	}
 
@@ -77,6 +80,7 @@ namespace khronos {
 	}
 
 	jd_t Julian::to_jd() const {
+		KHRONOS_PROBE(Julian_to_jd);
 		return julian_to_jd(year_, month_, day_, hour_, minute_, second_);
 	}
 
@@ -86,6 +90,7 @@ namespace khronos {
 	}
 
 	Julian& Julian::operator+=(detail::packaged_year_real const& year) {
+		KHRONOS_PROBE(Julian_add_years);
 		long long whole_years = static_cast<long long>(year.value);
 		year_ += whole_years;
 
@@ -103,6 +108,7 @@ namespace khronos {
 	}
 
 	Julian& Julian::operator+=(detail::packaged_month_integer const& month) {
+		KHRONOS_PROBE(Julian_add_months);
 		int total_months = month_ + month.value;
 
 		int years_to_add = 0;
@@ -142,11 +148,24 @@ namespace khronos {
 		return *this + detail::packaged_month_integer(-month.value);
 	}
 
+	// Calendar positions
+	day_t Julian::day_of_week() const {
+		return khronos::day_of_week<Julian>(year_, month_, day_);
+	}
+
+	day_t Julian::day_of_year() const {
+		return khronos::day_of_year<Julian>(year_, month_, day_);
+	}
+
+	int Julian::week_of_year() const {
+		return khronos::week_of_year<Julian>(year_, month_, day_);
+	}
+
 	std::string Julian::to_string() const {
+		KHRONOS_PROBE(Julian_to_string);
 		std::ostringstream oss;
 
-		jd_t jd = to_jd();
-		int dow = static_cast<int>(utility::jwday(jd));
+		int dow = day_of_week();
 
 		oss << civil::day_name(dow) << ", ";
 		oss << julian_month_name(month_) << " ";
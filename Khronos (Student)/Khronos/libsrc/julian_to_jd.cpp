@@ -6,7 +6,10 @@
 	*/
 
 #include <khronos/julian_calendar.hpp>
+#include <khronos/cyclic_calendar.hpp>
 #include <khronos/timeofday.hpp>
+#include <khronos/instrument.hpp>
+#include <khronos/utility.hpp>
 #include <cmath>
 
 namespace khronos {
@@ -19,15 +22,8 @@ namespace khronos {
 	 * @return Julian Day Number at noon of the given date
 	 */
 	jd_t julian_to_jd(year_t year, month_t month, day_t day) {
-		// Adjust for algorithm
-		long long a = (14 - month) / 12;
-		long long y = year + 4800 - a;
-		long long m = month + 12 * a - 3;
-
-		// Julian calendar formula
-		long long jdn = day + (153 * m + 2) / 5 + 365 * y + y / 4 - 32083;
-
-		return static_cast<jd_t>(jdn) - 0.5;
+		KHRONOS_PROBE(julian_to_jd);
+		return julian_calendar::to_jd(year, month, day);
 	}
 
 	/**
@@ -42,6 +38,7 @@ namespace khronos {
 	 */
 	jd_t julian_to_jd(year_t year, month_t month, day_t day,
 		hour_t hour, minute_t minute, second_t second) {
+		KHRONOS_PROBE(julian_to_jd_hms);
 		jd_t jd = julian_to_jd(year, month, day);
 		jd += tod(hour, minute, second);
 		return jd;
@@ -0,0 +1,23 @@
+/**	@file parallel.cpp
+	@date 2026-10-18
+
+	Khronos library multi-threading support implementation.
+	*/
+
+#include <khronos/parallel.hpp>
+
+#include <algorithm>
+
+namespace khronos {
+
+	namespace detail {
+		unsigned thread_count(parallel_policy policy, std::size_t n, std::size_t grain) {
+			unsigned threads = policy.threads ? policy.threads : std::thread::hardware_concurrency();
+			if (threads == 0)
+				threads = 1;
+			auto const useful = static_cast<unsigned>(std::max<std::size_t>(1, n / std::max<std::size_t>(1, grain)));
+			return std::min(threads, useful);
+		}
+	}
+
+} // end-of-namespace khronos
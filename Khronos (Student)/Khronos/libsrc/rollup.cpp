@@ -0,0 +1,115 @@
+/**	@file rollup.cpp
+	@date 2026-10-18
+
+	Calendar-aware rollup aggregation implementation.
+	*/
+
+#include <khronos/rollup.hpp>
+
+#include <array>
+#include <cassert>
+
+namespace khronos {
+
+	void assign_periods(std::span<jd_t const> edges, std::span<jd_t const> jds, std::span<std::int32_t> out) {
+		assert(out.size() >= jds.size());
+		if (edges.size() < 2) {
+			std::fill_n(out.begin(), jds.size(), -1);
+			return;
+		}
+		for (std::size_t i = 0; i < jds.size(); ++i)
+			out[i] = static_cast<std::int32_t>(locate_period(edges, jds[i]));
+	}
+
+
+
+	namespace {
+		/** Points whose period indices are resolved together before accumulating the columns. */
+		constexpr std::size_t ROLLUP_BLOCK = 512;
+
+		rollup_table make_table(std::vector<jd_t> edges, std::size_t columns) {
+			rollup_table table;
+			std::size_t const periods = edges.size() < 2 ? 0 : edges.size() - 1;
+			table.edges = std::move(edges);
+			table.counts.assign(periods, 0);
+			table.columns.resize(columns);
+			for (auto& column : table.columns) {
+				column.sum.assign(periods, 0.0);
+				column.min.assign(periods, std::numeric_limits<double>::infinity());
+				column.max.assign(periods, -std::numeric_limits<double>::infinity());
+			}
+			return table;
+		}
+
+		/** Accumulate points [first, last) into 'table' in a single pass. */
+		void accumulate(rollup_table& table, std::span<jd_t const> jds,
+			std::span<std::span<double const> const> columns, std::size_t first, std::size_t last) {
+			std::array<std::int32_t, ROLLUP_BLOCK> index;
+			for (std::size_t block = first; block < last; block += ROLLUP_BLOCK) {
+				std::size_t const n = std::min(ROLLUP_BLOCK, last - block);
+				assign_periods(table.edges, jds.subspan(block, n), index);
+
+				for (std::size_t i = 0; i < n; ++i)
+					if (index[i] >= 0)
+						++table.counts[index[i]];
+
+				for (std::size_t c = 0; c < columns.size(); ++c) {
+					auto& column = table.columns[c];
+					double const* values = columns[c].data() + block;
+					for (std::size_t i = 0; i < n; ++i) {
+						if (index[i] < 0)
+							continue;
+						column.sum[index[i]] += values[i];
+						column.min[index[i]] = std::min(column.min[index[i]], values[i]);
+						column.max[index[i]] = std::max(column.max[index[i]], values[i]);
+					}
+				}
+			}
+		}
+
+		/** Fold a partial table into 'table'. */
+		void merge(rollup_table& table, rollup_table const& partial) {
+			for (std::size_t b = 0; b < table.size(); ++b)
+				table.counts[b] += partial.counts[b];
+			for (std::size_t c = 0; c < table.columns.size(); ++c) {
+				auto& column = table.columns[c];
+				auto const& other = partial.columns[c];
+				for (std::size_t b = 0; b < table.size(); ++b) {
+					column.sum[b] += other.sum[b];
+					column.min[b] = std::min(column.min[b], other.min[b]);
+					column.max[b] = std::max(column.max[b], other.max[b]);
+				}
+			}
+		}
+	}
+
+
+
+	rollup_table rollup(std::vector<jd_t> edges, std::span<jd_t const> jds,
+		std::span<std::span<double const> const> columns, parallel_policy policy) {
+		for ([[maybe_unused]] auto const& column : columns)
+			assert(column.size() == jds.size());
+
+		auto table = make_table(std::move(edges), columns.size());
+		if (table.size() == 0)
+			return table;
+
+		unsigned const threads = detail::thread_count(policy, jds.size());
+		if (threads <= 1) {
+			accumulate(table, jds, columns, 0, jds.size());
+			return table;
+		}
+
+		// each thread accumulates into a private table; merged after the join
+		std::vector<rollup_table> partials(threads);
+		for (auto& partial : partials)
+			partial = make_table(table.edges, columns.size());
+		detail::parallel_chunks(jds.size(), threads, [&](unsigned chunk, std::size_t first, std::size_t last) {
+			accumulate(partials[chunk], jds, columns, first, last);
+		});
+		for (auto const& partial : partials)
+			merge(table, partial);
+		return table;
+	}
+
+} // end-of-namespace khronos
@@ -0,0 +1,109 @@
+/**	@file sort.cpp
+	@date 2026-10-18
+
+	Date column sorting and selection implementations.
+	*/
+
+#include <khronos/sort.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace khronos {
+
+	namespace {
+		auto const jd_key = [](jd_t jd) { return order_key(jd); };
+		auto const identity_key = [](std::uint64_t key) { return key; };
+
+
+		/*	Radix sort one chunk per thread, then merge adjacent runs in parallel
+			until a single run remains. */
+		template <typename T, typename KeyFn>
+		void parallel_sort_impl(std::span<T> items, unsigned threads, KeyFn key) {
+			if (threads <= 1) {
+				detail::radix_sort(items, key);
+				return;
+			}
+
+			std::vector<std::size_t> bounds(threads + 1);
+			for (unsigned t = 0; t <= threads; ++t)
+				bounds[t] = items.size() * t / threads;
+
+			detail::parallel_chunks(items.size(), threads, [&](unsigned, std::size_t first, std::size_t last) {
+				detail::radix_sort(items.subspan(first, last - first), key);
+			});
+
+			auto const less = [&](T const& a, T const& b) { return key(a) < key(b); };
+			while (bounds.size() > 2) {
+				std::vector<std::size_t> merged;
+				std::vector<std::jthread> workers;
+				for (std::size_t r = 0; r + 1 < bounds.size(); r += 2) {
+					merged.push_back(bounds[r]);
+					if (r + 2 < bounds.size()) {
+						auto const first = items.begin() + bounds[r];
+						auto const middle = items.begin() + bounds[r + 1];
+						auto const last = items.begin() + bounds[r + 2];
+						workers.emplace_back([=] { std::inplace_merge(first, middle, last, less); });
+					}
+				}
+				merged.push_back(bounds.back());
+				bounds = std::move(merged);
+			}
+		}
+	}
+
+
+
+	namespace detail {
+		void parallel_radix_sort(std::span<std::uint64_t> keys, unsigned threads) {
+			parallel_sort_impl(keys, threads, identity_key);
+		}
+
+		void parallel_radix_sort(std::span<jd_t> jds, unsigned threads) {
+			parallel_sort_impl(jds, threads, jd_key);
+		}
+	}
+
+
+
+	void sort(std::span<jd_t> jds) {
+		detail::radix_sort(jds, jd_key);
+	}
+
+	void sort(std::span<Jd> jds) {
+		// Jd's default constructor reads the clock, so sort the raw values instead.
+		std::vector<jd_t> values(jds.begin(), jds.end());
+		sort(std::span(values));
+		std::transform(values.begin(), values.end(), jds.begin(), [](jd_t jd) { return Jd(jd); });
+	}
+
+	void sort(std::span<packed_date_t> dates) {
+		detail::radix_sort(dates, identity_key);
+	}
+
+	void sort(parallel_policy policy, std::span<jd_t> jds) {
+		detail::parallel_radix_sort(jds, detail::thread_count(policy, jds.size()));
+	}
+
+	void sort(parallel_policy policy, std::span<packed_date_t> dates) {
+		detail::parallel_radix_sort(dates, detail::thread_count(policy, dates.size()));
+	}
+
+
+
+	void nth_element(std::span<jd_t> jds, std::size_t nth) {
+		detail::radix_select(jds, nth, jd_key);
+	}
+
+	void nth_element(std::span<Jd> jds, std::size_t nth) {
+		std::vector<jd_t> values(jds.begin(), jds.end());
+		nth_element(std::span(values), nth);
+		std::transform(values.begin(), values.end(), jds.begin(), [](jd_t jd) { return Jd(jd); });
+	}
+
+	void nth_element(std::span<packed_date_t> dates, std::size_t nth) {
+		detail::radix_select(dates, nth, identity_key);
+	}
+
+} // end-of-namespace khronos
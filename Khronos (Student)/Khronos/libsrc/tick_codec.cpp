@@ -0,0 +1,149 @@
+/**	@file tick_codec.cpp
+	@date 2026-10-18
+
+	Delta-of-delta tick codec implementation.
+	*/
+
+#include <khronos/tick_codec.hpp>
+
+#include <algorithm>
+
+namespace khronos {
+
+	// ENCODER
+	// --------------------------------------------------------------------------------------
+
+	void tick_encoder::put(std::uint64_t v) {
+		while (v >= 0x80) {
+			bytes_.push_back(static_cast<std::uint8_t>(v | 0x80));
+			v >>= 7;
+		}
+		bytes_.push_back(static_cast<std::uint8_t>(v));
+	}
+
+
+	void tick_encoder::push(tick_t tick) {
+		auto const t = static_cast<std::uint64_t>(tick);
+		auto const delta = t - prev_;
+		auto const dod = delta - delta_;
+		prev_ = t;
+		delta_ = delta;
+		++rows_;
+
+		if (dod == 0) {
+			++run_;
+			return;
+		}
+		flush();
+		put(detail::zigzag_encode(static_cast<std::int64_t>(dod)));
+	}
+
+
+	void tick_encoder::append(std::span<tick_t const> ticks) {
+		bytes_.reserve(bytes_.size() + ticks.size() / 4);
+		for (tick_t t : ticks)
+			push(t);
+	}
+
+
+	void tick_encoder::append(std::span<jd_t const> jds) {
+		for (jd_t jd : jds)
+			push(jd_to_ticks(jd));
+	}
+
+
+	void tick_encoder::flush() {
+		if (run_ == 0)
+			return;
+		put(0);
+		put(run_);
+		run_ = 0;
+	}
+
+
+	std::vector<std::uint8_t> encode_ticks(std::span<tick_t const> ticks) {
+		tick_encoder encoder;
+		encoder.append(ticks);
+		encoder.flush();
+		auto const bytes = encoder.bytes();
+		return { bytes.begin(), bytes.end() };
+	}
+
+
+
+	// DECODER
+	// --------------------------------------------------------------------------------------
+
+	namespace {
+		/** Read a varint at 'p'; false if the stream ends inside it. */
+		inline bool get(std::uint8_t const*& p, std::uint8_t const* end, std::uint64_t& v) {
+			if (p != end && *p < 0x80) {	// the common one-byte case
+				v = *p++;
+				return true;
+			}
+			v = 0;
+			for (int shift = 0; p != end && shift < 64; shift += 7) {
+				std::uint8_t const byte = *p++;
+				v |= std::uint64_t(byte & 0x7F) << shift;
+				if (byte < 0x80)
+					return true;
+			}
+			return false;
+		}
+
+
+		/** Decode into out[i] = convert(tick). */
+		template <typename T, typename Convert>
+		std::size_t decode(std::span<std::uint8_t const> bytes, std::span<T> out, Convert convert) {
+			std::uint8_t const* p = bytes.data();
+			std::uint8_t const* const end = p + bytes.size();
+			std::uint64_t t = 0, delta = 0, v;
+			std::size_t i = 0;
+			while (i < out.size() && get(p, end, v)) {
+				if (v != 0) {
+					delta += static_cast<std::uint64_t>(detail::zigzag_decode(v));
+					t += delta;
+					out[i++] = convert(t);
+					continue;
+				}
+
+				std::uint64_t run;
+				if (!get(p, end, run))
+					break;
+				auto const n = static_cast<std::size_t>(std::min<std::uint64_t>(run, out.size() - i));
+				T* const dst = out.data() + i;
+				for (std::size_t k = 0; k < n; ++k)
+					dst[k] = convert(t + (k + 1) * delta);
+				t += n * delta;
+				i += n;
+			}
+			return i;
+		}
+	}
+
+
+	std::size_t decode_ticks(std::span<std::uint8_t const> bytes, std::span<tick_t> out) {
+		return decode(bytes, out, [](std::uint64_t t) { return static_cast<tick_t>(t); });
+	}
+
+
+	std::size_t decode_jds(std::span<std::uint8_t const> bytes, std::span<jd_t> out) {
+		return decode(bytes, out, [](std::uint64_t t) { return ticks_to_jd(static_cast<tick_t>(t)); });
+	}
+
+
+	std::size_t decoded_size(std::span<std::uint8_t const> bytes) {
+		std::uint8_t const* p = bytes.data();
+		std::uint8_t const* const end = p + bytes.size();
+		std::size_t rows = 0;
+		std::uint64_t v;
+		while (get(p, end, v)) {
+			if (v != 0)
+				++rows;
+			else if (get(p, end, v))
+				rows += static_cast<std::size_t>(v);
+		}
+		return rows;
+	}
+
+} // end-of-namespace khronos
@@ -6,8 +6,10 @@
 	*/
 
 #include <khronos/vulcan_calendar.hpp>
+#include <khronos/week.hpp>
 #include <khronos/gregorian_calendar.hpp>
 #include <khronos/timeofday.hpp>
+#include <khronos/instrument.hpp>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
@@ -15,6 +17,7 @@
 namespace khronos {
 
 	void Vulcan::from_jd(jd_t jd) {
+		KHRONOS_PROBE(Vulcan_from_jd);
 		jd_to_vulcan(jd, year_, month_, day_, hour_, minute_, second_);
 	}
 
@@ -77,6 +80,7 @@ namespace khronos {
 	}
 
 	jd_t Vulcan::to_jd() const {
+		KHRONOS_PROBE(Vulcan_to_jd);
 		return vulcan_to_jd(year_, month_, day_, hour_, minute_, second_);
 	}
 
@@ -86,6 +90,7 @@ namespace khronos {
 	}
 
 	Vulcan& Vulcan::operator+=(detail::packaged_year_real const& year) {
+		KHRONOS_PROBE(Vulcan_add_years);
 		long long whole_years = static_cast<long long>(year.value);
 		year_ += whole_years;
 
@@ -103,20 +108,11 @@ namespace khronos {
 	}
 
 	Vulcan& Vulcan::operator+=(detail::packaged_month_integer const& month) {
-		int total_months = month_ + month.value;
+		KHRONOS_PROBE(Vulcan_add_months);
+		long long total_months = month_ - 1 + month.value;
 
-		int years_to_add = 0;
-		if (total_months > 12) {
-			years_to_add = (total_months - 1) / 12;
-			total_months = ((total_months - 1) % 12) + 1;
-		}
-		else if (total_months < 1) {
-			years_to_add = (total_months / 12) - 1;
-			total_months = 12 + (total_months % 12);
-		}
-
-		year_ += years_to_add;
-		month_ = static_cast<month_t>(total_months);
+		year_ += utility::floor_div(total_months, 12);
+		month_ = static_cast<month_t>(utility::floor_mod(total_months, 12) + 1);
 
 		int max_day = vulcan_days_in_month(month_, is_vulcan_leapyear(year_));
 		if (day_ > max_day) {
@@ -142,11 +138,24 @@ namespace khronos {
 		return *this + detail::packaged_month_integer(-month.value);
 	}
 
+	// Calendar positions
+	day_t Vulcan::day_of_week() const {
+		return khronos::day_of_week<Vulcan>(year_, month_, day_);
+	}
+
+	day_t Vulcan::day_of_year() const {
+		return khronos::day_of_year<Vulcan>(year_, month_, day_);
+	}
+
+	int Vulcan::week_of_year() const {
+		return khronos::week_of_year<Vulcan>(year_, month_, day_);
+	}
+
 	std::string Vulcan::to_string() const {
+		KHRONOS_PROBE(Vulcan_to_string);
 		std::ostringstream oss;
 
-		jd_t jd = to_jd();
-		int dow = static_cast<int>(utility::jwday(jd));
+		int dow = day_of_week();
 
 		oss << civil::day_name(dow) << ", ";
 		oss << vulcan_month_name(month_) << " ";
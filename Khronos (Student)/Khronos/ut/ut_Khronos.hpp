@@ -16,6 +16,7 @@
 #define ISLAMIC_CALENDAR_GROUP		"{4} Islamic Calendar"
 #define HEBREW_CALENDAR_GROUP		"{5} Hebrew Calendar"
 #define VULCAN_CALENDAR_GROUP		"{6} Vulcan Calendar"
+#define UTILITY_GROUP				"{7} Utilities"
 
 
 // set 'PHASE_dd' to 'false' for any test phase you wish to skip
@@ -157,6 +158,81 @@
 #define PHASE_118 true
 #define PHASE_119 true
 
+// Differential test phases
+#define PHASE_120 true
+#define PHASE_121 true
+#define PHASE_122 true
+
+// Validation phases
+#define PHASE_123 true
+#define PHASE_124 true
+
+// Column file phases
+#define PHASE_125 true
+#define PHASE_126 true
+
+// Tick codec phases
+#define PHASE_127 true
+#define PHASE_128 true
+
+// Arrow phases
+#define PHASE_129 true
+#define PHASE_130 true
+
+// Time of day phases
+#define PHASE_131 true
+#define PHASE_132 true
+
+// Week phases
+#define PHASE_133 true
+#define PHASE_134 true
+#define PHASE_135 true
+#define PHASE_136 true
+
+// Period phases
+#define PHASE_137 true
+#define PHASE_138 true
+
+// Interval phases
+#define PHASE_139 true
+#define PHASE_140 true
+#define PHASE_141 true
+#define PHASE_142 true
+
+// Cyclic calendar phases
+#define PHASE_143 true
+#define PHASE_144 true
+#define PHASE_145 true
+#define PHASE_146 true
+
+// Historical calendar phases
+#define PHASE_147 true
+#define PHASE_148 true
+
+// Ephemeris phases
+#define PHASE_149 true
+#define PHASE_150 true
+
+// Astronomical time phases
+#define PHASE_151 true
+#define PHASE_152 true
+
+// Test framework phases
+#define PHASE_153 true
+#define PHASE_154 true
+#define PHASE_155 true
+#define PHASE_156 true
+
+// Instrumentation phases
+#define PHASE_157 true
+
+// Hardware counter phases
+#define PHASE_158 true
+
+// Budget and baseline phases
+#define PHASE_159 true
+#define PHASE_160 true
+
 
 
 /*============================================================================
@@ -6,6 +6,9 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Regression checks of the conversion fixes.
+
 Version 2021.09.25
 	Replaced BOOST's test framework with gats_test framework.
 
@@ -57,6 +60,11 @@ GATS_TEST_CASE(ut007_gregorian_to_jdn_basic_test, GREGORIAN_CALENDAR_GROUP, 3) {
 	test(1977_CE, April, 26, 2'443259.5, __LINE__);
 	test(2012_CE, September, 14, 2'456'184.5, __LINE__);
 	test(2132_CE, August, 31, 2'500'000 - 0.5, __LINE__);
+
+	// the century terms are floored before the algorithm's zero point in -4800
+	test(-4800, 1, 1, -32'104.5, __LINE__);
+	test(-5000, 1, 1, -105'152.5, __LINE__);
+	test(-5200, 1, 1, -32'104.5 - 146'097, __LINE__);		// one 400-year cycle earlier
 #endif
 }
 
@@ -6,6 +6,11 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Full sweep split across the case pool with GATS_PARALLEL_FOR,
+	checked in blocks with GATS_CHECK_ALL_EQUAL/WITHIN.
+	Time budget of 120 s.
+
 Version 2021.09.25
 	Replaced BOOST's test framework with gats_test framework.
 
@@ -31,32 +36,42 @@ the program(s) have been supplied.
 
 #include <khronos.hpp>
 #include "ut_Khronos.hpp"
+#include <algorithm>
+#include <vector>
 using namespace std;
 
 
 
 /**	Check all conversions from the lowest Proleptic Gregorian date, until a day well in the future. */
-GATS_TEST_CASE(ut010_test_gregorian_full, GREGORIAN_CALENDAR_GROUP, 1) {
+GATS_TEST_CASE_BUDGETED(ut010_test_gregorian_full, GREGORIAN_CALENDAR_GROUP, 1, 120s) {
 #if PHASE_10
 	using namespace khronos;
 
 	cout << "Starting Gregorian FULL_TEST: ";
 	auto low = gregorian_to_jd(4710_BCE, January, 1);
 	auto high = gregorian_to_jd(4800_CE, January, 1);
-	for (auto jd = low; jd <= high; jd += 0.125) {
-		year_t year;
-		month_t month;
-		day_t day;
-		jd_to_gregorian(jd, year, month, day);
-		auto result = gregorian_to_jd(year, month, day);
-		GATS_CHECK_EQUAL(jd_to_jdn(jd)-0.5, result);
-		hour_t hours;
-		minute_t minutes;
-		second_t seconds;
-		jd_to_gregorian(jd, year, month, day, hours, minutes, seconds);
-		result = gregorian_to_jd(year, month, day, hours, minutes, seconds);
-		GATS_CHECK_WITHIN(jd, result, 0.000'01);
-	}
+	constexpr long long BLOCK = 8'192;
+	auto steps = static_cast<long long>((high - low) / 0.125) + 1;
+	GATS_PARALLEL_FOR(block, 0LL, (steps + BLOCK - 1) / BLOCK, {
+		vector<jd_t> jds, expected, dates, times;
+		for (auto step = block * BLOCK; step < std::min(steps, (block + 1) * BLOCK); ++step) {
+			jd_t jd = low + step * 0.125;
+			year_t year;
+			month_t month;
+			day_t day;
+			jd_to_gregorian(jd, year, month, day);
+			expected.push_back(jd_to_jdn(jd) - 0.5);
+			dates.push_back(gregorian_to_jd(year, month, day));
+			hour_t hours;
+			minute_t minutes;
+			second_t seconds;
+			jd_to_gregorian(jd, year, month, day, hours, minutes, seconds);
+			jds.push_back(jd);
+			times.push_back(gregorian_to_jd(year, month, day, hours, minutes, seconds));
+		}
+		GATS_CHECK_ALL_EQUAL(expected, dates);
+		GATS_CHECK_ALL_WITHIN(jds, times, 0.000'01);
+	});
 	cout << "... completed\n";
 #endif
 }
@@ -6,6 +6,10 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Full sweep checked in blocks with GATS_CHECK_ALL_EQUAL.
+	Regression checks of the conversion fixes.
+
 Version 2021.09.25
 	Replaced BOOST's test framework with gats_test framework.
 
@@ -33,6 +37,8 @@ the program(s) have been supplied.
 #include "ut_Khronos.hpp"
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
+#include <vector>
 using namespace std;
 
 
@@ -58,6 +64,10 @@ GATS_TEST_CASE(ut043_test_Julian_to_jd, JULIAN_CALENDAR_GROUP, 2) {
 	test(2012, September, 1, 2'456'184.5, __LINE__);
 	test(2132, August, 17, 2'500'000 - 0.5, __LINE__);
 
+	// the leap days are floored before the algorithm's zero point in -4800
+	test(-5001, 3, 1, -105'498.5, __LINE__);
+	test(-5005, 3, 1, -105'498.5 - 1'461, __LINE__);		// one 4-year cycle earlier
+
 
 	auto test2 = [this](year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t seconds, jd_t jdn, int line) {
 		auto jg = julian_to_jd(year, month, day, hour, minute, seconds);
@@ -107,6 +117,10 @@ GATS_TEST_CASE(ut044_jdn_to_julian_test, JULIAN_CALENDAR_GROUP, 2) {
 	test(2012, September, 1, 2'456'184.5, __LINE__);
 	test(2132, August, 17, 2'500'000 - 0.5, __LINE__);
 
+	// the year counts each 4-year cycle once, and is floored before -4800
+	test(2000, 1, 1, 2'451'557.5, __LINE__);
+	test(-5001, 3, 1, -105'498.5, __LINE__);
+
 
 	auto test2 = [this](year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second, jd_t jdn, int line) {
 		year_t y;
@@ -158,20 +172,28 @@ GATS_TEST_CASE(ut045_test_julian_full, JULIAN_CALENDAR_GROUP, 1) {
 	cout << "Starting Julian FULL_TEST: ";
 	jd_t low = julian_to_jd(-4799, January, 1);
 	jd_t high = julian_to_jd(4800, January, 1);
-	for (jd_t jd = low; jd <= high; jd += 0.125) {
-		year_t year;
-		month_t month;
-		day_t day;
-		jd_to_julian(jd, year, month, day);
-		jd_t result = julian_to_jd(year, month, day);
-		GATS_CHECK_EQUAL(jd_to_jdn(jd)-0.5, result);
-		hour_t hours;
-		minute_t minutes;
-		second_t seconds;
-		jd_to_julian(jd, year, month, day, hours, minutes, seconds);
-		result = julian_to_jd(year, month, day, hours, minutes, seconds);
-		GATS_CHECK_EQUAL(jd, result);
-	}
+	constexpr long long BLOCK = 8'192;
+	auto steps = static_cast<long long>((high - low) / 0.125) + 1;
+	GATS_PARALLEL_FOR(block, 0LL, (steps + BLOCK - 1) / BLOCK, {
+		vector<jd_t> jds, expected, dates, times;
+		for (auto step = block * BLOCK; step < std::min(steps, (block + 1) * BLOCK); ++step) {
+			jd_t jd = low + step * 0.125;
+			year_t year;
+			month_t month;
+			day_t day;
+			jd_to_julian(jd, year, month, day);
+			expected.push_back(jd_to_jdn(jd) - 0.5);
+			dates.push_back(julian_to_jd(year, month, day));
+			hour_t hours;
+			minute_t minutes;
+			second_t seconds;
+			jd_to_julian(jd, year, month, day, hours, minutes, seconds);
+			jds.push_back(jd);
+			times.push_back(julian_to_jd(year, month, day, hours, minutes, seconds));
+		}
+		GATS_CHECK_ALL_EQUAL(expected, dates);
+		GATS_CHECK_ALL_EQUAL(jds, times);
+	});
 	cout << "... completed\n";
 #endif
 }
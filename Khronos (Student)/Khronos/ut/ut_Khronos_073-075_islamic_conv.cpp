@@ -6,6 +6,9 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Regression checks of the conversion fixes.
+
 Version 2021.09.25
 	Replaced BOOST's test framework with gats_test framework.
 
@@ -53,6 +56,10 @@ GATS_TEST_CASE(ut073_test_islamic_to_jd, ISLAMIC_CALENDAR_GROUP,2) {
 	GATS_CHECK(test(1433, Shawwal, 27, 2'456'184.5));
 	GATS_CHECK(test(1557, JumadatTania, 18, 2'500'000 - 0.5));
 
+	// the 30-year cycle is floored for years before 1
+	GATS_CHECK(test(1445, 1, 1, 2'460'144.5));			// July 19, 2023
+	GATS_CHECK(test(-100, 1, 1, 1'912'648.5));
+
 
 	auto test2 = [this](year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t seconds, jd_t jdn) {
 		auto jd = islamic_to_jd(year, month, day, hour, minute, seconds);
@@ -89,6 +96,12 @@ GATS_TEST_CASE(ut074_test_jd_to_islamic, ISLAMIC_CALENDAR_GROUP,2) {
 	GATS_CHECK(test(1433, Shawwal, 27, 2'456'184.5));
 	GATS_CHECK(test(1557, JumadatTania, 18, 2'500'000 - 0.5));
 
+	// days count from the epoch itself, not the day after it
+	GATS_CHECK(test(1, 1, 1, 1'948'439.5));
+	GATS_CHECK(test(1445, 1, 1, 2'460'144.5));			// July 19, 2023
+	GATS_CHECK(test(1445, 12, 30, 2'460'498.5));			// the leap day
+	GATS_CHECK(test(-100, 1, 1, 1'912'648.5));
+
 
 	auto test2 = [this](year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t seconds, jd_t jd) {
 		year_t y;
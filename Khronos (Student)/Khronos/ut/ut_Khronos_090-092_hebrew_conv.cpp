@@ -6,6 +6,11 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Full sweep checked in blocks with GATS_CHECK_ALL_EQUAL.
+	Regression checks of the conversion fixes.
+	Full sweep rows compared as whole dates, so a mismatch names the date.
+
 Version 2021.09.25
 	Replaced BOOST's test framework with gats_test framework.
 
@@ -34,6 +39,7 @@ the program(s) have been supplied.
 #include <random>
 #include <functional>
 #include <chrono>
+#include <vector>
 using namespace std;
 
 
@@ -56,6 +62,19 @@ GATS_TEST_CASE(ut090_test_hebrew_to_jd, HEBREW_CALENDAR_GROUP, 1) {
 	GATS_CHECK(test(5772, Elul, 27, 2'456'184.5));
 	GATS_CHECK(test(5892, Elul, 19, 2'500'000 - 0.5));
 
+	// the epoch offset, the months before Tishri and the second new-year delay
+	GATS_CHECK(test(5784, 7, 1, 2'460'203.5));			// Rosh Hashanah, September 16, 2023
+	GATS_CHECK(test(5784, 1, 1, 2'460'409.5));			// 1 Nisan, April 9, 2024
+	GATS_CHECK(test(5718, 7, 1, 2'436'107.5));			// September 26, 1957
+	GATS_CHECK_EQUAL(hebrew_year_days(5718), 354);
+	GATS_CHECK_EQUAL(hebrew_year_days(5765), 383);
+	GATS_CHECK_EQUAL(hebrew_year_days(5784), 383);
+
+	// the 19-year cycle is floored for years before 1
+	GATS_CHECK(is_hebrew_leapyear(0));
+	GATS_CHECK(is_hebrew_leapyear(-2));
+	GATS_CHECK(!is_hebrew_leapyear(-1));
+
 
 	auto test2 = [this](year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t seconds, jd_t jd) {
 		auto result = hebrew_to_jd(year, month, day, hour, minute, seconds);
@@ -92,6 +111,11 @@ GATS_TEST_CASE(ut091_test_jd_to_hebrew, HEBREW_CALENDAR_GROUP, 1) {
 	GATS_CHECK(test(5772, Elul, 27, 2'456'184.5));
 	GATS_CHECK(test(5892, Elul, 19, 2'500'000 - 0.5));
 
+	// the year search and the months before Tishri
+	GATS_CHECK(test(5784, 7, 1, 2'460'203.5));			// Rosh Hashanah, September 16, 2023
+	GATS_CHECK(test(5784, 1, 1, 2'460'409.5));			// 1 Nisan, April 9, 2024
+	GATS_CHECK(test(5718, 6, 29, 2'436'461.5 - 1));		// the last day of a 354-day year
+
 
 	auto test2 = [this](year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t seconds, jd_t jd) {
 		year_t y;
@@ -118,6 +142,27 @@ GATS_TEST_CASE(ut091_test_jd_to_hebrew, HEBREW_CALENDAR_GROUP, 1) {
 
 
 
+namespace {
+	/** The fields of one Hebrew date and time, compared and reported as a row. */
+	struct hebrew_fields {
+		khronos::year_t year;
+		khronos::month_t month;
+		khronos::day_t day;
+		khronos::hour_t hour;
+		khronos::minute_t minute;
+		khronos::second_t second;
+
+		bool operator==(hebrew_fields const&) const = default;
+
+		template <typename CharT>
+		friend basic_ostream<CharT>& operator<<(basic_ostream<CharT>& os, hebrew_fields const& f) {
+			return os << f.year << '/' << f.month << '/' << f.day << ' ' << f.hour << ':' << f.minute << ':' << f.second;
+		}
+	};
+}
+
+
+
 /**	Check all conversions from the lowest Proleptic Gregorian date, until a day well in the future. */
 GATS_TEST_CASE(ut092_test_hebrew_full, HEBREW_CALENDAR_GROUP, 1) {
 #if PHASE_92
@@ -144,6 +189,9 @@ GATS_TEST_CASE(ut092_test_hebrew_full, HEBREW_CALENDAR_GROUP, 1) {
 					hour_t hour = (hour_t)hourGen();
 					static uniform_int_distribution<int> minSecDist(0, 59);
 					static auto minSecGen = bind(minSecDist, dr);
+
+					// date and date-time round trips, one row each
+					vector<hebrew_fields> expectedDates, dates, expectedTimes, times;
 					for (auto iMin = 0; iMin < 10; ++iMin) {
 						minute_t minute = (minute_t)minSecGen();
 						for (auto iSec = 0; iSec < 10; ++iSec) {
@@ -154,23 +202,20 @@ GATS_TEST_CASE(ut092_test_hebrew_full, HEBREW_CALENDAR_GROUP, 1) {
 							month_t mo;
 							day_t da;
 							jd_to_hebrew(jd, ye, mo, da);
-							GATS_CHECK_EQUAL(year, ye);
-							GATS_CHECK_EQUAL(month, mo);
-							GATS_CHECK_EQUAL(day, da);
+							expectedDates.push_back({ year, month, day, 0, 0, 0.0 });
+							dates.push_back({ ye, mo, da, 0, 0, 0.0 });
 
 							jd = hebrew_to_jd(year, month, day, hour, minute, second);
 							hour_t ho;
 							minute_t mi;
 							second_t se;
 							jd_to_hebrew(jd, ye, mo, da, ho, mi, se);
-							GATS_CHECK_EQUAL(year, ye);
-							GATS_CHECK_EQUAL(month, mo);
-							GATS_CHECK_EQUAL(day, da);
-							GATS_CHECK_EQUAL(hour, ho);
-							GATS_CHECK_EQUAL(minute, mi);
-							GATS_CHECK_EQUAL(second, se);
+							expectedTimes.push_back({ year, month, day, hour, minute, second });
+							times.push_back({ ye, mo, da, ho, mi, se });
 						}
 					}
+					GATS_CHECK_ALL_EQUAL(expectedDates, dates);
+					GATS_CHECK_ALL_EQUAL(expectedTimes, times);
 				}
 			}
 		}
@@ -6,6 +6,9 @@
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Regression checks of the conversion fixes.
+
 Version 2021.09.25
 	Replaced BOOST's test framework with gats_test framework.
 
@@ -55,6 +58,7 @@ GATS_TEST_CASE(ut105_test_vulcan_to_jd, VULCAN_CALENDAR_GROUP, 1) {
 
 	test(1, Zat, 1, VULCAN_EPOCH, __LINE__);
 	test(-651, Druh, 18, -1.028'571'4, __LINE__);					// beginning of the Julian Epoch
+	test(-10, 1, 1, 1'720'987.5, __LINE__);						// leap days are floored for years before 1
 
 
 	auto test2 = [this](year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t seconds, jd_t jd, int line) {
@@ -99,6 +103,11 @@ GATS_TEST_CASE(ut106_test_jd_to_vulcan, VULCAN_CALENDAR_GROUP, 1) {
 	test(-651, Druh, 18, 0, __LINE__);						// beginning of the Julian Epoch
 	test(1, Zat, 1, VULCAN_EPOCH, __LINE__);
 
+	// days count from the epoch itself, not the day after it
+	test(1, 1, 1, VULCAN_EPOCH, __LINE__);
+	test(0, 12, 22, VULCAN_EPOCH - 1, __LINE__);				// the leap day of year 0
+	test(-10, 1, 1, 1'720'987.5, __LINE__);
+
 
 	auto test2 = [this](year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second, jd_t jd, int line) {
 		year_t y;
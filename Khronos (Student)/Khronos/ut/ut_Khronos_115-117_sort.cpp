@@ -0,0 +1,135 @@
+/*	ut_Khronos_115-117_sort.cpp
+
+	Khronos library date column sorting and bucketing unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/** Radix sort, parallel sort and selection of JD and packed columns match std::sort. */
+GATS_TEST_CASE(ut115_sort_jd_column, UTILITY_GROUP, 2) {
+#if PHASE_115
+	using namespace khronos;
+
+	mt19937_64 rng(115);
+	uniform_real_distribution<jd_t> dist(-1'000'000.0, 5'000'000.0);
+	vector<jd_t> jds(200'000);
+	for (auto& jd : jds) jd = dist(rng);
+	jds[0] = 0.0; jds[1] = -0.5; jds[2] = 0.5;
+
+	auto expected = jds;
+	std::sort(expected.begin(), expected.end());
+
+	auto sorted = jds;
+	khronos::sort(sorted);
+	GATS_CHECK(sorted == expected);
+
+	auto parallel = jds;
+	khronos::sort(par, parallel);
+	GATS_CHECK(parallel == expected);
+
+	parallel = jds;
+	khronos::sort(parallel_policy{ 3 }, parallel);
+	GATS_CHECK(parallel == expected);
+
+	for (size_t nth : { size_t(0), size_t(1), jds.size() / 2, jds.size() - 1 }) {
+		auto selected = jds;
+		khronos::nth_element(selected, nth);
+		GATS_CHECK_EQUAL(selected[nth], expected[nth]);
+	}
+
+	vector<packed_date_t> packed;
+	for (size_t i = 0; i < 1'000; ++i) {
+		year_t y; month_t m; day_t d; hour_t h; minute_t mi; second_t s;
+		jd_to_gregorian(jds[i], y, m, d, h, mi, s);
+		packed.push_back(pack_date<Gregorian>(y, m, d, h, mi, s));
+	}
+	khronos::sort(packed);
+	for (size_t i = 1; i < packed.size(); ++i) {
+		auto lhs = unpack_date<Gregorian>(packed[i - 1]);
+		auto rhs = unpack_date<Gregorian>(packed[i]);
+		GATS_CHECK(lhs.to_jd() <= rhs.to_jd());
+	}
+
+	// the Hebrew year starts in Tishrei (7), so Tishrei packs before Nisan (1)
+	GATS_CHECK(pack_date<Hebrew>(5785, 7, 1) < pack_date<Hebrew>(5785, 1, 1));
+	GATS_CHECK(pack_date<Hebrew>(5784, 6, 29) < pack_date<Hebrew>(5785, 7, 1));
+	GATS_CHECK(pack_date<Hebrew>(5784, 13, 29) < pack_date<Hebrew>(5784, 1, 1));
+	year_t y; month_t m; day_t d; hour_t h; minute_t mi; second_t s;
+	unpack_date<Hebrew>(pack_date<Hebrew>(5784, 13, 29, 23, 59, 59), y, m, d, h, mi, s);
+	GATS_CHECK(y == 5784 && m == 13 && d == 29 && h == 23 && mi == 59 && s == 59);
+#endif
+}
+
+
+
+/** Sorting calendar objects orders them chronologically and is stable. */
+GATS_TEST_CASE(ut116_sort_calendar_objects, UTILITY_GROUP, 2) {
+#if PHASE_116
+	using namespace khronos;
+
+	vector<Gregorian> dates{
+		Gregorian(2012_CE, September, 24, 12, 0, 0),
+		Gregorian(1_BCE, January, 1),
+		Gregorian(2012_CE, September, 24),
+		Gregorian(1858_CE, November, 16),
+		Gregorian(2012_CE, September, 24, 6, 0, 0),
+	};
+
+	khronos::sort(dates);
+	for (size_t i = 1; i < dates.size(); ++i)
+		GATS_CHECK(dates[i - 1].to_jd() <= dates[i].to_jd());
+	GATS_CHECK_EQUAL(dates.front().year(), 0);
+	GATS_CHECK_EQUAL(dates.back().hour(), 12);
+
+	vector<Islamic> islamic{ Islamic(1433, 10, 27), Islamic(1, 1, 1), Islamic(990, 9, 17) };
+	khronos::nth_element(islamic, 1);
+	GATS_CHECK_EQUAL(islamic[1].year(), 990);
+#endif
+}
+
+
+
+/** Bucketing a sorted column by calendar periods. */
+GATS_TEST_CASE(ut117_bucket_by_period, UTILITY_GROUP, 2) {
+#if PHASE_117
+	using namespace khronos;
+
+	vector<jd_t> jds;
+	for (jd_t jd = gregorian_to_jd(2024_CE, January, 1); jd < gregorian_to_jd(2025_CE, January, 1); jd += 0.25)
+		jds.push_back(jd);
+
+	auto months = bucket<Gregorian>(jds, period::month);
+	GATS_CHECK_EQUAL(months.size(), 12u);
+	GATS_CHECK_EQUAL(months[1].count, 29u * 4);
+	GATS_CHECK_EQUAL(months[1].begin, gregorian_to_jd(2024_CE, February, 1));
+
+	auto years = bucket<Gregorian>(jds, period::year);
+	GATS_CHECK_EQUAL(years.size(), 1u);
+	GATS_CHECK_EQUAL(years[0].count, jds.size());
+
+	auto weeks = bucket<Gregorian>(jds, period::week);
+	GATS_CHECK_EQUAL(weeks.size(), 53u);	// 2024-01-01 is a Monday
+	GATS_CHECK_EQUAL(weeks[0].begin, gregorian_to_jd(2024_CE, January, 1));
+
+	// Hebrew years 5784/5785 change on 1 Tishrei (2024-10-03)
+	auto hebrewYears = bucket<Hebrew>(jds, period::year);
+	GATS_CHECK_EQUAL(hebrewYears.size(), 2u);
+	GATS_CHECK_EQUAL(hebrewYears[1].begin, hebrew_to_jd(5785, 7, 1));
+#endif
+}
@@ -0,0 +1,134 @@
+/*	ut_Khronos_118-119_rollup.cpp
+
+	Khronos library calendar rollup aggregation unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+	Exceptions thrown by worker chunks reach the caller.
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+
+
+/** Period edges come from the calendar; points are assigned by search over the edges. */
+GATS_TEST_CASE(ut118_period_edges, UTILITY_GROUP, 2) {
+#if PHASE_118
+	using namespace khronos;
+
+	jd_t const first = gregorian_to_jd(2024_CE, February, 14, 6, 0, 0);
+	jd_t const last = gregorian_to_jd(2025_CE, March, 3);
+
+	auto quarters = period_edges<Gregorian>(first, last, period::quarter);
+	GATS_CHECK_EQUAL(quarters.size(), 6u);
+	GATS_CHECK_EQUAL(quarters[0], gregorian_to_jd(2024_CE, January, 1));
+	GATS_CHECK_EQUAL(quarters[1], gregorian_to_jd(2024_CE, April, 1));
+	GATS_CHECK_EQUAL(quarters[3], gregorian_to_jd(2024_CE, October, 1));
+	GATS_CHECK_EQUAL(quarters[4], gregorian_to_jd(2025_CE, January, 1));
+	GATS_CHECK_EQUAL(quarters[5], gregorian_to_jd(2025_CE, April, 1));
+
+	auto months = period_edges<Gregorian>(first, last, period::month);
+	GATS_CHECK_EQUAL(months.size(), 15u);
+	GATS_CHECK_EQUAL(months[11], gregorian_to_jd(2025_CE, January, 1));
+	GATS_CHECK_EQUAL(months.back(), gregorian_to_jd(2025_CE, April, 1));
+
+	auto weeks = period_edges<Gregorian>(first, last, period::week);
+	GATS_CHECK_EQUAL(weeks[0], gregorian_to_jd(2024_CE, February, 12));	// Monday
+	for (size_t i = 1; i < weeks.size(); ++i)
+		GATS_CHECK_EQUAL(weeks[i] - weeks[i - 1], 7.0);
+
+	// the fourth quarter of a Hebrew leap year is Sivan through Elul
+	auto hebrew = period_edges<Hebrew>(hebrew_to_jd(5784, 7, 1), hebrew_to_jd(5784, 6, 29), period::quarter);
+	GATS_CHECK_EQUAL(hebrew.size(), 5u);
+	GATS_CHECK_EQUAL(hebrew[3], hebrew_to_jd(5784, 3, 1));
+	GATS_CHECK_EQUAL(hebrew[4], hebrew_to_jd(5785, 7, 1));
+
+	GATS_CHECK_EQUAL(locate_period(quarters, quarters[0] - 0.5), -1);
+	GATS_CHECK_EQUAL(locate_period(quarters, quarters[0]), 0);
+	GATS_CHECK_EQUAL(locate_period(quarters, quarters[2] - 0.5), 1);
+	GATS_CHECK_EQUAL(locate_period(quarters, quarters[2]), 2);
+	GATS_CHECK_EQUAL(locate_period(quarters, quarters[5] - 0.5), 4);
+	GATS_CHECK_EQUAL(locate_period(quarters, quarters[5]), -1);
+#endif
+}
+
+
+
+/** Rollup aggregates every column per period, serially and in parallel. */
+GATS_TEST_CASE(ut119_rollup, UTILITY_GROUP, 2) {
+#if PHASE_119
+	using namespace khronos;
+
+	// one reading per hour through 2024
+	vector<jd_t> jds;
+	vector<double> ones, hours;
+	jd_t const newYear = gregorian_to_jd(2024_CE, January, 1);
+	for (int hour = 0; hour < 366 * 24; ++hour) {
+		jds.push_back(newYear + hour / 24.0);
+		ones.push_back(1.0);
+		hours.push_back(hour % 24);
+	}
+
+	span<double const> const columns[] = { ones, hours };
+	auto quarters = rollup<Gregorian>(jds, columns, period::quarter, parallel_policy{ 1 });
+	GATS_CHECK_EQUAL(quarters.size(), 4u);
+	GATS_CHECK_EQUAL(quarters.counts[0], 91u * 24);		// leap year
+	GATS_CHECK_EQUAL(quarters.counts[3], 92u * 24);
+	GATS_CHECK_EQUAL(quarters.columns[0].sum[1], 91.0 * 24);
+	GATS_CHECK_EQUAL(quarters.columns[1].min[2], 0.0);
+	GATS_CHECK_EQUAL(quarters.columns[1].max[2], 23.0);
+	GATS_CHECK_EQUAL(quarters.mean(1, 0), 11.5);
+
+	auto months = rollup<Gregorian>(jds, span<double const>(ones), period::month);
+	GATS_CHECK_EQUAL(months.size(), 12u);
+	GATS_CHECK_EQUAL(months.counts[1], 29u * 24);
+	GATS_CHECK_EQUAL(months.begin(1), gregorian_to_jd(2024_CE, February, 1));
+	GATS_CHECK_EQUAL(months.end(1), gregorian_to_jd(2024_CE, March, 1));
+
+	// parallel partial tables merge to the serial result
+	mt19937_64 rng(119);
+	uniform_real_distribution<jd_t> when(jds.front(), jds.back());
+	uniform_real_distribution<double> what(-100.0, 100.0);
+	vector<jd_t> randomJds(300'000);
+	vector<double> values(randomJds.size());
+	for (size_t i = 0; i < randomJds.size(); ++i) {
+		randomJds[i] = when(rng);
+		values[i] = std::round(what(rng));	// integral values sum exactly in any order
+	}
+	auto serial = rollup<Gregorian>(randomJds, span<double const>(values), period::week, parallel_policy{ 1 });
+	auto parallel = rollup<Gregorian>(randomJds, span<double const>(values), period::week, parallel_policy{ 4 });
+	GATS_CHECK(serial.edges == parallel.edges);
+	GATS_CHECK(serial.counts == parallel.counts);
+	GATS_CHECK(serial.columns[0].sum == parallel.columns[0].sum);
+	GATS_CHECK(serial.columns[0].min == parallel.columns[0].min);
+	GATS_CHECK(serial.columns[0].max == parallel.columns[0].max);
+
+	uint64_t total = 0;
+	for (auto count : serial.counts) total += count;
+	GATS_CHECK_EQUAL(total, randomJds.size());
+
+	// a chunk that throws on a worker thread: every chunk still runs, and the caller gets the first exception
+	atomic<unsigned> ran = 0;
+	auto throwing = [&](unsigned chunk, size_t, size_t) {
+		++ran;
+		if (chunk == 2)
+			throw std::runtime_error("chunk 2");
+		if (chunk == 3)
+			throw std::logic_error("chunk 3");
+	};
+	GATS_CHECK_THROW(detail::parallel_chunks(1'000, 4, throwing), std::runtime_error);
+	GATS_CHECK_EQUAL(ran.load(), 4u);
+#endif
+}
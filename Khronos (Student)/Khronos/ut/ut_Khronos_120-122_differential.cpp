@@ -0,0 +1,134 @@
+/*	ut_Khronos_120-122_differential.cpp
+
+	Khronos library differential tests: the conversions and Gregorian
+	arithmetic against std::chrono and the reference algorithms of
+	ut_reference.cpp, on seeded random samples.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include "ut_differential.hpp"
+#include <initializer_list>
+#include <mutex>
+#include <random>
+using namespace std;
+
+
+
+namespace {
+	constexpr uint64_t SEED = 120;
+	constexpr long long BATCHES = 64;
+	constexpr int BATCH_SIZE = 4'096;
+
+	/** Runs the differential checks on 'calendars' across the case pool; each batch has its own seeded generator. */
+	differential::coverage run_differential(initializer_list<reference::calendar> calendars) {
+		differential::coverage total;
+		mutex totalMutex;
+		GATS_PARALLEL_FOR(batch, 0LL, BATCHES, {
+			mt19937_64 rng(SEED + batch);
+			differential::coverage cov;
+			for (auto cal : calendars) {
+				for (int i = 0; i < BATCH_SIZE; ++i) {
+					auto const s = differential::generate(rng, cal);
+					auto failure = differential::check_conversion(s, cov);
+					GATS_CHECK_MESSAGE(failure.empty(), failure);
+					failure = differential::check_arithmetic(s, cov);
+					GATS_CHECK_MESSAGE(failure.empty(), failure);
+				}
+			}
+			lock_guard lock(totalMutex);
+			total += cov;
+		});
+		return total;
+	}
+
+	/** Every feature of the input space was exercised. */
+	void check_coverage(differential::coverage const& cov, reference::calendar cal, initializer_list<differential::feature> features) {
+		for (auto f : features)
+			GATS_CHECK_MESSAGE(cov.hits[static_cast<int>(cal)][f] > 0,
+				reference::calendar_name(cal) << " samples never exercised: " << differential::feature_name(f));
+	}
+
+	initializer_list<differential::feature> const conversionFeatures = {
+		differential::year_before_1, differential::distant_year, differential::leap_year, differential::common_year,
+		differential::new_year_day, differential::last_day_of_month, differential::intercalary_day, differential::midnight
+	};
+}
+
+
+
+/** Gregorian conversions and month/year arithmetic against std::chrono. */
+GATS_TEST_CASE(ut120_differential_gregorian, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_120
+	using reference::calendar;
+
+	auto cov = run_differential({ calendar::gregorian });
+	check_coverage(cov, calendar::gregorian, conversionFeatures);
+	check_coverage(cov, calendar::gregorian, { differential::clamped_day });
+#endif
+}
+
+
+
+/** Julian, Islamic, Hebrew and Vulcan conversions and month arithmetic against the reference algorithms. */
+GATS_TEST_CASE(ut121_differential_calendars, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_121
+	using reference::calendar;
+
+	auto cov = run_differential({ calendar::julian, calendar::islamic, calendar::hebrew, calendar::vulcan });
+	for (auto cal : { calendar::julian, calendar::islamic, calendar::hebrew, calendar::vulcan }) {
+		check_coverage(cov, cal, conversionFeatures);
+		check_coverage(cov, cal, { differential::clamped_day });
+	}
+#endif
+}
+
+
+
+/** The reference algorithms agree with published dates. */
+GATS_TEST_CASE(ut122_reference_known_dates, UTILITY_GROUP, 1) {
+#if PHASE_122
+	using reference::calendar;
+	using reference::to_day_number;
+	using reference::from_day_number;
+
+	// Day numbers are JD + 0.5
+	GATS_CHECK_EQUAL(to_day_number(calendar::gregorian, { -4713, 11, 24 }), 0);
+	GATS_CHECK_EQUAL(to_day_number(calendar::gregorian, { 1582, 10, 15 }), 2'299'161);
+	GATS_CHECK_EQUAL(to_day_number(calendar::gregorian, { 2000, 1, 1 }), 2'451'545);
+
+	GATS_CHECK_EQUAL(to_day_number(calendar::julian, { -4712, 1, 1 }), 0);
+	GATS_CHECK_EQUAL(to_day_number(calendar::julian, { 1582, 10, 4 }), 2'299'160);
+	GATS_CHECK(from_day_number(calendar::julian, 2'451'545) == (reference::date{ 1999, 12, 19 }));
+
+	GATS_CHECK_EQUAL(to_day_number(calendar::islamic, { -5498, 8, 16 }), 0);
+	GATS_CHECK_EQUAL(to_day_number(calendar::islamic, { 1, 1, 1 }), 1'948'440);
+	GATS_CHECK_EQUAL(to_day_number(calendar::islamic, { 990, 9, 17 }), 2'299'161);
+	GATS_CHECK_EQUAL(to_day_number(calendar::islamic, { 1557, 6, 18 }), 2'500'000);
+
+	GATS_CHECK_EQUAL(to_day_number(calendar::hebrew, { -952, 10, 20 }), 0);
+	GATS_CHECK_EQUAL(to_day_number(calendar::hebrew, { 1, 7, 1 }), 347'998);
+	GATS_CHECK_EQUAL(to_day_number(calendar::hebrew, { 1, 1, 1 }), 348'176);
+	GATS_CHECK_EQUAL(to_day_number(calendar::hebrew, { 5343, 7, 19 }), 2'299'161);
+	GATS_CHECK_EQUAL(to_day_number(calendar::hebrew, { 5772, 6, 27 }), 2'456'185);
+	GATS_CHECK_EQUAL(to_day_number(calendar::hebrew, { 5892, 6, 19 }), 2'500'000);
+
+	// Rosh Hashanah 5783-5786: complete, deficient and leap years
+	GATS_CHECK_EQUAL(reference::new_year(calendar::hebrew, 5783), to_day_number(calendar::gregorian, { 2022, 9, 26 }));
+	GATS_CHECK_EQUAL(reference::new_year(calendar::hebrew, 5784), to_day_number(calendar::gregorian, { 2023, 9, 16 }));
+	GATS_CHECK_EQUAL(reference::new_year(calendar::hebrew, 5785), to_day_number(calendar::gregorian, { 2024, 10, 3 }));
+	GATS_CHECK_EQUAL(reference::new_year(calendar::hebrew, 5786), to_day_number(calendar::gregorian, { 2025, 9, 23 }));
+
+	GATS_CHECK_EQUAL(to_day_number(calendar::vulcan, { 1, 1, 1 }), 1'723'763);
+	GATS_CHECK_EQUAL(to_day_number(calendar::vulcan, { 5, 1, 1 }), 1'723'763 + 4 * 252 + 1);
+#endif
+}
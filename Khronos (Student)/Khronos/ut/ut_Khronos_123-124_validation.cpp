@@ -0,0 +1,145 @@
+/*	ut_Khronos_123-124_validation.cpp
+
+	Khronos library date validation unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/** is_valid and make_date follow each calendar's month and day rules. */
+GATS_TEST_CASE(ut123_validate_dates, UTILITY_GROUP, 1) {
+#if PHASE_123
+	using namespace khronos;
+
+	GATS_CHECK(is_valid<Gregorian>(2024, 2, 29));
+	GATS_CHECK(!is_valid<Gregorian>(2023, 2, 29));
+	GATS_CHECK(!is_valid<Gregorian>(2023, 2, 30));
+	GATS_CHECK(!is_valid<Gregorian>(1900, 2, 29));
+	GATS_CHECK(is_valid<Gregorian>(-4800, 2, 29));
+	GATS_CHECK(!is_valid<Gregorian>(2023, 0, 1));
+	GATS_CHECK(!is_valid<Gregorian>(2023, 13, 1));
+	GATS_CHECK(!is_valid<Gregorian>(2023, 4, 31));
+	GATS_CHECK(!is_valid<Gregorian>(2023, 4, 0));
+
+	GATS_CHECK(is_valid<Julian>(1900, 2, 29));
+	GATS_CHECK(!is_valid<Julian>(1901, 2, 29));
+
+	GATS_CHECK(is_valid<Islamic>(2, 12, 30));
+	GATS_CHECK(!is_valid<Islamic>(1, 12, 30));
+	GATS_CHECK(!is_valid<Islamic>(1, 2, 30));
+
+	// Adar II only in leap years; Cheshvan 30 only in complete years, Kislev 30 not in deficient years
+	GATS_CHECK(is_valid<Hebrew>(5784, 13, 29));
+	GATS_CHECK(!is_valid<Hebrew>(5783, 13, 1));
+	GATS_CHECK(is_valid<Hebrew>(5783, 8, 30));		// 355 days
+	GATS_CHECK(!is_valid<Hebrew>(5784, 8, 30));		// 383 days
+	GATS_CHECK(!is_valid<Hebrew>(5784, 9, 30));
+	GATS_CHECK(is_valid<Hebrew>(5785, 9, 30));		// 355 days
+
+	GATS_CHECK(is_valid<Vulcan>(4, 12, 22));
+	GATS_CHECK(!is_valid<Vulcan>(5, 12, 22));
+	GATS_CHECK(!is_valid<Vulcan>(4, 11, 22));
+
+	GATS_CHECK(is_valid<Gregorian>(2023, 2, 28, 23, 59, 59.999));
+	GATS_CHECK(!is_valid<Gregorian>(2023, 2, 28, 24, 0, 0));
+	GATS_CHECK(!is_valid<Gregorian>(2023, 2, 28, 0, 60, 0));
+	GATS_CHECK(!is_valid<Gregorian>(2023, 2, 28, 0, 0, 60.0));
+	GATS_CHECK(!is_valid<Gregorian>(2023, 2, 28, 0, 0, -0.5));
+
+	auto date = make_date<Gregorian>(2024, 2, 29);
+	GATS_CHECK(date.has_value());
+	GATS_CHECK_EQUAL(date->to_jd(), gregorian_to_jd(2024, 2, 29));
+
+	GATS_CHECK(make_date<Gregorian>(2023, 2, 29).error() == date_error::day);
+	GATS_CHECK(make_date<Gregorian>(2023, 14, 1).error() == date_error::month);
+	GATS_CHECK(make_date<Hebrew>(5783, 13, 1).error() == date_error::month);
+	GATS_CHECK(make_date<Gregorian>(2023, 2, 29, 25, 0, 0).error() == date_error::day);
+	GATS_CHECK(make_date<Gregorian>(2023, 2, 28, 25, 0, 0).error() == date_error::hour);
+	GATS_CHECK(make_date<Gregorian>(2023, 2, 28, 1, 0, 61).error() == date_error::second);
+
+	auto timed = make_date<Julian>(2000, 1, 1, 12, 30, 15.0);
+	GATS_CHECK(timed.has_value());
+	GATS_CHECK_EQUAL(timed->minute(), 30);
+#endif
+}
+
+
+
+/** Column validation matches is_valid, serially and across threads. */
+GATS_TEST_CASE(ut124_validate_columns, UTILITY_GROUP, 1) {
+#if PHASE_124
+	using namespace khronos;
+
+	constexpr size_t N = 300'007;		// a partial last mask word
+	mt19937_64 rng(124);
+	uniform_int_distribution<year_t> yearDist(-3000, 6000);
+	uniform_int_distribution<int> monthDist(0, 14), dayDist(-1, 32), hourDist(-1, 24), minuteDist(-1, 60);
+	uniform_real_distribution<second_t> secondDist(-1.0, 61.0);
+
+	vector<year_t> years(N);
+	vector<month_t> months(N);
+	vector<day_t> days(N);
+	vector<hour_t> hours(N);
+	vector<minute_t> minutes(N);
+	vector<second_t> seconds(N);
+	for (size_t i = 0; i < N; ++i) {
+		years[i] = yearDist(rng);
+		months[i] = monthDist(rng);
+		days[i] = dayDist(rng);
+		hours[i] = hourDist(rng);
+		minutes[i] = minuteDist(rng);
+		seconds[i] = secondDist(rng);
+	}
+
+	auto check_columns = [&]<typename Calendar>(Calendar const*) {
+		vector<uint64_t> expected(validity_mask_words(N)), expectedTimed(validity_mask_words(N));
+		size_t nExpected = 0, nExpectedTimed = 0;
+		for (size_t i = 0; i < N; ++i) {
+			if (is_valid<Calendar>(years[i], months[i], days[i])) {
+				expected[i / 64] |= uint64_t(1) << (i % 64);
+				++nExpected;
+			}
+			if (is_valid<Calendar>(years[i], months[i], days[i], hours[i], minutes[i], seconds[i])) {
+				expectedTimed[i / 64] |= uint64_t(1) << (i % 64);
+				++nExpectedTimed;
+			}
+		}
+		GATS_CHECK(nExpected > 0 && nExpected < N);
+
+		vector<uint64_t> mask(validity_mask_words(N), ~uint64_t(0));
+		GATS_CHECK_EQUAL(validate<Calendar>(years, months, days, mask), nExpected);
+		GATS_CHECK_ALL_EQUAL(mask, expected);
+
+		GATS_CHECK_EQUAL(validate<Calendar>(parallel_policy{ 4 }, years, months, days, mask), nExpected);
+		GATS_CHECK_ALL_EQUAL(mask, expected);
+
+		GATS_CHECK_EQUAL(validate<Calendar>(years, months, days, hours, minutes, seconds, mask), nExpectedTimed);
+		GATS_CHECK_ALL_EQUAL(mask, expectedTimed);
+
+		GATS_CHECK_EQUAL(validate<Calendar>(parallel_policy{ 3 }, years, months, days, hours, minutes, seconds, mask), nExpectedTimed);
+		GATS_CHECK_ALL_EQUAL(mask, expectedTimed);
+	};
+	check_columns(static_cast<Gregorian const*>(nullptr));
+	check_columns(static_cast<Julian const*>(nullptr));
+	check_columns(static_cast<Islamic const*>(nullptr));
+	check_columns(static_cast<Hebrew const*>(nullptr));
+	check_columns(static_cast<Vulcan const*>(nullptr));
+
+	vector<uint64_t> none;
+	GATS_CHECK_EQUAL(validate<Gregorian>(span<year_t const>(), span<month_t const>(), span<day_t const>(), none), 0u);
+#endif
+}
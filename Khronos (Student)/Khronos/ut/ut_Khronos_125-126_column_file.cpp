@@ -0,0 +1,207 @@
+/*	ut_Khronos_125-126_column_file.cpp
+
+	Khronos library tick conversion and memory-mapped column file unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+	Delta blocks store their checkpoints; format version 2.
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	/** A column file in the temporary directory, removed when the test ends. */
+	struct temp_file {
+		filesystem::path path;
+		explicit temp_file(char const* name) : path(filesystem::temp_directory_path() / name) {}
+		~temp_file() { error_code ec; filesystem::remove(path, ec); }
+	};
+}
+
+
+
+/** Ticks are exact microseconds and round trip historical JDs. */
+GATS_TEST_CASE(ut125_column_file_round_trip, UTILITY_GROUP, 1) {
+#if PHASE_125
+	using namespace khronos;
+
+	GATS_CHECK_EQUAL(jd_to_ticks(0.0), 0);
+	GATS_CHECK_EQUAL(jd_to_ticks(-0.5), -TICKS_PER_DAY / 2);
+	GATS_CHECK_EQUAL(jd_to_ticks(2'451'545.0), 2'451'545 * TICKS_PER_DAY);
+	GATS_CHECK_EQUAL(jd_to_ticks(2'451'544.5 + 1.0 / 1024), 2'451'544 * TICKS_PER_DAY + TICKS_PER_DAY / 2 + TICKS_PER_DAY / 1024);
+	GATS_CHECK_EQUAL(ticks_to_jd(-TICKS_PER_DAY / 2), -0.5);
+
+	mt19937_64 rng(125);
+	uniform_real_distribution<jd_t> jdDist(1'000'000.0, 3'000'000.0);
+	bool roundTrips = true;
+	for (int i = 0; i < 100'000; ++i) {
+		jd_t const jd = jdDist(rng);
+		roundTrips &= ticks_to_jd(jd_to_ticks(jd)) == jd;
+	}
+	GATS_CHECK(roundTrips);
+
+	// mostly one second apart; the 30-day gap in block 5 is too large for a delta block
+	vector<tick_t> ticks(10'000);
+	tick_t t = jd_to_ticks(gregorian_to_jd(2024, 1, 1));
+	for (size_t i = 0; i < ticks.size(); ++i) {
+		ticks[i] = t;
+		t += i == 5'500 ? 30 * TICKS_PER_DAY : i % 7 ? 1'000'000 : 250'000;
+	}
+
+	for (auto encoding : { column_encoding::raw, column_encoding::delta }) {
+		temp_file file("ut125_khronos.kcol");
+		{
+			column_file_writer writer(file.path, { 1'000, encoding });
+			writer.append(span<tick_t const>(ticks).first(1'234));
+			writer.append(span<tick_t const>(ticks).subspan(1'234));
+			GATS_CHECK_EQUAL(writer.rows(), ticks.size());
+		}
+
+		column_file const col(file.path);
+		GATS_CHECK_EQUAL(col.rows(), ticks.size());
+		GATS_CHECK_EQUAL(col.blocks().size(), 10u);
+
+		vector<tick_t> read, buffer;
+		size_t nDelta = 0;
+		for (size_t b = 0; b < col.blocks().size(); ++b) {
+			auto const& block = col.blocks()[b];
+			auto const blockTicks = col.block_ticks(b, buffer);
+			GATS_CHECK_EQUAL(block.min, *ranges::min_element(blockTicks));
+			GATS_CHECK_EQUAL(block.max, *ranges::max_element(blockTicks));
+			read.insert(read.end(), blockTicks.begin(), blockTicks.end());
+			nDelta += block.encoding == column_encoding::delta;
+		}
+		GATS_CHECK_ALL_EQUAL(read, ticks);
+		GATS_CHECK_EQUAL(nDelta, encoding == column_encoding::delta ? 9u : 0u);
+
+		GATS_CHECK_EQUAL(col.tick(0), ticks[0]);
+		GATS_CHECK_EQUAL(col.tick(4'321), ticks[4'321]);
+		GATS_CHECK_EQUAL(col.tick(9'999), ticks[9'999]);
+		bool sequential = true;		// every row, across the checkpoints of the delta blocks
+		for (size_t row = 0; row < ticks.size(); ++row)
+			sequential &= col.tick(row) == ticks[row];
+		GATS_CHECK(sequential);
+		GATS_CHECK_EQUAL(col.jd(0), gregorian_to_jd(2024, 1, 1));
+		GATS_CHECK(col.date<Gregorian>(0) == Gregorian(2024, 1, 1));
+		GATS_CHECK(col.date<Hebrew>(0) == Hebrew(5784, 10, 20));
+	}
+
+	// JD columns are stored as ticks
+	temp_file file("ut125_khronos_jd.kcol");
+	vector<jd_t> const jds = { 2'451'544.5, 2'460'310.75, 0.0, -1'000.25 };
+	{
+		column_file_writer writer(file.path);
+		writer.append(span<jd_t const>(jds));
+	}
+	column_file const col(file.path);
+	for (size_t i = 0; i < jds.size(); ++i)
+		GATS_CHECK_EQUAL(col.jd(i), jds[i]);
+	GATS_CHECK_THROW(col.tick(jds.size()), std::out_of_range);
+	GATS_CHECK_THROW(col.tick(~uint64_t(0)), std::out_of_range);
+	vector<tick_t> buffer;
+	GATS_CHECK_THROW(col.block_ticks(col.blocks().size(), buffer), std::out_of_range);
+
+	// a file whose first block is not full: blocks of 2 and 3 rows, 4 rows per block
+	temp_file partial("ut125_khronos_partial.kcol"), version1("ut125_khronos_version1.kcol");
+	{
+		string bytes;
+		auto const put = [&](auto const& value) { bytes.append(reinterpret_cast<char const*>(&value), sizeof value); };
+		auto const pad = [&] { bytes.resize((bytes.size() + 63) / 64 * 64, '\0'); };
+		bytes.append("KHRNCOL1", 8);
+		put(uint32_t(2));
+		put(uint32_t(4));
+		pad();
+		for (tick_t t : { 10, 20 })
+			put(t);
+		pad();
+		for (tick_t t : { 30, 40, 50 })
+			put(t);
+		pad();
+		uint64_t const indexOffset = bytes.size();
+		put(column_block_info{ 64, 2, column_encoding::raw, 10, 20 });
+		put(column_block_info{ 128, 3, column_encoding::raw, 30, 50 });
+		put(indexOffset);
+		put(uint64_t(2));
+		put(uint64_t(5));
+		bytes.append("KHRNCOL1", 8);
+		ofstream(partial.path, ios::binary) << bytes;
+		bytes[8] = 1;		// the format before delta blocks stored their checkpoints
+		ofstream(version1.path, ios::binary) << bytes;
+	}
+	column_file const shortBlocks(partial.path);
+	GATS_CHECK_EQUAL(shortBlocks.rows(), 5u);
+	vector<tick_t> rows;
+	for (uint64_t row = 0; row < shortBlocks.rows(); ++row)
+		rows.push_back(shortBlocks.tick(row));
+	GATS_CHECK(rows == vector<tick_t>({ 10, 20, 30, 40, 50 }));
+	GATS_CHECK_THROW(shortBlocks.tick(5), std::out_of_range);
+	GATS_CHECK_THROW(column_file{ version1.path }, std::runtime_error);
+
+	// not a column file
+	temp_file junk("ut125_khronos_junk.kcol");
+	ofstream(junk.path) << "2024-01-01T00:00:00\n";
+	GATS_CHECK_THROW(column_file{ junk.path }, std::runtime_error);
+	GATS_CHECK_THROW(column_file{ filesystem::temp_directory_path() / "ut125_khronos_missing.kcol" }, std::runtime_error);
+#endif
+}
+
+
+
+/** Range scans match a full scan and skip the blocks outside the range. */
+GATS_TEST_CASE(ut126_column_file_range_scan, UTILITY_GROUP, 1) {
+#if PHASE_126
+	using namespace khronos;
+
+	// one reading a minute for a year
+	jd_t const start = gregorian_to_jd(2023, 1, 1);
+	vector<jd_t> jds(365 * 24 * 60);
+	for (size_t i = 0; i < jds.size(); ++i)
+		jds[i] = ticks_to_jd(jd_to_ticks(start) + tick_t(i) * 60'000'000);
+
+	temp_file file("ut126_khronos.kcol");
+	{
+		column_file_writer writer(file.path, { 4'096, column_encoding::delta });
+		writer.append(span<jd_t const>(jds));
+	}
+	column_file const col(file.path);
+	GATS_CHECK(ranges::all_of(col.blocks(), [](auto const& b) { return b.encoding == column_encoding::delta; }));
+	GATS_CHECK(filesystem::file_size(file.path) < jds.size() * sizeof(tick_t) * 6 / 10);
+
+	jd_t const first = gregorian_to_jd(2023, 3, 1), last = gregorian_to_jd(2023, 3, 8);
+	vector<jd_t> expected;
+	for (jd_t jd : jds)
+		if (jd >= first && jd < last)
+			expected.push_back(jd);
+	GATS_CHECK_EQUAL(expected.size(), 7u * 24 * 60);
+	GATS_CHECK_ALL_EQUAL(col.select(first, last), expected);
+
+	size_t nOverlapping = 0;
+	for (auto const& block : col.blocks())
+		nOverlapping += block.overlaps(jd_to_ticks(first), jd_to_ticks(last));
+	GATS_CHECK(nOverlapping <= 4);
+
+	uint64_t firstRow = ~uint64_t(0);
+	col.scan(first, last, [&](uint64_t row, tick_t) { firstRow = min(firstRow, row); });
+	GATS_CHECK_EQUAL(firstRow, (31u + 28u) * 24 * 60);
+
+	GATS_CHECK(col.select(last, first).empty());
+	GATS_CHECK(col.select(start - 10, start).empty());
+#endif
+}
@@ -0,0 +1,131 @@
+/*	ut_Khronos_127-128_tick_codec.cpp
+
+	Khronos library delta-of-delta tick codec unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <limits>
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/** Any tick column round trips, whether encoded at once or a chunk at a time. */
+GATS_TEST_CASE(ut127_tick_codec_round_trip, UTILITY_GROUP, 1) {
+#if PHASE_127
+	using namespace khronos;
+
+	GATS_CHECK_EQUAL(detail::zigzag_encode(0), 0u);
+	GATS_CHECK_EQUAL(detail::zigzag_encode(-1), 1u);
+	GATS_CHECK_EQUAL(detail::zigzag_encode(1), 2u);
+	GATS_CHECK_EQUAL(detail::zigzag_encode(numeric_limits<int64_t>::min()), numeric_limits<uint64_t>::max());
+	GATS_CHECK_EQUAL(detail::zigzag_decode(numeric_limits<uint64_t>::max()), numeric_limits<int64_t>::min());
+	GATS_CHECK_EQUAL(detail::zigzag_decode(detail::zigzag_encode(-123'456'789)), -123'456'789);
+
+	GATS_CHECK(encode_ticks({}).empty());
+
+	// constant runs, jitter, gaps, backwards steps and the extremes of tick_t
+	mt19937_64 rng(127);
+	uniform_int_distribution<int> kind(0, 9);
+	uniform_int_distribution<tick_t> jitter(-500, 500), any(numeric_limits<tick_t>::min(), numeric_limits<tick_t>::max());
+	vector<tick_t> ticks(100'000);
+	tick_t t = jd_to_ticks(2'460'000.5);
+	for (auto& tick : ticks) {
+		switch (kind(rng)) {
+		case 0: t += jitter(rng); break;
+		case 1: t -= 3'600'000'000; break;
+		case 2: t = any(rng); break;
+		default: t += 1'000'000; break;
+		}
+		tick = t;
+	}
+	ticks[10] = numeric_limits<tick_t>::min();
+	ticks[11] = numeric_limits<tick_t>::max();
+	ticks[12] = numeric_limits<tick_t>::min();
+
+	auto const bytes = encode_ticks(ticks);
+	GATS_CHECK_EQUAL(decoded_size(bytes), ticks.size());
+	vector<tick_t> decoded(ticks.size());
+	GATS_CHECK_EQUAL(decode_ticks(bytes, decoded), ticks.size());
+	GATS_CHECK_ALL_EQUAL(decoded, ticks);
+
+	tick_encoder encoder;
+	for (size_t first = 0; first < ticks.size(); first += 777)
+		encoder.append(span<tick_t const>(ticks).subspan(first, min<size_t>(777, ticks.size() - first)));
+	encoder.flush();
+	GATS_CHECK_EQUAL(encoder.rows(), ticks.size());
+	GATS_CHECK(ranges::equal(encoder.bytes(), bytes));
+
+	// flushing mid-run still decodes to the same rows
+	encoder.clear();
+	vector<tick_t> const regular = { 0, 10, 20, 30, 40, 50, 60 };
+	encoder.append(span<tick_t const>(regular).first(4));
+	encoder.flush();
+	encoder.append(span<tick_t const>(regular).subspan(4));
+	encoder.flush();
+	vector<tick_t> out(regular.size());
+	GATS_CHECK_EQUAL(decode_ticks(encoder.bytes(), out), regular.size());
+	GATS_CHECK_ALL_EQUAL(out, regular);
+
+	// a short output span stops the decode
+	vector<tick_t> head(5'000);
+	GATS_CHECK_EQUAL(decode_ticks(bytes, head), head.size());
+	GATS_CHECK(ranges::equal(head, span<tick_t const>(ticks).first(head.size())));
+
+	// a truncated stream yields the rows before the cut
+	GATS_CHECK(decode_ticks(span<uint8_t const>(bytes).first(bytes.size() / 2), decoded) < ticks.size());
+#endif
+}
+
+
+
+/** Telemetry at a constant interval compresses well and decodes straight to JDs. */
+GATS_TEST_CASE(ut128_tick_codec_telemetry, UTILITY_GROUP, 1) {
+#if PHASE_128
+	using namespace khronos;
+
+	// once a second, with an occasional late sample and a gap
+	mt19937_64 rng(128);
+	uniform_int_distribution<int> late(0, 99);
+	vector<tick_t> ticks(86'400);
+	tick_t t = jd_to_ticks(gregorian_to_jd(2024, 6, 1));
+	for (size_t i = 0; i < ticks.size(); ++i) {
+		ticks[i] = t + (late(rng) == 0 ? 1'500 : 0);
+		t += i == 40'000 ? 3'600'000'000 : 1'000'000;
+	}
+
+	tick_encoder encoder;
+	encoder.append(span<tick_t const>(ticks));
+	encoder.flush();
+	GATS_CHECK(encoder.bytes().size() * 10 < ticks.size() * sizeof(jd_t));
+
+	vector<jd_t> expected(ticks.size()), decoded(ticks.size());
+	ranges::transform(ticks, expected.begin(), ticks_to_jd);
+	GATS_CHECK_EQUAL(decode_jds(encoder.bytes(), decoded), ticks.size());
+	GATS_CHECK_ALL_EQUAL(decoded, expected);
+
+	// JD columns round trip; their rounding to the double is noise, so they compress less
+	encoder.clear();
+	encoder.append(span<jd_t const>(expected));
+	encoder.flush();
+	GATS_CHECK_EQUAL(decode_jds(encoder.bytes(), decoded), ticks.size());
+	GATS_CHECK_ALL_EQUAL(decoded, expected);
+
+	// a perfectly regular stream is a handful of bytes
+	vector<tick_t> regular(1'000'000);
+	for (size_t i = 0; i < regular.size(); ++i)
+		regular[i] = tick_t(i) * 250'000;
+	GATS_CHECK(encode_ticks(regular).size() < 16);
+#endif
+}
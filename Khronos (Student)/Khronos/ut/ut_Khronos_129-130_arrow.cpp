@@ -0,0 +1,201 @@
+/*	ut_Khronos_129-130_arrow.cpp
+
+	Khronos library Arrow C Data Interface unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+
+
+/** Date columns export as date32 and timestamp[ns] arrays and import back. */
+GATS_TEST_CASE(ut129_arrow_export_import, UTILITY_GROUP, 1) {
+#if PHASE_129
+	using namespace khronos;
+
+	vector<jd_t> const jds = {
+		gregorian_to_jd(1970, 1, 1), gregorian_to_jd(2000, 1, 1, 12, 0, 0), gregorian_to_jd(1969, 12, 31, 23, 59, 59),
+		nan(""), gregorian_to_jd(1600, 1, 1), gregorian_to_jd(2024, 2, 29, 6, 30, 0) };
+
+	ArrowArray array;
+	ArrowSchema schema;
+	export_arrow(jds, arrow_date_type::date32, &array, &schema);
+	GATS_CHECK(strcmp(schema.format, "tdD") == 0);
+	GATS_CHECK(schema.flags & ARROW_FLAG_NULLABLE);
+	GATS_CHECK_EQUAL(array.length, 6);
+	GATS_CHECK_EQUAL(array.null_count, 1);
+	GATS_CHECK_EQUAL(array.n_buffers, 2);
+	auto const* days = static_cast<int32_t const*>(array.buffers[1]);
+	GATS_CHECK_EQUAL(days[0], 0);
+	GATS_CHECK_EQUAL(days[1], 10'957);
+	GATS_CHECK_EQUAL(days[2], -1);
+	GATS_CHECK_EQUAL(days[4], -135'140);
+	GATS_CHECK_EQUAL(static_cast<uint8_t const*>(array.buffers[0])[0] & 0b111111, 0b110111);
+
+	auto imported = import_arrow(&array, &schema);
+	GATS_CHECK_EQUAL(imported[0], gregorian_to_jd(1970, 1, 1));
+	GATS_CHECK_EQUAL(imported[1], gregorian_to_jd(2000, 1, 1));
+	GATS_CHECK_EQUAL(imported[2], gregorian_to_jd(1969, 12, 31));
+	GATS_CHECK(isnan(imported[3]));
+	GATS_CHECK_EQUAL(imported[5], gregorian_to_jd(2024, 2, 29));
+
+	// a slice of the array
+	array.offset = 4;
+	array.length = 2;
+	imported = import_arrow(&array, &schema);
+	GATS_CHECK_EQUAL(imported.size(), 2u);
+	GATS_CHECK_EQUAL(imported[0], gregorian_to_jd(1600, 1, 1));
+
+	array.release(&array);
+	schema.release(&schema);
+	GATS_CHECK(array.release == nullptr && schema.release == nullptr);
+
+	// 1600 is outside timestamp[ns]
+	export_arrow(jds, arrow_date_type::timestamp_ns, &array, &schema);
+	GATS_CHECK(strcmp(schema.format, "tsn:") == 0);
+	GATS_CHECK_EQUAL(array.null_count, 2);
+	auto const* ns = static_cast<int64_t const*>(array.buffers[1]);
+	GATS_CHECK_EQUAL(ns[0], 0);
+	GATS_CHECK_EQUAL(ns[1], 946'728'000'000'000'000);
+	GATS_CHECK(abs(ns[2] + 1'000'000'000) < 50'000);		// the JD double is exact to tens of microseconds
+	imported = import_arrow(&array, &schema);
+	for (size_t i : { 0, 1, 2, 5 })
+		GATS_CHECK_EQUAL(imported[i], ticks_to_jd(jd_to_ticks(jds[i])));
+	GATS_CHECK(isnan(imported[3]) && isnan(imported[4]));
+	array.release(&array);
+	schema.release(&schema);
+
+	// vectors in Arrow units move into the array
+	vector<int32_t> unixDays = { 0, 19'782, -719'528 };
+	int32_t const* const buffer = unixDays.data();
+	export_arrow(std::move(unixDays), &array, &schema);
+	GATS_CHECK(array.buffers[1] == buffer);
+	GATS_CHECK(array.buffers[0] == nullptr);
+	GATS_CHECK_EQUAL(array.null_count, 0);
+	imported = import_arrow(&array, &schema);
+	GATS_CHECK(Gregorian(imported[1]) == Gregorian(2024, 2, 29));
+	GATS_CHECK(Gregorian(imported[2]) == Gregorian(0, 1, 1));
+	array.release(&array);
+	schema.release(&schema);
+
+	vector<int64_t> unixNs = { 1'500, -1'500 };
+	export_arrow(std::move(unixNs), &array, &schema);
+	imported = import_arrow(&array, &schema);
+	GATS_CHECK_EQUAL(imported[0], ticks_to_jd(UNIX_EPOCH_TICKS + 1));
+	GATS_CHECK_EQUAL(imported[1], ticks_to_jd(UNIX_EPOCH_TICKS - 2));
+	array.release(&array);
+	schema.release(&schema);
+
+	// timestamps of other units and time zones, from another producer
+	int64_t const seconds[] = { 86'400, -86'400 };
+	void const* buffers[] = { nullptr, seconds };
+	ArrowArray foreign{ 2, 0, 0, 2, 0, buffers, nullptr, nullptr, nullptr, nullptr };
+	ArrowSchema foreignSchema{ "tss:America/Toronto", "", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+	imported = import_arrow(&foreign, &foreignSchema);
+	GATS_CHECK_EQUAL(imported[0], UNIX_EPOCH_JD + 1);
+	GATS_CHECK_EQUAL(imported[1], UNIX_EPOCH_JD - 1);
+
+	// values whose ticks would overflow int64 import in double
+	int32_t const farDays[] = { 200'000'000, -200'000'000, numeric_limits<int32_t>::max(), numeric_limits<int32_t>::min() };
+	void const* farDayBuffers[] = { nullptr, farDays };
+	ArrowArray farDayArray{ 4, 0, 0, 2, 0, farDayBuffers, nullptr, nullptr, nullptr, nullptr };
+	ArrowSchema farDaySchema{ "tdD", "", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+	imported = import_arrow(&farDayArray, &farDaySchema);
+	GATS_CHECK_EQUAL(imported[0], 202'440'587.5);
+	GATS_CHECK_EQUAL(imported[1], -197'559'412.5);
+	GATS_CHECK_EQUAL(imported[2], UNIX_EPOCH_JD + numeric_limits<int32_t>::max());
+	GATS_CHECK_EQUAL(imported[3], UNIX_EPOCH_JD + numeric_limits<int32_t>::min());
+
+	int64_t const farValues[] = { numeric_limits<int64_t>::max(), numeric_limits<int64_t>::min(), 9'000'000'000'000'000 };
+	void const* farBuffers[] = { nullptr, farValues };
+	ArrowArray farArray{ 3, 0, 0, 2, 0, farBuffers, nullptr, nullptr, nullptr, nullptr };
+	ArrowSchema farSchema{ "tdm", "", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+	for (char const* format : { "tdm", "tss:", "tsm:", "tsu:", "tsn:" }) {
+		farSchema.format = format;
+		imported = import_arrow(&farArray, &farSchema);
+		GATS_CHECK(imported[0] > UNIX_EPOCH_JD && isfinite(imported[0]));
+		GATS_CHECK(imported[1] < UNIX_EPOCH_JD && isfinite(imported[1]));
+	}
+	farSchema.format = "tss:";
+	imported = import_arrow(&farArray, &farSchema);
+	GATS_CHECK(abs(imported[2] - (UNIX_EPOCH_JD + 9e15 / 86'400)) < 1e-9 * imported[2]);
+
+	foreignSchema.format = "l";
+	GATS_CHECK_THROW(import_arrow(&foreign, &foreignSchema), std::invalid_argument);
+
+	// the plain conversions reject what the exports turn into nulls
+	vector<int32_t> unixDayColumn(3);
+	vector<int64_t> unixNsColumn(3);
+	jd_to_unix_days(span(jds).first(3), unixDayColumn);
+	GATS_CHECK(unixDayColumn == vector<int32_t>({ 0, 10'957, -1 }));
+	jd_to_unix_ns(span(jds).first(2), unixNsColumn);
+	GATS_CHECK_EQUAL(unixNsColumn[1], 946'728'000'000'000'000);
+	for (jd_t const bad : { nan(""), numeric_limits<jd_t>::infinity(), 1e12, -1e300 })
+		GATS_CHECK_THROW(jd_to_unix_days(span(&bad, 1), unixDayColumn), std::out_of_range);
+	for (jd_t const bad : { nan(""), -numeric_limits<jd_t>::infinity(), gregorian_to_jd(1600, 1, 1), 1e300 })
+		GATS_CHECK_THROW(jd_to_unix_ns(span(&bad, 1), unixNsColumn), std::out_of_range);
+#endif
+}
+
+
+
+/** Calendar fields export as a struct of int32 year, month and day children. */
+GATS_TEST_CASE(ut130_arrow_calendar_fields, UTILITY_GROUP, 1) {
+#if PHASE_130
+	using namespace khronos;
+
+	vector<jd_t> const jds = { gregorian_to_jd(2024, 1, 1), nan(""), gregorian_to_jd(2023, 9, 16, 18, 0, 0) };
+
+	ArrowArray array;
+	ArrowSchema schema;
+	export_calendar_fields<Hebrew>(jds, &array, &schema);
+	GATS_CHECK(strcmp(schema.format, "+s") == 0);
+	GATS_CHECK_EQUAL(schema.n_children, 3);
+	GATS_CHECK_EQUAL(array.n_children, 3);
+	GATS_CHECK_EQUAL(array.null_count, 1);
+	GATS_CHECK(strcmp(schema.children[0]->name, "year") == 0);
+	GATS_CHECK(strcmp(schema.children[1]->name, "month") == 0);
+	GATS_CHECK(strcmp(schema.children[2]->name, "day") == 0);
+	GATS_CHECK(strcmp(schema.children[2]->format, "i") == 0);
+
+	auto field = [&](int child, int row) { return static_cast<int32_t const*>(array.children[child]->buffers[1])[row]; };
+	GATS_CHECK_EQUAL(field(0, 0), 5784);
+	GATS_CHECK_EQUAL(field(1, 0), 10);
+	GATS_CHECK_EQUAL(field(2, 0), 20);
+	GATS_CHECK_EQUAL(field(0, 2), 5784);
+	GATS_CHECK_EQUAL(field(1, 2), 7);
+	GATS_CHECK_EQUAL(field(2, 2), 1);
+	GATS_CHECK_EQUAL(static_cast<uint8_t const*>(array.buffers[0])[0] & 0b111, 0b101);
+
+	array.release(&array);
+	schema.release(&schema);
+	GATS_CHECK(array.release == nullptr && schema.release == nullptr);
+
+	// years beyond int32, and JDs no calendar can decode, are nulls rather than truncated
+	vector<jd_t> const far = { 8e11, -8e11, 1e300, numeric_limits<jd_t>::infinity(), gregorian_to_jd(-1'000'000'000, 3, 1) };
+	export_calendar_fields<Gregorian>(far, &array, &schema);
+	GATS_CHECK_EQUAL(array.null_count, 4);
+	GATS_CHECK_EQUAL(static_cast<uint8_t const*>(array.buffers[0])[0] & 0b11111, 0b10000);
+	GATS_CHECK_EQUAL(field(0, 4), -1'000'000'000);
+	GATS_CHECK_EQUAL(field(1, 4), 3);
+	GATS_CHECK_EQUAL(field(2, 4), 1);
+	array.release(&array);
+	schema.release(&schema);
+#endif
+}
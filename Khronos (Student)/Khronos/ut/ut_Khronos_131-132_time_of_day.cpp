@@ -0,0 +1,138 @@
+/*	ut_Khronos_131-132_time_of_day.cpp
+
+	Khronos library exact time-of-day decomposition unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+	Column decoders checked against each calendar's own date-time conversion.
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/** The time of day splits exactly and stays inside its fields. */
+GATS_TEST_CASE(ut131_exact_time_of_day, UTILITY_GROUP, 1) {
+#if PHASE_131
+	using namespace khronos;
+
+	bool exact = true;
+	for (int sod = 0; sod < 86'400; ++sod) {
+		hour_t h; minute_t m; int s;
+		sod_to_hms(sod, h, m, s);
+		exact &= h == sod / 3600 && m == sod / 60 % 60 && s == sod % 60;
+	}
+	GATS_CHECK(exact);
+
+	hour_t h; minute_t m; second_t s;
+	jd_to_hms(0.5, h, m, s);
+	GATS_CHECK(h == 12 && m == 0 && s == 0.0);
+	jd_to_hms(nextafter(1.0, 0.0), h, m, s);
+	GATS_CHECK(h == 23 && m == 59 && s < 60.0);
+	jd_to_hms(0.75 + 0.5 / 86'400e9, h, m, s);
+	GATS_CHECK(h == 18 && m == 0 && s == 1e-9);
+
+	GATS_CHECK_EQUAL(jd_to_tod(2'451'545.0), 0.5);
+	GATS_CHECK_EQUAL(jd_to_tod(2'451'544.5), 0.0);
+	GATS_CHECK_EQUAL(jd_to_tod(-0.75), 0.75);
+
+	// every second of a day round trips exactly through each calendar's encoder and decoder
+	auto round_trips = [](jd_t midnight, auto to_jd, auto from_jd) {
+		year_t year; month_t month; day_t day;
+		from_jd(midnight, year, month, day);
+		int wrong = 0;
+		for (int sod = 0; sod < 86'400; ++sod) {
+			hour_t const hour = sod / 3'600;
+			minute_t const minute = sod / 60 % 60;
+			second_t const second = sod % 60;
+			year_t y; month_t mo; day_t d; hour_t hh; minute_t mm; second_t ss;
+			from_jd(to_jd(year, month, day, hour, minute, second), y, mo, d, hh, mm, ss);
+			wrong += !(y == year && mo == month && d == day && hh == hour && mm == minute && ss == second);
+		}
+		return wrong;
+	};
+	auto gregorian = [](auto&&... a) { if constexpr (sizeof...(a) == 6) return gregorian_to_jd(a...); else jd_to_gregorian(a...); };
+	auto julian = [](auto&&... a) { if constexpr (sizeof...(a) == 6) return julian_to_jd(a...); else jd_to_julian(a...); };
+	auto islamic = [](auto&&... a) { if constexpr (sizeof...(a) == 6) return islamic_to_jd(a...); else jd_to_islamic(a...); };
+	auto hebrew = [](auto&&... a) { if constexpr (sizeof...(a) == 6) return hebrew_to_jd(a...); else jd_to_hebrew(a...); };
+	for (jd_t const midnight : { gregorian_to_jd(2024, 1, 1), gregorian_to_jd(2132, 8, 31), gregorian_to_jd(1858, 11, 17) }) {
+		GATS_CHECK_EQUAL(round_trips(midnight, gregorian, gregorian), 0);
+		GATS_CHECK_EQUAL(round_trips(midnight, julian, julian), 0);
+		GATS_CHECK_EQUAL(round_trips(midnight, islamic, islamic), 0);
+		GATS_CHECK_EQUAL(round_trips(midnight, hebrew, hebrew), 0);
+	}
+
+	// a time within the JD's ulp of a whole second is that second; one further off is not
+	GATS_CHECK_EQUAL(jd_to_ns(2'500'000.0 + 1.0 / SECONDS_PER_DAY), 43'201'000'000'000);
+	GATS_CHECK(jd_to_ns(2'500'000.0 + 1.0 / SECONDS_PER_DAY + 1e-9) > 43'201'000'050'000);
+	GATS_CHECK_EQUAL(jd_to_ns(0.5 + 1e-6 / SECONDS_PER_DAY), 1'000);
+	GATS_CHECK(jd_to_ns(nextafter(2'451'545.5, 0.0)) > NANOSECONDS_PER_DAY - 50'000);	// not snapped into the next day
+#endif
+}
+
+
+
+/** Column decoders agree with the scalar conversions. */
+GATS_TEST_CASE(ut132_datetime_columns, UTILITY_GROUP, 1) {
+#if PHASE_132
+	using namespace khronos;
+
+	constexpr size_t N = 10'007;
+	mt19937_64 rng(132);
+	uniform_real_distribution<jd_t> jdDist(-1'000'000.0, 4'000'000.0);
+	vector<jd_t> jds(N);
+	for (auto& jd : jds)
+		jd = jdDist(rng);
+	jds[0] = 2'451'544.5;
+	jds[1] = 2'451'545.0 - 1e-9;
+
+	vector<year_t> years(N);
+	vector<month_t> months(N);
+	vector<day_t> days(N);
+	vector<hour_t> hours(N);
+	vector<minute_t> minutes(N);
+	vector<int> seconds(N), nanoseconds(N);
+
+	// the reference is each calendar's scalar jd_to_* date-time conversion
+	using to_datetime = void (*)(jd_t, year_t&, month_t&, day_t&, hour_t&, minute_t&, second_t&);
+	auto check_calendar = [&]<typename Calendar>(Calendar const*, to_datetime reference) {
+		jd_to_datetime<Calendar>(jds, years, months, days, hours, minutes, seconds, nanoseconds);
+		bool same = true;
+		for (size_t i = 0; i < N; ++i) {
+			year_t y; month_t mo; day_t d; hour_t h; minute_t mi; second_t s;
+			reference(jds[i], y, mo, d, h, mi, s);
+			same &= y == years[i] && mo == months[i] && d == days[i] && h == hours[i] && mi == minutes[i]
+				&& s == seconds[i] + nanoseconds[i] * 1e-9;
+		}
+		GATS_CHECK(same);
+	};
+	check_calendar(static_cast<Gregorian const*>(nullptr), to_datetime(jd_to_gregorian));
+	check_calendar(static_cast<Julian const*>(nullptr), to_datetime(jd_to_julian));
+	check_calendar(static_cast<Islamic const*>(nullptr), to_datetime(jd_to_islamic));
+	check_calendar(static_cast<Hebrew const*>(nullptr), to_datetime(jd_to_hebrew));
+	check_calendar(static_cast<Vulcan const*>(nullptr), to_datetime(jd_to_vulcan));
+
+	GATS_CHECK(hours[0] == 0 && minutes[0] == 0 && seconds[0] == 0 && nanoseconds[0] == 0);
+	GATS_CHECK(hours[1] == 11 && minutes[1] == 59 && seconds[1] == 59);
+
+	// ticks decompose exactly, including before JD 0
+	vector<tick_t> const ticks = {
+		0, -1, jd_to_ticks(2'451'544.5) + 3'600'000'000 + 61'000'001, jd_to_ticks(2'451'545.5) - 1 };
+	ticks_to_hms(ticks, hours, minutes, seconds, nanoseconds);
+	GATS_CHECK(hours[0] == 12 && minutes[0] == 0 && seconds[0] == 0 && nanoseconds[0] == 0);
+	GATS_CHECK(hours[1] == 11 && minutes[1] == 59 && seconds[1] == 59 && nanoseconds[1] == 999'999'000);
+	GATS_CHECK(hours[2] == 1 && minutes[2] == 1 && seconds[2] == 1 && nanoseconds[2] == 1'000);
+	GATS_CHECK(hours[3] == 23 && minutes[3] == 59 && seconds[3] == 59 && nanoseconds[3] == 999'999'000);
+#endif
+}
@@ -0,0 +1,116 @@
+/*	ut_Khronos_133-134_week.cpp
+
+	Khronos library weekday, day-of-year and week number unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/** Weekdays, days of the year and week numbers of known dates. */
+GATS_TEST_CASE(ut133_week_accessors, UTILITY_GROUP, 1) {
+#if PHASE_133
+	using namespace khronos;
+
+	GATS_CHECK_EQUAL(Gregorian(2012, 9, 24).day_of_week(), Monday);
+	GATS_CHECK_EQUAL(Gregorian(2010, 9, 12).day_of_week(), Sunday);
+	GATS_CHECK_EQUAL(Gregorian(-100, 1, 1).day_of_week(), day_of_week(gregorian_to_jd(-100, 1, 1)));
+	GATS_CHECK_EQUAL(day_of_week(-0.5), Monday);
+	GATS_CHECK_EQUAL(day_of_week(-1.0), Sunday);
+	GATS_CHECK_EQUAL(Julian(2010, 9, 12).day_of_week(), Saturday);
+	GATS_CHECK_EQUAL(Hebrew(5784, 7, 1).day_of_week(), Saturday);		// 2023-09-16
+	GATS_CHECK_EQUAL(Islamic(1445, 1, 1).day_of_week(), Wednesday);		// 2023-07-19
+	GATS_CHECK(Gregorian(2010, 9, 12, 23, 45, 8).to_string().starts_with("Sunday, "));
+
+	GATS_CHECK_EQUAL(Gregorian(2024, 1, 1).day_of_year(), 1);
+	GATS_CHECK_EQUAL(Gregorian(2024, 12, 31).day_of_year(), 366);
+	GATS_CHECK_EQUAL(Gregorian(2023, 12, 31).day_of_year(), 365);
+	GATS_CHECK_EQUAL(Julian(1900, 12, 31).day_of_year(), 366);
+	GATS_CHECK_EQUAL(Islamic(2, 12, 30).day_of_year(), 355);
+	GATS_CHECK_EQUAL(Hebrew(5784, 7, 1).day_of_year(), 1);
+	GATS_CHECK_EQUAL(Hebrew(5784, 1, 1).day_of_year(), 207);				// Nisan of a 383-day year
+	GATS_CHECK_EQUAL(Hebrew(5784, 6, 29).day_of_year(), 383);
+
+	GATS_CHECK_EQUAL(Gregorian(2024, 1, 1).week_of_year(), 1);			// a Monday
+	GATS_CHECK_EQUAL(Gregorian(2024, 1, 7).week_of_year(), 1);
+	GATS_CHECK_EQUAL(Gregorian(2024, 1, 8).week_of_year(), 2);
+	GATS_CHECK_EQUAL(Gregorian(2023, 1, 1).week_of_year(), 1);			// a Sunday
+	GATS_CHECK_EQUAL(Gregorian(2023, 1, 2).week_of_year(), 2);
+	GATS_CHECK_EQUAL(Hebrew(5784, 7, 2).week_of_year(), 1);			// Saturday 1 Tishri begins week 1
+	GATS_CHECK_EQUAL(Hebrew(5784, 7, 3).week_of_year(), 2);
+
+	GATS_CHECK(Gregorian(2021, 1, 1).iso_week() == (iso_week_date{ 2020, 53, 5 }));
+	GATS_CHECK(Gregorian(2024, 12, 30).iso_week() == (iso_week_date{ 2025, 1, 1 }));
+	GATS_CHECK(Gregorian(2008, 12, 29).iso_week() == (iso_week_date{ 2009, 1, 1 }));
+	GATS_CHECK(Gregorian(2010, 1, 3).iso_week() == (iso_week_date{ 2009, 53, 7 }));
+	GATS_CHECK(Gregorian(2024, 6, 15).iso_week() == (iso_week_date{ 2024, 24, 6 }));
+#endif
+}
+
+
+
+/** Column variants agree with the accessors; ISO weeks follow the Thursday rule. */
+GATS_TEST_CASE(ut134_week_columns, UTILITY_GROUP, 1) {
+#if PHASE_134
+	using namespace khronos;
+
+	// every day of 1990..2040 against the definition: week 1 holds January 4th
+	bool isoSame = true;
+	for (year_t y = 1990; y <= 2040; ++y) {
+		long long const week1 = date_jdn<Gregorian>(y, 1, 4) - day_of_week<Gregorian>(y, 1, 4);
+		long long const nextWeek1 = date_jdn<Gregorian>(y + 1, 1, 4) - day_of_week<Gregorian>(y + 1, 1, 4);
+		for (long long jdn = week1; jdn < nextWeek1; ++jdn)
+			isoSame &= jdn_iso_week(jdn) == (iso_week_date{ y, static_cast<int>((jdn - week1) / 7 + 1), jdn_day_of_week(jdn) + 1 });
+	}
+	GATS_CHECK(isoSame);
+
+	constexpr size_t N = 5'003;
+	mt19937_64 rng(134);
+	uniform_real_distribution<jd_t> jdDist(-500'000.0, 4'000'000.0);
+	vector<jd_t> jds(N);
+	for (auto& jd : jds)
+		jd = jdDist(rng);
+
+	vector<day_t> dows(N), doys(N);
+	vector<int> weeks(N);
+	vector<iso_week_date> isoWeeks(N);
+	day_of_week(jds, dows);
+	iso_week(jds, isoWeeks);
+	bool same = true;
+	for (size_t i = 0; i < N; ++i) {
+		Gregorian const g(jds[i]);
+		same &= dows[i] == g.day_of_week() && isoWeeks[i] == g.iso_week();
+	}
+	GATS_CHECK(same);
+
+	auto check_calendar = [&]<typename Calendar>(Calendar const*) {
+		day_of_year<Calendar>(jds, doys);
+		week_of_year<Calendar>(jds, weeks);
+		bool calendarSame = true;
+		for (size_t i = 0; i < N; ++i) {
+			Calendar const date(jds[i]);
+			calendarSame &= doys[i] == date.day_of_year() && weeks[i] == date.week_of_year() && dows[i] == date.day_of_week();
+			calendarSame &= date.day_of_year() >= 1 && date.week_of_year() >= 1 && date.week_of_year() <= 56;
+		}
+		GATS_CHECK(calendarSame);
+	};
+	check_calendar(static_cast<Gregorian const*>(nullptr));
+	check_calendar(static_cast<Julian const*>(nullptr));
+	check_calendar(static_cast<Islamic const*>(nullptr));
+	check_calendar(static_cast<Hebrew const*>(nullptr));
+	check_calendar(static_cast<Vulcan const*>(nullptr));
+#endif
+}
@@ -0,0 +1,163 @@
+/*	ut_Khronos_135-136_weekday_queries.cpp
+
+	Khronos library weekday-relative query unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/** Next, previous, on-or-about and n-th weekdays of known dates. */
+GATS_TEST_CASE(ut135_weekday_relative, UTILITY_GROUP, 1) {
+#if PHASE_135
+	using namespace khronos;
+
+	jd_t const thanksgiving = gregorian_to_jd(2024, 11, 28);		// a Thursday
+	GATS_CHECK_EQUAL(next_weekday(thanksgiving, Thursday), gregorian_to_jd(2024, 12, 5));
+	GATS_CHECK_EQUAL(prev_weekday(thanksgiving, Thursday), gregorian_to_jd(2024, 11, 21));
+	GATS_CHECK_EQUAL(weekday_on_or_after(thanksgiving, Thursday), thanksgiving);
+	GATS_CHECK_EQUAL(weekday_on_or_before(thanksgiving, Thursday), thanksgiving);
+	GATS_CHECK_EQUAL(next_weekday(thanksgiving, Friday), gregorian_to_jd(2024, 11, 29));
+	GATS_CHECK_EQUAL(prev_weekday(thanksgiving, Friday), gregorian_to_jd(2024, 11, 22));
+	GATS_CHECK_EQUAL(weekday_on_or_before(thanksgiving, Monday), gregorian_to_jd(2024, 11, 25));
+
+	// the time of day does not matter; the result is the day's midnight
+	GATS_CHECK_EQUAL(next_weekday(gregorian_to_jd(2024, 11, 28, 23, 59, 59), Friday), gregorian_to_jd(2024, 11, 29));
+	GATS_CHECK_EQUAL(prev_weekday(gregorian_to_jd(2024, 11, 28, 0, 0, 1), Wednesday), gregorian_to_jd(2024, 11, 27));
+
+	// the first Sunday after Rosh Hashanah 5784 (Saturday 2023-09-16)
+	GATS_CHECK(Hebrew(next_weekday(hebrew_to_jd(5784, 7, 1), Sunday)) == Hebrew(5784, 7, 2));
+	GATS_CHECK(Gregorian(next_weekday(hebrew_to_jd(5784, 7, 1), Sunday)) == Gregorian(2023, 9, 17));
+
+	// before the epoch
+	GATS_CHECK_EQUAL(day_of_week(next_weekday(-1'000'000.25, Tuesday)), Tuesday);
+	GATS_CHECK_EQUAL(jdn_weekday_on_or_after(-3, Monday), 0);
+	GATS_CHECK_EQUAL(jdn_weekday_on_or_before(-3, Monday), -7);
+
+	GATS_CHECK_EQUAL(nth_weekday<Gregorian>(2024, 11, Thursday, 4), 28);
+	GATS_CHECK_EQUAL(nth_weekday<Gregorian>(2024, 11, Friday, -1), 29);
+	GATS_CHECK_EQUAL(nth_weekday<Gregorian>(2024, 2, Thursday, 5), 29);
+	GATS_CHECK_EQUAL(nth_weekday<Gregorian>(2024, 2, Monday, 5), 0);
+	GATS_CHECK_EQUAL(nth_weekday<Gregorian>(2024, 2, Monday, -5), 0);
+	GATS_CHECK_EQUAL(nth_weekday<Gregorian>(2024, 3, Sunday, -2), 24);
+
+	// every n-th weekday of random months, against a walk through the month
+	auto check_nth = [&]<typename Calendar>(Calendar const*) {
+		mt19937_64 rng(135);
+		uniform_int_distribution<year_t> yearDist(-2000, 6000);
+		bool same = true;
+		for (int trial = 0; trial < 2'000; ++trial) {
+			year_t const y = yearDist(rng);
+			month_t const m = calendar_traits<Calendar>::month_at(y, trial % calendar_traits<Calendar>::months_in_year(y));
+			day_t const length = calendar_traits<Calendar>::days_in_month(y, m);
+			for (day_t weekday = 0; weekday < 7; ++weekday) {
+				vector<day_t> matches;
+				for (day_t d = 1; d <= length; ++d)
+					if (day_of_week(calendar_traits<Calendar>::to_jd(y, m, d)) == weekday)
+						matches.push_back(d);
+				for (int n = 1; n <= 5; ++n) {
+					same &= nth_weekday<Calendar>(y, m, weekday, n) == (n <= (int)matches.size() ? matches[n - 1] : 0);
+					same &= nth_weekday<Calendar>(y, m, weekday, -n) == (n <= (int)matches.size() ? matches[matches.size() - n] : 0);
+				}
+			}
+		}
+		GATS_CHECK(same);
+	};
+	check_nth(static_cast<Gregorian const*>(nullptr));
+	check_nth(static_cast<Hebrew const*>(nullptr));
+	check_nth(static_cast<Vulcan const*>(nullptr));
+
+	// random days against a walk
+	mt19937_64 rng(135);
+	uniform_real_distribution<jd_t> jdDist(-2'000'000.0, 4'000'000.0);
+	bool same = true;
+	for (int trial = 0; trial < 100'000; ++trial) {
+		jd_t const jd = jdDist(rng);
+		day_t const weekday = trial % 7;
+		jd_t const midnight = jd_to_jdn(jd) - 0.5;
+		jd_t next = midnight + 1;
+		while (day_of_week(next) != weekday)
+			++next;
+		jd_t prev = midnight - 1;
+		while (day_of_week(prev) != weekday)
+			--prev;
+		same &= next_weekday(jd, weekday) == next && prev_weekday(jd, weekday) == prev;
+		same &= weekday_on_or_after(jd, weekday) == (day_of_week(jd) == weekday ? midnight : next);
+		same &= weekday_on_or_before(jd, weekday) == (day_of_week(jd) == weekday ? midnight : prev);
+	}
+	GATS_CHECK(same);
+#endif
+}
+
+
+
+/** Batch queries: a decade of n-th weekdays and whole columns of next/previous weekdays. */
+GATS_TEST_CASE(ut136_weekday_batches, UTILITY_GROUP, 1) {
+#if PHASE_136
+	using namespace khronos;
+
+	auto const tuesdays = nth_weekdays<Gregorian>(2024, 2024, Tuesday, 3);
+	GATS_CHECK_EQUAL(tuesdays.size(), 12u);
+	GATS_CHECK_EQUAL(tuesdays.front(), gregorian_to_jd(2024, 1, 16));
+	GATS_CHECK_EQUAL(tuesdays.back(), gregorian_to_jd(2024, 12, 17));
+
+	GATS_CHECK(nth_weekdays<Gregorian>(2024, 2023, Tuesday, 3).empty());
+
+	// each month of a decade, in each calendar, against the per-month query
+	auto check_decade = [&]<typename Calendar>(Calendar const*, year_t first) {
+		using traits = calendar_traits<Calendar>;
+		bool same = true;
+		for (day_t weekday = 0; weekday < 7; ++weekday)
+			for (int n : { 1, 3, 5, -1, -5 }) {
+				vector<jd_t> expected;
+				for (year_t y = first; y < first + 10; ++y)
+					for (int i = 0; i < traits::months_in_year(y); ++i) {
+						month_t const m = traits::month_at(y, i);
+						if (day_t const d = nth_weekday<Calendar>(y, m, weekday, n))
+							expected.push_back(traits::to_jd(y, m, d));
+					}
+				auto const jds = nth_weekdays<Calendar>(first, first + 9, weekday, n);
+				same &= jds == expected;
+				for (jd_t jd : jds)
+					same &= day_of_week(jd) == weekday;
+			}
+		GATS_CHECK(same);
+	};
+	check_decade(static_cast<Gregorian const*>(nullptr), 2020);
+	check_decade(static_cast<Julian const*>(nullptr), -45);
+	check_decade(static_cast<Islamic const*>(nullptr), 1440);
+	check_decade(static_cast<Hebrew const*>(nullptr), 5780);
+	check_decade(static_cast<Vulcan const*>(nullptr), 2800);
+
+	// every month has a first and a last of each weekday, and sometimes a fifth
+	GATS_CHECK_EQUAL(nth_weekdays<Gregorian>(2020, 2029, Monday, 1).size(), 120u);
+	GATS_CHECK_EQUAL(nth_weekdays<Gregorian>(2020, 2029, Monday, -1).size(), 120u);
+	GATS_CHECK(nth_weekdays<Gregorian>(2020, 2029, Monday, 5).size() < 120u);
+
+	constexpr size_t N = 4'099;
+	mt19937_64 rng(136);
+	uniform_real_distribution<jd_t> jdDist(-1'000'000.0, 4'000'000.0);
+	vector<jd_t> jds(N), next(N), prev(N);
+	for (auto& jd : jds)
+		jd = jdDist(rng);
+	next_weekday(jds, Saturday, next);
+	prev_weekday(jds, Saturday, prev);
+	bool same = true;
+	for (size_t i = 0; i < N; ++i)
+		same &= next[i] == next_weekday(jds[i], Saturday) && prev[i] == prev_weekday(jds[i], Saturday) && next[i] - prev[i] <= 14;
+	GATS_CHECK(same);
+#endif
+}
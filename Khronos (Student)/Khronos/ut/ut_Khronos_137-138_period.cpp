@@ -0,0 +1,147 @@
+/*	ut_Khronos_137-138_period.cpp
+
+	Khronos library calendar period difference unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/** Ages and tenors of known dates, with month-end clamping and times of day. */
+GATS_TEST_CASE(ut137_period_between, UTILITY_GROUP, 1) {
+#if PHASE_137
+	using namespace khronos;
+
+	GATS_CHECK(period_between(Gregorian(2000, 2, 29), Gregorian(2024, 2, 28)) == (date_period{ 23, 11, 30, 0 }));
+	GATS_CHECK(period_between(Gregorian(2000, 2, 29), Gregorian(2024, 2, 29)) == (date_period{ 24, 0, 0, 0 }));
+	GATS_CHECK(period_between(Gregorian(2000, 2, 29), Gregorian(2025, 2, 28)) == (date_period{ 25, 0, 0, 0 }));
+	GATS_CHECK(period_between(Gregorian(2000, 2, 29), Gregorian(2025, 3, 1)) == (date_period{ 25, 0, 1, 0 }));
+	GATS_CHECK(period_between(Gregorian(2023, 1, 31), Gregorian(2023, 3, 1)) == (date_period{ 0, 1, 1, 0 }));
+	GATS_CHECK(period_between(Gregorian(2023, 1, 31), Gregorian(2023, 2, 28)) == (date_period{ 0, 1, 0, 0 }));
+	GATS_CHECK(period_between(Gregorian(1969, 7, 20), Gregorian(2024, 10, 18)) == (date_period{ 55, 2, 28, 0 }));
+	GATS_CHECK(period_between(Gregorian(-1, 12, 31), Gregorian(1, 1, 1)) == (date_period{ 1, 0, 1, 0 }));
+	GATS_CHECK(period_between(Gregorian(2024, 5, 5), Gregorian(2024, 5, 5)) == (date_period{ 0, 0, 0, 0 }));
+
+	// times of day
+	GATS_CHECK(period_between(Gregorian(2024, 1, 1, 18, 0, 0), Gregorian(2024, 2, 1, 6, 0, 0)) == (date_period{ 0, 0, 30, 43'200 }));
+	GATS_CHECK(period_between(Gregorian(2024, 1, 1, 6, 0, 0), Gregorian(2024, 2, 1, 18, 0, 30)) == (date_period{ 0, 1, 0, 43'230 }));
+	GATS_CHECK(period_between(Gregorian(2024, 2, 1, 6, 0, 0), Gregorian(2024, 1, 1, 18, 0, 0)) == (date_period{ 0, 0, -30, -43'200 }));
+	GATS_CHECK(period_between(Gregorian(2025, 3, 1), Gregorian(2000, 2, 29)) == (date_period{ -25, 0, -1, 0 }));
+
+	// the other calendars
+	GATS_CHECK(period_between(Julian(1900, 2, 29), Julian(1901, 2, 28)) == (date_period{ 1, 0, 0, 0 }));
+	GATS_CHECK(period_between(Islamic(1445, 12, 30), Islamic(1446, 12, 29)) == (date_period{ 1, 0, 0, 0 }));
+	GATS_CHECK(period_between(Islamic(1445, 1, 30), Islamic(1445, 3, 1)) == (date_period{ 0, 1, 1, 0 }));
+	GATS_CHECK(period_between(Vulcan(2800, 1, 1), Vulcan(2801, 2, 3)) == (date_period{ 1, 1, 2, 0 }));
+
+	// Hebrew years of 12 and 13 months: Adar II 5784 to Adar 5785, Nisan to Nisan
+	GATS_CHECK(period_between(Hebrew(5784, 13, 10), Hebrew(5785, 12, 10)) == (date_period{ 1, 0, 0, 0 }));
+	GATS_CHECK(period_between(Hebrew(5784, 1, 1), Hebrew(5785, 1, 1)) == (date_period{ 1, 0, 0, 0 }));
+	GATS_CHECK(period_between(Hebrew(5784, 7, 1), Hebrew(5785, 7, 1)) == (date_period{ 1, 0, 0, 0 }));
+	GATS_CHECK(period_between(Hebrew(5784, 7, 1), Hebrew(5784, 6, 29)) == (date_period{ 0, 12, 28, 0 }));
+	GATS_CHECK(period_between(Hebrew(5784, 7, 1), Hebrew(5784, 1, 1)) == (date_period{ 0, 7, 0, 0 }));
+
+	// a Hebrew year step maps Adar II to Adar in a common year and clamps the day, as period_between counts it
+	GATS_CHECK(Hebrew(5784, 13, 29) + detail::packaged_year_real(1) == Hebrew(5785, 12, 29));
+	GATS_CHECK(Hebrew(5784, 12, 30) + detail::packaged_year_real(1) == Hebrew(5785, 12, 29));
+	GATS_CHECK(Hebrew(5783, 8, 30) + detail::packaged_year_real(1) == Hebrew(5784, 8, 29));
+	GATS_CHECK(Hebrew(5784, 13, 29) + detail::packaged_year_real(3) == Hebrew(5787, 13, 29));
+	GATS_CHECK(period_between(Hebrew(5783, 8, 30), Hebrew(5784, 8, 29)) == (date_period{ 1, 0, 0, 0 }));
+
+	GATS_CHECK(period_between<Gregorian>(gregorian_to_jd(2000, 1, 1), gregorian_to_jd(2010, 7, 4)) == (date_period{ 10, 6, 3, 0 }));
+#endif
+}
+
+
+
+/** Random spans in every calendar against stepping operator+ one month at a time. */
+GATS_TEST_CASE(ut138_period_columns, UTILITY_GROUP, 1) {
+#if PHASE_138
+	using namespace khronos;
+
+	auto check_calendar = [&]<typename Calendar>(Calendar const*, jd_t epoch) {
+		mt19937_64 rng(138);
+		uniform_real_distribution<jd_t> startDist(epoch, epoch + 200'000), lengthDist(-4'000, 4'000);
+		constexpr size_t N = 2'000;
+		vector<jd_t> from(N), to(N);
+		for (size_t i = 0; i < N; ++i) {
+			from[i] = startDist(rng);
+			to[i] = from[i] + lengthDist(rng);
+		}
+		vector<date_period> periods(N);
+		period_between<Calendar>(from, to, periods);
+
+		bool same = true;
+		for (size_t i = 0; i < N; ++i) {
+			Calendar a(from[i]), b(to[i]);
+			date_period const p = period_between(a, b);
+			same &= p == periods[i];
+			bool const backwards = b < a;
+			if (backwards) {
+				swap(a, b);
+				same &= period_between(a, b) == (date_period{ -p.years, -p.months, -p.days, -p.seconds });
+			}
+			date_period const q = period_between(a, b);
+
+			// the largest month step not past 'b', as repeated operator+ finds it
+			int months = 0;
+			while (a + detail::packaged_month_integer(months + 1) <= b)
+				++months;
+			Calendar const anchor = a + detail::packaged_month_integer(months);
+			jd_t const rest = b.to_jd() - anchor.to_jd();
+			same &= q.days == static_cast<long long>(floor(rest + 1e-9)) && abs(q.days + q.seconds / SECONDS_PER_DAY - rest) < 1e-6;
+			same &= q.years >= 0 && q.months >= 0 && q.days >= 0 && q.seconds >= 0 && q.seconds < SECONDS_PER_DAY;
+
+			// the years and months add up to the same month step, and the months fall short of the next anniversary
+			auto anniversary = [&](year_t y) {
+				return detail::month_index<Calendar>(y, min<month_t>(a.month(), calendar_traits<Calendar>::months_in_year(y)));
+			};
+			long long const yearIndex = anniversary(a.year() + q.years);
+			same &= yearIndex + q.months - detail::month_index<Calendar>(a.year(), a.month()) == months;
+			same &= yearIndex + q.months <= anniversary(a.year() + q.years + 1);
+		}
+		GATS_CHECK(same);
+	};
+	check_calendar(static_cast<Gregorian const*>(nullptr), gregorian_to_jd(1900, 1, 1));
+	check_calendar(static_cast<Julian const*>(nullptr), julian_to_jd(-500, 1, 1));
+	check_calendar(static_cast<Islamic const*>(nullptr), islamic_to_jd(1300, 1, 1));
+	check_calendar(static_cast<Hebrew const*>(nullptr), hebrew_to_jd(5600, 7, 1));
+	check_calendar(static_cast<Vulcan const*>(nullptr), vulcan_to_jd(2700, 1, 1));
+
+	// a + period_between(a, b) is b across leap and common Hebrew years
+	mt19937_64 rng(1381);
+	uniform_real_distribution<jd_t> startDist(hebrew_to_jd(5700, 7, 1), hebrew_to_jd(5800, 7, 1)), lengthDist(0, 8'000);
+	bool added = true;
+	for (int i = 0; i < 20'000; ++i) {
+		jd_t const from = startDist(rng);
+		Hebrew const a(from), b(from + lengthDist(rng));
+		date_period const p = period_between(a, b);
+		Hebrew const stepped = a + detail::packaged_year_real(static_cast<double>(p.years)) + detail::packaged_month_integer(p.months);
+		added &= stepped.month() <= hebrew_months_in_year(stepped.year()) && stepped.day() <= hebrew_days_in_month(stepped.month(), stepped.year());
+
+		// whole years of every length land on a valid date a whole number of years away
+		Hebrew const anniversary = a + detail::packaged_year_real(static_cast<double>(i % 19 + 1));
+		added &= anniversary.day() <= hebrew_days_in_month(anniversary.month(), anniversary.year());
+		added &= period_between(a, anniversary) == (date_period{ i % 19 + 1, 0, 0, 0 });
+
+		// a 30th clamped by the year step stays clamped through a month step after it
+		if (a.day() == 30 && p.months != 0)
+			continue;
+		added &= abs(stepped.to_jd() + p.days + p.seconds / SECONDS_PER_DAY - b.to_jd()) < 1e-6;
+	}
+	GATS_CHECK(added);
+#endif
+}
@@ -0,0 +1,153 @@
+/*	ut_Khronos_139-140_interval.cpp
+
+	Khronos library interval and interval set unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/** Closed-open intervals, coalescing, queries and calendar display. */
+GATS_TEST_CASE(ut139_interval_set, UTILITY_GROUP, 1) {
+#if PHASE_139
+	using namespace khronos;
+
+	auto const day = jd_interval::from_jds(gregorian_to_jd(2024, 3, 1), gregorian_to_jd(2024, 3, 2));
+	GATS_CHECK_EQUAL(day.length(), TICKS_PER_DAY);
+	GATS_CHECK(day.contains(jd_to_ticks(gregorian_to_jd(2024, 3, 1, 23, 59, 59))));
+	GATS_CHECK(!day.contains(day.end));
+	GATS_CHECK(day.start_date<Gregorian>() == Gregorian(2024, 3, 1));
+	GATS_CHECK(day.end_date<Hebrew>() == Hebrew(5784, 12, 22));
+	GATS_CHECK_EQUAL(to_string<Gregorian>(day), "[" + Gregorian(2024, 3, 1).to_string() + ", " + Gregorian(2024, 3, 2).to_string() + ")");
+	GATS_CHECK(!day.overlaps(jd_interval{ day.end, day.end + 10 }));
+	GATS_CHECK(day.overlaps(jd_interval{ day.end - 1, day.end + 10 }));
+	GATS_CHECK((jd_interval{ 5, 5 }).empty());
+
+	// touching and overlapping intervals coalesce; empty ones vanish
+	vector<jd_interval> const busy = { { 50, 60 }, { 10, 20 }, { 20, 30 }, { 55, 70 }, { 40, 40 }, { 80, 90 } };
+	interval_set const set(busy);
+	GATS_CHECK_EQUAL(set.size(), 3u);
+	GATS_CHECK(set[0] == (jd_interval{ 10, 30 }));
+	GATS_CHECK(set[1] == (jd_interval{ 50, 70 }));
+	GATS_CHECK(set[2] == (jd_interval{ 80, 90 }));
+	GATS_CHECK_EQUAL(set.length(), 50);
+
+	GATS_CHECK(set.contains(tick_t(10)) && set.contains(tick_t(29)) && !set.contains(tick_t(30)) && !set.contains(tick_t(9)));
+	GATS_CHECK(set.contains(jd_interval{ 50, 70 }) && !set.contains(jd_interval{ 50, 71 }) && !set.contains(jd_interval{ 25, 55 }));
+	GATS_CHECK(set.overlaps(jd_interval{ 25, 55 }) && set.overlaps(jd_interval{ 0, 11 }) && !set.overlaps(jd_interval{ 30, 50 }));
+	GATS_CHECK(!set.overlaps(jd_interval{ 90, 100 }) && !set.overlaps(jd_interval{ 0, 10 }));
+	GATS_CHECK(!interval_set().contains(tick_t(0)) && !interval_set().overlaps(jd_interval{ 0, 10 }));
+
+	interval_set inserted;
+	for (auto const& interval : busy)
+		inserted.insert(interval);
+	GATS_CHECK(inserted == set);
+	inserted.insert({ 30, 50 });
+	GATS_CHECK_EQUAL(inserted.size(), 2u);
+	GATS_CHECK(inserted[0] == (jd_interval{ 10, 70 }));
+
+	// free time in a working day is the day minus the busy set
+	vector<jd_interval> const workday = { { 0, 100 } };
+	interval_set const free = interval_set(workday) - set;
+	GATS_CHECK_EQUAL(free.size(), 4u);
+	GATS_CHECK(free[0] == (jd_interval{ 0, 10 }));
+	GATS_CHECK(free[3] == (jd_interval{ 90, 100 }));
+	GATS_CHECK((free | set) == interval_set(workday));
+	GATS_CHECK((free & set).empty());
+#endif
+}
+
+
+
+/** Random sets against a tick-by-tick model. */
+GATS_TEST_CASE(ut140_interval_algebra, UTILITY_GROUP, 1) {
+#if PHASE_140
+	using namespace khronos;
+
+	constexpr tick_t SPAN = 2'000;
+	mt19937_64 rng(140);
+	uniform_int_distribution<tick_t> startDist(0, SPAN - 1), lengthDist(-5, 60);
+	auto random_intervals = [&](int n) {
+		vector<jd_interval> intervals(n);
+		for (auto& interval : intervals) {
+			interval.start = startDist(rng);
+			interval.end = min(SPAN, interval.start + lengthDist(rng));
+		}
+		return intervals;
+	};
+	auto model = [&](interval_set const& set) {
+		vector<bool> in(SPAN);
+		for (size_t i = 0; i < set.size(); ++i)
+			for (tick_t t = set[i].start; t < set[i].end; ++t)
+				in[t] = true;
+		return in;
+	};
+	auto canonical = [](interval_set const& set) {
+		bool ok = true;
+		for (size_t i = 0; i < set.size(); ++i)
+			ok &= set[i].start < set[i].end && (i == 0 || set[i - 1].end < set[i].start);
+		return ok;
+	};
+
+	bool same = true;
+	for (int trial = 0; trial < 300; ++trial) {
+		interval_set const a(random_intervals(trial % 40));
+		interval_set const b(random_intervals(trial % 23 + 1));
+		auto const ma = model(a), mb = model(b);
+		interval_set const u = a | b, n = a & b, d = a - b;
+		same &= canonical(a) && canonical(u) && canonical(n) && canonical(d);
+		auto const mu = model(u), mn = model(n), md = model(d);
+		for (tick_t t = 0; t < SPAN; ++t) {
+			same &= mu[t] == (ma[t] || mb[t]) && mn[t] == (ma[t] && mb[t]) && md[t] == (ma[t] && !mb[t]);
+			same &= a.contains(t) == ma[t];
+		}
+
+		// interval queries
+		for (auto const& q : random_intervals(20)) {
+			bool all = true, any = false;
+			for (tick_t t = q.start; t < q.end; ++t) {
+				all &= ma[t];
+				any |= ma[t];
+			}
+			same &= a.contains(q) == all && a.overlaps(q) == any;
+		}
+
+		// insert agrees with the union
+		interval_set c = a;
+		for (size_t i = 0; i < b.size(); ++i)
+			c.insert(b[i]);
+		same &= c == u;
+	}
+	GATS_CHECK(same);
+
+	// tick column containment
+	interval_set const set(random_intervals(200));
+	vector<tick_t> ticks(1'000);
+	for (auto& t : ticks)
+		t = startDist(rng) - 100;
+	vector<uint64_t> mask((ticks.size() + 63) / 64);
+	size_t const count = set.contains(ticks, mask);
+	size_t expected = 0;
+	bool maskSame = true;
+	for (size_t i = 0; i < ticks.size(); ++i) {
+		bool const in = set.contains(ticks[i]);
+		expected += in;
+		maskSame &= ((mask[i / 64] >> (i % 64)) & 1) == uint64_t(in);
+	}
+	GATS_CHECK(maskSame);
+	GATS_CHECK_EQUAL(count, expected);
+#endif
+}
@@ -0,0 +1,162 @@
+/*	ut_Khronos_141-142_event_index.cpp
+
+	Khronos library event index unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <random>
+#include <string>
+#include <vector>
+using namespace std;
+
+
+
+/** Overlap and calendar-day queries over a handful of events. */
+GATS_TEST_CASE(ut141_event_index_queries, UTILITY_GROUP, 1) {
+#if PHASE_141
+	using namespace khronos;
+
+	event_index<string> index;
+	GATS_CHECK(index.empty());
+	GATS_CHECK(index.overlapping({ 0, 1 }).empty());
+	GATS_CHECK(index.on_day<Gregorian>(2024, 1, 1).empty());
+
+	auto const at = [](year_t y, month_t m, day_t d, hour_t h) { return jd_to_ticks(gregorian_to_jd(y, m, d, h, 0, 0)); };
+	index.insert({ at(2023, 9, 16, 9), at(2023, 9, 16, 12) }, "service");			// 1 Tishri 5784
+	index.insert({ at(2023, 9, 15, 20), at(2023, 9, 17, 2) }, "holiday");
+	index.insert({ at(2024, 3, 11, 0), at(2024, 4, 9, 0) }, "ramadan");				// 1 Ramadan 1445 begins at sunset before
+	index.insert({ at(2024, 1, 1, 0), at(2024, 1, 1, 1) }, "new year");
+	GATS_CHECK_EQUAL(index.size(), 4u);
+
+	auto payloads = [](auto const& events) {
+		vector<string> names;
+		for (auto const& e : events)
+			names.push_back(e.payload);
+		ranges::sort(names);
+		return names;
+	};
+	GATS_CHECK(payloads(index.on_day<Hebrew>(5784, 7, 1)) == (vector<string>{ "holiday", "service" }));
+	GATS_CHECK(payloads(index.on_day(Hebrew(5784, 7, 2))) == (vector<string>{ "holiday" }));
+	GATS_CHECK(payloads(index.on_day<Islamic>(1445, 9, 1)) == (vector<string>{ "ramadan" }));
+	GATS_CHECK(payloads(index.on_day<Julian>(2023, 12, 19)) == (vector<string>{ "new year" }));
+	GATS_CHECK(index.on_day<Gregorian>(2024, 4, 9).empty());			// the end is excluded
+	GATS_CHECK(payloads(index.on_day<Gregorian>(2024, 4, 8)) == (vector<string>{ "ramadan" }));
+	GATS_CHECK(index.on_day<Vulcan>(Vulcan(gregorian_to_jd(2023, 6, 1))).empty());
+
+	GATS_CHECK_EQUAL(index.overlapping({ at(2023, 9, 16, 12), at(2023, 9, 16, 13) }).size(), 1u);
+	GATS_CHECK_EQUAL(index.overlapping({ at(2023, 9, 16, 11), at(2023, 9, 16, 13) }).size(), 2u);
+	GATS_CHECK(index.overlapping({ 5, 5 }).empty());
+
+	// bulk load
+	vector<event_index<int>::event> events;
+	for (int i = 0; i < 100; ++i)
+		events.push_back({ { i * 10, i * 10 + 25 }, i });
+	event_index<int> const bulk(events);
+	GATS_CHECK_EQUAL(bulk.size(), 100u);
+	auto found = bulk.overlapping({ 500, 501 });
+	ranges::sort(found, {}, &event_index<int>::event::payload);
+	GATS_CHECK_EQUAL(found.size(), 3u);
+	GATS_CHECK_EQUAL(found[0].payload, 48);
+	GATS_CHECK_EQUAL(found[2].payload, 50);
+	GATS_CHECK(found[1].interval == (jd_interval{ 490, 515 }));
+#endif
+}
+
+
+
+/** Random events, bulk loaded and inserted one at a time, against a linear scan. */
+GATS_TEST_CASE(ut142_event_index_random, UTILITY_GROUP, 1) {
+#if PHASE_142
+	using namespace khronos;
+
+	mt19937_64 rng(142);
+	uniform_int_distribution<tick_t> startDist(0, 10'000'000);
+	uniform_int_distribution<int> kind(0, 99);
+	auto random_interval = [&] {
+		tick_t const start = startDist(rng);
+		int const k = kind(rng);
+		tick_t const length = k < 80 ? 1 + k * 100 : k < 98 ? 1 + k * 10'000 : 3'000'000;		// a few long events
+		return jd_interval{ start, start + length };
+	};
+
+	for (size_t n : { size_t(1), size_t(2), size_t(15), size_t(16), size_t(17), size_t(1'000), size_t(20'000) }) {
+		vector<event_index<size_t>::event> events(n);
+		for (size_t i = 0; i < n; ++i)
+			events[i] = { random_interval(), i };
+
+		event_index<size_t> bulk(events), incremental;
+		for (auto const& e : events)
+			incremental.insert(e.interval, e.payload);
+		GATS_CHECK_EQUAL(bulk.size(), n);
+		GATS_CHECK_EQUAL(incremental.size(), n);
+
+		bool same = true;
+		for (int q = 0; q < 300; ++q) {
+			jd_interval const query = random_interval();
+			vector<size_t> expected;
+			for (auto const& e : events)
+				if (e.interval.overlaps(query))
+					expected.push_back(e.payload);
+			for (auto const* index : { &bulk, &incremental }) {
+				vector<size_t> got;
+				index->visit_overlapping(query, [&](jd_interval const& interval, size_t id) {
+					same &= interval == events[id].interval;
+					got.push_back(id);
+				});
+				ranges::sort(got);
+				same &= got == expected;
+			}
+		}
+		GATS_CHECK(same);
+	}
+
+	// queries between single inserts, so the sorted pending events are searched while long ones wait among them
+	{
+		vector<event_index<size_t>::event> events;
+		event_index<size_t> index;
+		bool same = true;
+		for (size_t i = 0; i < 2'000; ++i) {
+			events.push_back({ random_interval(), i });
+			index.insert(events.back().interval, i);
+			jd_interval const query = random_interval();
+			size_t expected = 0, got = 0;
+			for (auto const& e : events)
+				expected += e.interval.overlaps(query);
+			index.visit_overlapping(query, [&](jd_interval const&, size_t) { ++got; });
+			same &= got == expected;
+		}
+		GATS_CHECK(same);
+	}
+
+	// every size of tree, including those whose rightmost nodes lie past the end, against a linear scan
+	uniform_int_distribution<tick_t> denseStart(0, 1'000), denseLength(1, 40);
+	bool same = true;
+	for (size_t n = 1; n <= 300; ++n) {
+		vector<event_index<size_t>::event> events(n);
+		for (size_t i = 0; i < n; ++i) {
+			tick_t const start = denseStart(rng);
+			events[i] = { jd_interval{ start, start + (i % 17 == 0 ? 200 : denseLength(rng)) }, i };
+		}
+		event_index<size_t> const index(events);
+		for (tick_t start = 0; start < 1'040; start += 5) {
+			jd_interval const query{ start, start + 5 };
+			size_t expected = 0, got = 0;
+			for (auto const& e : events)
+				expected += e.interval.overlaps(query);
+			index.visit_overlapping(query, [&](jd_interval const&, size_t) { ++got; });
+			same &= got == expected;
+		}
+	}
+	GATS_CHECK(same);
+#endif
+}
@@ -0,0 +1,158 @@
+/*	ut_Khronos_143-144_cyclic_calendar.cpp
+
+	Khronos library cyclic calendar engine unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+	Arithmetic Persian calendar.
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/** The engine's tables, and every day of several cycles of each calendar. */
+GATS_TEST_CASE(ut143_cyclic_calendar_engine, UTILITY_GROUP, 1) {
+#if PHASE_143
+	using namespace khronos;
+
+	static_assert(julian_calendar::CYCLE_DAYS == 1'461);
+	static_assert(islamic_calendar::CYCLE_DAYS == 10'631);
+	static_assert(vulcan_calendar::CYCLE_DAYS == 1'009);
+	static_assert(coptic_calendar::CYCLE_DAYS == 1'461);
+	static_assert(persian_calendar::CYCLE_DAYS == 1'029'983);		// 2820 years, 683 of them leap
+	static_assert(julian_calendar::to_days(1, 1, 1) == 0);
+
+	// months outside the year carry into the years around it
+	static_assert(julian_calendar::to_days(2024, 0, 1) == julian_calendar::to_days(2023, 12, 1));
+	static_assert(julian_calendar::to_days(2024, 13, 1) == julian_calendar::to_days(2025, 1, 1));
+	static_assert(julian_calendar::to_days(2024, -11, 5) == julian_calendar::to_days(2022, 13, 5));
+	static_assert(islamic_calendar::to_days(-5, 37, 30) == islamic_calendar::to_days(-2, 1, 30));
+	static_assert(coptic_calendar::to_days(3, 14, 1) == coptic_calendar::to_days(4, 1, 1));
+	GATS_CHECK_EQUAL(julian_to_jd(1582, 0, 5), julian_to_jd(1581, 12, 5));
+	static_assert(islamic_calendar::days_in_year(2) == 355 && islamic_calendar::days_in_year(3) == 354);
+	static_assert(coptic_calendar::days_in_month(3, 13) == 6 && coptic_calendar::days_in_month(4, 13) == 5);
+
+	// consecutive days are consecutive dates, and the leap rules agree with the calendars' own
+	auto walk = [&]<typename Engine>(Engine const*, auto is_leap) {
+		bool same = true;
+		long long const first = Engine::to_days(-3 * Engine::CYCLE_YEARS + 1, 1, 1);
+		year_t y = -3 * Engine::CYCLE_YEARS + 1;
+		month_t m = 1;
+		day_t d = 1;
+		for (long long days = first; days < first + 6 * Engine::CYCLE_DAYS; ++days) {
+			year_t year; month_t month; day_t day;
+			Engine::from_days(days, year, month, day);
+			same &= year == y && month == m && day == d && Engine::to_days(y, m, d) == days;
+			same &= Engine::is_leapyear(y) == is_leap(y);
+			if (++d > Engine::days_in_month(y, m)) {
+				d = 1;
+				if (++m > Engine::MONTHS) {
+					m = 1;
+					++y;
+				}
+			}
+		}
+		GATS_CHECK(same);
+	};
+	walk(static_cast<julian_calendar const*>(nullptr), is_julian_leapyear);
+	walk(static_cast<islamic_calendar const*>(nullptr), is_islamic_leapyear);
+	walk(static_cast<vulcan_calendar const*>(nullptr), is_vulcan_leapyear);
+	walk(static_cast<coptic_calendar const*>(nullptr), [](year_t y) { return utility::floor_mod(y, 4) == 3; });
+	walk(static_cast<persian_calendar const*>(nullptr), [](year_t y) { return (utility::floor_mod(y - 474, 2820) + 474 + 38) * 682 % 2816 < 682; });
+
+	// the re-expressed calendars keep their epochs and month lengths
+	GATS_CHECK_EQUAL(julian_to_jd(1, 1, 1), JULIAN_EPOCH);
+	GATS_CHECK_EQUAL(islamic_to_jd(1, 1, 1), ISLAMIC_EPOCH);
+	GATS_CHECK_EQUAL(vulcan_to_jd(1, 1, 1), VULCAN_EPOCH);
+	GATS_CHECK_EQUAL(julian_to_jd(1582, 10, 5), gregorian_to_jd(1582, 10, 15));
+	GATS_CHECK_EQUAL(islamic_to_jd(1445, 9, 1), gregorian_to_jd(2024, 3, 11));
+	for (month_t m = 1; m <= 12; ++m) {
+		GATS_CHECK_EQUAL(julian_calendar::days_in_month(2024, m), julian_days_in_month(m, true));
+		GATS_CHECK_EQUAL(islamic_calendar::days_in_month(1445, m), islamic_days_in_month(m, is_islamic_leapyear(1445)));
+		GATS_CHECK_EQUAL(vulcan_calendar::days_in_month(2800, m), vulcan_days_in_month(m, true));
+	}
+
+	// Coptic and Ethiopic new years, the day after the leap year's sixth epagomenal day
+	GATS_CHECK_EQUAL(coptic_to_jd(1740, 1, 1), gregorian_to_jd(2023, 9, 12));
+	GATS_CHECK_EQUAL(coptic_to_jd(1739, 13, 6), gregorian_to_jd(2023, 9, 11));
+	GATS_CHECK_EQUAL(coptic_to_jd(1741, 1, 1), gregorian_to_jd(2024, 9, 11));
+	GATS_CHECK_EQUAL(ethiopic_to_jd(2016, 1, 1), gregorian_to_jd(2023, 9, 12));
+	GATS_CHECK_EQUAL(ethiopic_to_jd(2017, 1, 1), gregorian_to_jd(2024, 9, 11));
+	GATS_CHECK_EQUAL(coptic_to_jd(1, 1, 1), julian_to_jd(284, 8, 29));
+	GATS_CHECK_EQUAL(ethiopic_to_jd(1, 1, 1), julian_to_jd(8, 8, 29));
+	year_t y; month_t m; day_t d;
+	jd_to_ethiopic(gregorian_to_jd(2024, 1, 7, 18, 0, 0), y, m, d);
+	GATS_CHECK(y == 2016 && m == 4 && d == 28);
+	GATS_CHECK(is_coptic_leapyear(1739) && !is_coptic_leapyear(1740));
+	GATS_CHECK_EQUAL(string(ethiopic_month_name(13)), "Paguemen");
+
+	// arithmetic Persian new years; 1403 is leap in the official calendar of Iran but not in this one
+	GATS_CHECK_EQUAL(persian_to_jd(1, 1, 1), julian_to_jd(622, 3, 19));
+	GATS_CHECK_EQUAL(persian_to_jd(1379, 1, 1), gregorian_to_jd(2000, 3, 20));
+	GATS_CHECK_EQUAL(persian_to_jd(1403, 1, 1), gregorian_to_jd(2024, 3, 20));
+	GATS_CHECK_EQUAL(persian_to_jd(1402, 12, 29), gregorian_to_jd(2024, 3, 19));
+	GATS_CHECK_EQUAL(persian_to_jd(1404, 1, 1), gregorian_to_jd(2025, 3, 20));
+	GATS_CHECK_EQUAL(persian_to_jd(1404, 12, 30), gregorian_to_jd(2026, 3, 20));
+	GATS_CHECK_EQUAL(persian_to_jd(1405, 1, 1), gregorian_to_jd(2026, 3, 21));
+	jd_to_persian(gregorian_to_jd(2024, 3, 20, 12, 0, 0), y, m, d);
+	GATS_CHECK(y == 1403 && m == 1 && d == 1);
+	GATS_CHECK(is_persian_leapyear(1399) && !is_persian_leapyear(1403) && is_persian_leapyear(1404));
+	GATS_CHECK_EQUAL(string(persian_month_name(12)), "Esfand");
+
+	// the new calendars work with the generic algorithms
+	GATS_CHECK(is_valid<coptic_calendar>(1739, 13, 6) && !is_valid<coptic_calendar>(1740, 13, 6));
+	GATS_CHECK(is_valid<persian_calendar>(1404, 12, 30) && !is_valid<persian_calendar>(1403, 12, 30));
+	GATS_CHECK_EQUAL(day_of_week<ethiopic_calendar>(2016, 1, 1), Tuesday);
+	GATS_CHECK_EQUAL(day_of_year<coptic_calendar>(1739, 13, 6), 366);
+	GATS_CHECK_EQUAL(nth_weekday<ethiopic_calendar>(2016, 13, Monday, 1), 4);		// Friday 2024-09-06 to Tuesday
+	GATS_CHECK_EQUAL(nth_weekday<ethiopic_calendar>(2016, 13, Wednesday, 1), 0);
+#endif
+}
+
+
+
+/** Column conversions agree with the scalar ones. */
+GATS_TEST_CASE(ut144_cyclic_calendar_columns, UTILITY_GROUP, 1) {
+#if PHASE_144
+	using namespace khronos;
+
+	constexpr size_t N = 10'007;
+	mt19937_64 rng(144);
+	uniform_real_distribution<jd_t> jdDist(-1'000'000.0, 5'000'000.0);
+	vector<jd_t> jds(N), back(N);
+	for (auto& jd : jds)
+		jd = jdDist(rng);
+	vector<year_t> years(N);
+	vector<month_t> months(N);
+	vector<day_t> days(N);
+
+	auto check = [&]<typename Engine>(Engine const*, auto to_jd) {
+		Engine::from_jd(jds, years, months, days);
+		Engine::to_jd(years, months, days, back);
+		bool same = true;
+		for (size_t i = 0; i < N; ++i) {
+			same &= back[i] == jd_to_jdn(jds[i]) - 0.5;
+			same &= back[i] == to_jd(years[i], months[i], days[i]);
+			same &= days[i] >= 1 && days[i] <= Engine::days_in_month(years[i], months[i]);
+		}
+		GATS_CHECK(same);
+	};
+	check(static_cast<julian_calendar const*>(nullptr), [](year_t y, month_t m, day_t d) { return julian_to_jd(y, m, d); });
+	check(static_cast<islamic_calendar const*>(nullptr), [](year_t y, month_t m, day_t d) { return islamic_to_jd(y, m, d); });
+	check(static_cast<vulcan_calendar const*>(nullptr), [](year_t y, month_t m, day_t d) { return vulcan_to_jd(y, m, d); });
+	check(static_cast<coptic_calendar const*>(nullptr), coptic_to_jd);
+	check(static_cast<ethiopic_calendar const*>(nullptr), ethiopic_to_jd);
+	check(static_cast<persian_calendar const*>(nullptr), persian_to_jd);
+#endif
+}
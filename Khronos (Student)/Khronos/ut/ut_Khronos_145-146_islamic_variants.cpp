@@ -0,0 +1,186 @@
+/*	ut_Khronos_145-146_islamic_variants.cpp
+
+	Khronos library Islamic calendar variants unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+	Years outside the tables are invalid dates rather than errors.
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <random>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+
+
+/** The tabular variants differ only where their leap years and epochs do. */
+GATS_TEST_CASE(ut145_islamic_tabular_variants, UTILITY_GROUP, 1) {
+#if PHASE_145
+	using namespace khronos;
+
+	// the default variant is the Islamic calendar's own
+	for (year_t y = -60; y <= 60; ++y)
+		GATS_CHECK(is_islamic_leapyear_for<islamic_rules>(y) == is_islamic_leapyear(y));
+	GATS_CHECK_EQUAL(islamic_to_jd_for<islamic_rules>(1445, 9, 1), islamic_to_jd(1445, 9, 1));
+
+	// year 15 is leap instead of 16
+	GATS_CHECK(is_islamic_leapyear_for<islamic_15_rules>(15) && !is_islamic_leapyear_for<islamic_15_rules>(16));
+	GATS_CHECK_EQUAL(islamic_to_jd_for<islamic_15_rules>(16, 1, 1), islamic_to_jd(16, 1, 1) + 1);
+	GATS_CHECK_EQUAL(islamic_to_jd_for<islamic_15_rules>(17, 1, 1), islamic_to_jd(17, 1, 1));
+	GATS_CHECK_EQUAL(islamic_to_jd_for<islamic_15_rules>(1445, 9, 1), islamic_to_jd(1445, 9, 1));		// 1445 = 48 * 30 + 5
+
+	// Habash al-Hasib: 30 instead of 29
+	GATS_CHECK(is_islamic_leapyear_for<islamic_habash_rules>(30) && !is_islamic_leapyear_for<islamic_habash_rules>(29));
+	GATS_CHECK_EQUAL(islamic_to_jd_for<islamic_habash_rules>(31, 1, 1), islamic_to_jd(31, 1, 1));
+	GATS_CHECK_EQUAL(islamic_to_jd_for<islamic_habash_rules>(30, 1, 1), islamic_to_jd(30, 1, 1) - 1);
+
+	// Bohra: the Thursday epoch
+	GATS_CHECK_EQUAL(islamic_to_jd_for<islamic_bohra_rules>(1, 1, 1), ISLAMIC_ASTRONOMICAL_EPOCH);
+	GATS_CHECK_EQUAL(day_of_week(islamic_to_jd_for<islamic_bohra_rules>(1, 1, 1)), Thursday);
+	GATS_CHECK_EQUAL(day_of_week(islamic_to_jd(1, 1, 1)), Friday);
+
+	// every variant has 10631 days in 30 years and round trips
+	auto check = [&]<typename Rules>(Rules const*) {
+		static_assert(cyclic_calendar<Rules>::CYCLE_DAYS == 10'631);
+		bool same = true;
+		for (jd_t jd = gregorian_to_jd(1900, 1, 1); jd < gregorian_to_jd(2100, 1, 1); jd += 7.25) {
+			year_t y; month_t m; day_t d;
+			jd_to_islamic_for<Rules>(jd, y, m, d);
+			same &= islamic_to_jd_for<Rules>(y, m, d) == jd_to_jdn(jd) - 0.5;
+			same &= abs(islamic_to_jd_for<Rules>(y, m, d) - islamic_to_jd(y, m, d)) <= 2;
+		}
+		GATS_CHECK(same);
+	};
+	check(static_cast<islamic_15_rules const*>(nullptr));
+	check(static_cast<islamic_habash_rules const*>(nullptr));
+	check(static_cast<islamic_bohra_rules const*>(nullptr));
+
+	// and works with the generic algorithms
+	GATS_CHECK(is_valid<cyclic_calendar<islamic_habash_rules>>(30, 12, 30) && !is_valid<cyclic_calendar<islamic_habash_rules>>(29, 12, 30));
+
+	// the date class of a variant; Islamic is the arithmetic one
+	static_assert(is_same_v<Islamic, basic_islamic<islamic_rules>>);
+	basic_islamic<islamic_habash_rules> const habash(30, 12, 30, 18, 0, 0);
+	GATS_CHECK_EQUAL(habash.to_jd(), islamic_to_jd(31, 1, 1) - 0.25);
+	GATS_CHECK_EQUAL(basic_islamic<islamic_habash_rules>(habash.to_jd()).day(), 30);
+	GATS_CHECK_EQUAL((habash + 1.0_years).day(), 29);
+	GATS_CHECK_EQUAL(habash.day_of_year(), 355);
+	GATS_CHECK_EQUAL((Islamic(30, 12, 29) + 1.0_years).day(), 29);
+	GATS_CHECK_EQUAL(Islamic(1445, 9, 1).to_string(), "Monday, Ramadan 1 1445 A.H., 12:00:00 am");
+#endif
+}
+
+
+
+/** A month-length table reproduces the calendar it was built from, and any irregular one. */
+GATS_TEST_CASE(ut146_islamic_month_table, UTILITY_GROUP, 1) {
+#if PHASE_146
+	using namespace khronos;
+
+	// a table of the tabular calendar's own month lengths must agree with it
+	vector<uint16_t> tabular;
+	for (year_t y = 1400; y < 1500; ++y)
+		tabular.push_back(islamic_month_table::tabular_months<islamic_rules>(y));
+	islamic_month_table const table(1400, islamic_to_jd(1400, 1, 1), tabular);
+	GATS_CHECK_EQUAL(table.first_year(), 1400);
+	GATS_CHECK_EQUAL(table.last_year(), 1499);
+	GATS_CHECK_EQUAL(table.days_in_month(1445, 9), 30);
+	GATS_CHECK_EQUAL(table.days_in_year(1444), islamic_calendar::days_in_year(1444));
+	bool same = true;
+	for (jd_t jd = islamic_to_jd(1400, 1, 1); jd < islamic_to_jd(1500, 1, 1); jd += 1.0) {
+		year_t y, ty; month_t m, tm; day_t d, td;
+		jd_to_islamic(jd, y, m, d);
+		table.from_jd(jd + 0.3, ty, tm, td);
+		same &= y == ty && m == tm && d == td && table.to_jd(y, m, d) == jd;
+	}
+	GATS_CHECK(same);
+
+	// out of range
+	GATS_CHECK(table.covers(islamic_to_jd(1499, 12, 29)) && !table.covers(islamic_to_jd(1500, 1, 1)) && !table.covers(islamic_to_jd(1399, 12, 29)));
+	year_t y; month_t m; day_t d;
+	GATS_CHECK_THROW(table.from_jd(islamic_to_jd(1500, 1, 1), y, m, d), std::out_of_range);
+	GATS_CHECK_THROW(table.to_jd(1399, 1, 1), std::out_of_range);
+	GATS_CHECK_EQUAL(table.days_in_month(1500, 1), 0);
+	GATS_CHECK_EQUAL(table.days_in_year(1399), 0);
+
+	// an observational table: any mix of 29- and 30-day months, checked by walking it day by day
+	mt19937_64 rng(146);
+	vector<uint16_t> observed(300);
+	for (auto& bits : observed)
+		bits = static_cast<uint16_t>(rng());
+	jd_t const start = gregorian_to_jd(1882, 11, 12);
+	islamic_month_table const irregular(1300, start, observed);
+	bool walked = true;
+	jd_t jd = start;
+	for (year_t year = 1300; year < 1600; ++year)
+		for (month_t month = 1; month <= 12; ++month)
+			for (day_t day = 1; day <= irregular.days_in_month(year, month); ++day, jd += 1.0) {
+				irregular.from_jd(jd, y, m, d);
+				walked &= y == year && m == month && d == day && irregular.to_jd(year, month, day) == jd;
+			}
+	GATS_CHECK(walked);
+	GATS_CHECK(!irregular.covers(jd));
+
+	// Umm al-Qura, bundled
+	static_assert(umm_al_qura::FIRST_YEAR == 1300 && umm_al_qura::LAST_YEAR == 1600);
+	static_assert(umm_al_qura::days_in_month(1445, 9) == 30 && umm_al_qura::days_in_year(1445) == 354);
+	GATS_CHECK_EQUAL(umm_al_qura::to_jd(1300, 1, 1), gregorian_to_jd(1882, 11, 12));
+	GATS_CHECK_EQUAL(umm_al_qura::to_jd(1444, 10, 1), gregorian_to_jd(2023, 4, 21));
+	GATS_CHECK_EQUAL(islamic_to_jd_for<umm_al_qura_rules>(1445, 9, 1), gregorian_to_jd(2024, 3, 11));
+	GATS_CHECK_EQUAL(umm_al_qura::to_jd(1445, 12, 10), gregorian_to_jd(2024, 6, 16));
+	GATS_CHECK_EQUAL(umm_al_qura::to_jd(1446, 1, 1), gregorian_to_jd(2024, 7, 7));
+	GATS_CHECK(!is_islamic_leapyear_for<umm_al_qura_rules>(1445) && is_islamic_leapyear_for<umm_al_qura_rules>(1447));
+	GATS_CHECK(umm_al_qura::covers(umm_al_qura::to_jd(1600, 12, 1)) && !umm_al_qura::covers(umm_al_qura::to_jd(1300, 1, 1) - 1));
+	GATS_CHECK_THROW(umm_al_qura::to_jd(1601, 1, 1), std::out_of_range);
+	GATS_CHECK_THROW(umm_al_qura::from_jd(gregorian_to_jd(1800, 1, 1), y, m, d), std::out_of_range);
+
+	// agrees with a run-time table of the same words, and stays within two days of the arithmetic calendar
+	islamic_month_table const published(1300, umm_al_qura_rules::epoch, umm_al_qura_rules::months);
+	bool agrees = true, near = true;
+	for (jd_t day = published.to_jd(1300, 1, 1); published.covers(day); day += 1.0) {
+		year_t py; month_t pm; day_t pd;
+		published.from_jd(day, py, pm, pd);
+		jd_to_islamic_for<umm_al_qura_rules>(day + 0.5, y, m, d);
+		agrees &= y == py && m == pm && d == pd && umm_al_qura::to_jd(y, m, d) == day;
+		near &= abs(islamic_to_jd(y, m, d) - day) <= 2;
+	}
+	GATS_CHECK(agrees);
+	GATS_CHECK(near);
+
+	// and as a date class
+	UmmAlQura const ramadan(gregorian_to_jd(2024, 3, 11, 18, 0, 0));
+	GATS_CHECK_EQUAL(ramadan.year(), 1445);
+	GATS_CHECK_EQUAL(ramadan.month(), 9);
+	GATS_CHECK_EQUAL(ramadan.day(), 1);
+	GATS_CHECK_EQUAL(ramadan.hour(), 18);
+	GATS_CHECK_EQUAL(ramadan.to_string(), "Monday, Ramadan 1 1445 A.H., 6:00:00 pm");
+	GATS_CHECK_EQUAL((ramadan + 1_months).to_jd(), gregorian_to_jd(2024, 4, 10, 18, 0, 0));
+	GATS_CHECK_EQUAL((UmmAlQura(1445, 9, 30) + 1_months).day(), 29);		// Shawwal 1445 has 29 days
+	GATS_CHECK_EQUAL(day_of_year<UmmAlQura>(1445, 12, 30), 354);
+	GATS_CHECK(is_valid<UmmAlQura>(1445, 9, 30) && !is_valid<UmmAlQura>(1445, 10, 30));
+
+	// years outside the table are invalid, not errors
+	static_assert(umm_al_qura::days_in_month(1601, 1) == 0 && umm_al_qura::days_in_year(1299) == 0);
+	GATS_CHECK(!is_valid<UmmAlQura>(1700, 1, 1) && !is_valid<UmmAlQura>(1299, 12, 1));
+	GATS_CHECK(!is_islamic_leapyear_for<umm_al_qura_rules>(1700));
+	GATS_CHECK(!make_date<UmmAlQura>(1700, 1, 1).has_value());
+	std::vector<year_t> const years(200, 1445), outside{ 1299, 1601, 1700 };
+	std::vector<year_t> mixed(years);
+	mixed.insert(mixed.begin() + 70, outside.begin(), outside.end());
+	std::vector<month_t> const months(mixed.size(), 1);
+	std::vector<day_t> const days(mixed.size(), 1);
+	std::vector<std::uint64_t> mask((mixed.size() + 63) / 64);
+	GATS_CHECK_EQUAL(validate<UmmAlQura>(mixed, months, days, mask), years.size());
+	GATS_CHECK_EQUAL(validate<UmmAlQura>(parallel_policy{ 4 }, mixed, months, days, mask), years.size());
+	GATS_CHECK(!(mask[1] >> (70 - 64) & 1) && !(mask[1] >> (72 - 64) & 1) && (mask[1] >> (73 - 64) & 1));
+#endif
+}
@@ -0,0 +1,186 @@
+/*	ut_Khronos_147-148_historical.cpp
+
+	Khronos library historical (Julian to Gregorian reform) calendar unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+	Generic validation rejects the skipped days.
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <vector>
+using namespace std;
+
+
+
+/** Dates convert through the calendar in force on the day, and the skipped days do not exist. */
+GATS_TEST_CASE(ut147_historical_conversion, UTILITY_GROUP, 1) {
+#if PHASE_147
+	using namespace khronos;
+
+	GATS_CHECK_EQUAL(papal_reform::first_jdn, jd_to_jdn(gregorian_to_jd(1582, 10, 15)));
+	GATS_CHECK_EQUAL(british_reform::first_jdn, jd_to_jdn(gregorian_to_jd(1752, 9, 14)));
+	GATS_CHECK_EQUAL(russian_reform::first_jdn, jd_to_jdn(gregorian_to_jd(1918, 2, 14)));
+	for (year_t y = -4'800; y <= 4'800; y += 37)
+		for (month_t m = 1; m <= 12; ++m)
+			GATS_CHECK_EQUAL(detail::gregorian_jdn(y, m, 28), date_jdn<Gregorian>(y, m, 28));
+
+	// the last Julian day is followed by the first Gregorian day
+	GATS_CHECK_EQUAL(historical_to_jd<british_reform>(1752, 9, 2), julian_to_jd(1752, 9, 2));
+	GATS_CHECK_EQUAL(historical_to_jd<british_reform>(1752, 9, 14), gregorian_to_jd(1752, 9, 14));
+	GATS_CHECK_EQUAL(historical_to_jd<british_reform>(1752, 9, 14) - historical_to_jd<british_reform>(1752, 9, 2), 1.0);
+	GATS_CHECK_EQUAL(historical_to_jd<papal_reform>(1582, 10, 15) - historical_to_jd<papal_reform>(1582, 10, 4), 1.0);
+	GATS_CHECK_EQUAL(historical_to_jd<russian_reform>(1918, 2, 14) - historical_to_jd<russian_reform>(1918, 1, 31), 1.0);
+	GATS_CHECK_EQUAL(historical_to_jd<russian_reform>(1918, 2, 14, 12, 0, 0), gregorian_to_jd(1918, 2, 14, 12, 0, 0));
+	GATS_CHECK_EQUAL(historical_to_jd<russian_reform>(1918, 1, 31, 12, 0, 0), julian_to_jd(1918, 1, 31, 12, 0, 0));
+
+	GATS_CHECK(is_historical_date<british_reform>(1752, 9, 2));
+	GATS_CHECK(!is_historical_date<british_reform>(1752, 9, 3));
+	GATS_CHECK(!is_historical_date<british_reform>(1752, 9, 13));
+	GATS_CHECK(is_historical_date<british_reform>(1752, 9, 14));
+	GATS_CHECK(is_historical_date<british_reform>(1700, 2, 29));
+
+	// ... and neither does generic validation
+	using British = Historical<british_reform>;
+	GATS_CHECK(is_valid<British>(1752, 9, 2) && is_valid<British>(1752, 9, 14) && is_valid<British>(1700, 2, 29));
+	GATS_CHECK(!is_valid<British>(1752, 9, 5) && !is_valid<British>(1752, 9, 13));
+	GATS_CHECK(!is_valid<British>(1752, 9, 5, 12, 0, 0));
+	GATS_CHECK(make_date<British>(1752, 9, 5).error() == date_error::day);
+	GATS_CHECK(make_date<British>(1752, 9, 14).has_value());
+	vector<year_t> const vYears(200, 1752);
+	vector<month_t> const vMonths(vYears.size(), 9);
+	vector<day_t> vDays(vYears.size(), 20);
+	for (day_t d = 1; d <= 30; ++d)
+		vDays[100 + d] = d;		// 1..30 September: 11 skipped
+	vector<uint64_t> mask(validity_mask_words(vYears.size()));
+	GATS_CHECK_EQUAL(validate<British>(vYears, vMonths, vDays, mask), vYears.size() - 11);
+	GATS_CHECK_EQUAL(validate<British>(parallel_policy{ 2 }, vYears, vMonths, vDays, mask), vYears.size() - 11);
+	GATS_CHECK(!(mask[1] >> (100 + 5 - 64) & 1) && (mask[1] >> (100 + 14 - 64) & 1));
+	GATS_CHECK(!is_historical_date<papal_reform>(1700, 2, 29));
+	GATS_CHECK(!is_historical_date<russian_reform>(1918, 2, 1));
+	GATS_CHECK(!is_historical_date<russian_reform>(1918, 13, 1));
+
+	// month and year lengths
+	GATS_CHECK_EQUAL(historical_month_length<papal_reform>(1582, 10), 21);
+	GATS_CHECK_EQUAL(historical_month_length<british_reform>(1752, 9), 19);
+	GATS_CHECK_EQUAL(historical_month_length<russian_reform>(1918, 2), 15);
+	GATS_CHECK_EQUAL(historical_month_length<russian_reform>(1918, 1), 31);
+	GATS_CHECK_EQUAL(historical_days_in_month<russian_reform>(1918, 2), 28);
+	GATS_CHECK_EQUAL(historical_days_in_year<papal_reform>(1582), 355);
+	GATS_CHECK_EQUAL(historical_days_in_year<british_reform>(1752), 355);
+	GATS_CHECK_EQUAL(historical_days_in_year<british_reform>(1700), 366);
+	GATS_CHECK_EQUAL(historical_days_in_year<russian_reform>(1918), 352);
+	GATS_CHECK_EQUAL(historical_days_in_year<russian_reform>(1900), 366);
+	GATS_CHECK_EQUAL(historical_days_in_year<russian_reform>(2000), 366);
+
+	// a reform on 1 March cuts the end of February: Denmark went from 18 February 1700 to 1 March
+	using danish_reform = gregorian_reform<1700, 3, 1>;
+	GATS_CHECK_EQUAL(historical_month_length<danish_reform>(1700, 2), 18);
+	GATS_CHECK_EQUAL(historical_month_length<danish_reform>(1700, 3), 31);
+	GATS_CHECK(is_historical_date<danish_reform>(1700, 2, 18));
+	GATS_CHECK(!is_historical_date<danish_reform>(1700, 2, 19));
+	GATS_CHECK_EQUAL(historical_days_in_year<danish_reform>(1700), 355);
+
+	// every day from 1500 to 2000 round trips and follows the day before
+	auto check_days = [&]<typename Reform>() {
+		long long const first = date_jdn<Julian>(1500, 1, 1), last = date_jdn<Gregorian>(2000, 12, 31);
+		year_t y; month_t m; day_t d;
+		jd_to_historical<Reform>(static_cast<jd_t>(first), y, m, d);
+		for (long long jdn = first + 1; jdn <= last; ++jdn) {
+			year_t y2; month_t m2; day_t d2;
+			jd_to_historical<Reform>(static_cast<jd_t>(jdn), y2, m2, d2);
+			GATS_CHECK(is_historical_date<Reform>(y2, m2, d2));
+			GATS_CHECK_EQUAL(historical_to_jd<Reform>(y2, m2, d2), static_cast<jd_t>(jdn) - 0.5);
+			GATS_CHECK(y2 == y ? (m2 == m ? d2 > d : m2 == m + 1) : y2 == y + 1 && m2 == 1 && d2 == 1);
+			y = y2; m = m2; d = d2;
+		}
+		for (year_t year = 1500; year <= 2000; ++year) {
+			int days = 0;
+			for (month_t month = 1; month <= 12; ++month)
+				days += historical_month_length<Reform>(year, month);
+			GATS_CHECK_EQUAL(days, historical_days_in_year<Reform>(year));
+		}
+	};
+	check_days.operator()<papal_reform>();
+	check_days.operator()<british_reform>();
+	check_days.operator()<russian_reform>();
+	check_days.operator()<danish_reform>();
+
+	// columns of archival records
+	vector<year_t> const years = { 1666, 1752, 1752, 1776, 2000 };
+	vector<month_t> const months = { 9, 9, 9, 7, 1 };
+	vector<day_t> const days = { 2, 2, 14, 4, 1 };
+	vector<jd_t> jds(years.size());
+	historical_to_jd<british_reform>(years, months, days, jds);
+	GATS_CHECK_EQUAL(jds[0], julian_to_jd(1666, 9, 2));
+	GATS_CHECK_EQUAL(jds[2] - jds[1], 1.0);
+	GATS_CHECK_EQUAL(jds[3], gregorian_to_jd(1776, 7, 4));
+
+	vector<year_t> y(jds.size());
+	vector<month_t> m(jds.size());
+	vector<day_t> d(jds.size());
+	jd_to_historical<british_reform>(jds, y, m, d);
+	GATS_CHECK_ALL_EQUAL(y, years);
+	GATS_CHECK_ALL_EQUAL(m, months);
+	GATS_CHECK_ALL_EQUAL(d, days);
+#endif
+}
+
+
+
+/** The class steps over the skipped days and names dates in the calendar in force. */
+GATS_TEST_CASE(ut148_historical_class, UTILITY_GROUP, 1) {
+#if PHASE_148
+	using namespace khronos;
+	using British = Historical<british_reform>;
+	using Spanish = Historical<papal_reform>;
+
+	British const last(1752, 9, 2), first(1752, 9, 14);
+	GATS_CHECK(!last.is_gregorian());
+	GATS_CHECK(first.is_gregorian());
+	GATS_CHECK_EQUAL(first - last, 1.0);
+	GATS_CHECK(last < first);
+	GATS_CHECK(British(last.to_jd() + 1) == first);
+	GATS_CHECK_EQUAL(last.to_string(), "Wednesday, September 2 1752 CE, 12:00:00 am");
+	GATS_CHECK_EQUAL(first.to_string(), "Thursday, September 14 1752 CE, 12:00:00 am");
+	GATS_CHECK_EQUAL(Spanish(1582, 10, 4).day_of_week(), Thursday);
+	GATS_CHECK_EQUAL(Spanish(1582, 10, 15).day_of_week(), Friday);
+	GATS_CHECK_EQUAL(first.day_of_year(), 247);
+	GATS_CHECK_EQUAL(British(1752, 12, 31).day_of_year(), 355);
+
+	British noon(gregorian_to_jd(1752, 9, 20, 12, 30, 0));
+	GATS_CHECK_EQUAL(noon.day(), 20);
+	GATS_CHECK_EQUAL(noon.hour(), 12);
+	GATS_CHECK_EQUAL(noon.minute(), 30);
+	noon = julian_to_jd(1700, 2, 29);
+	GATS_CHECK(noon == British(1700, 2, 29));
+
+	// months that land on a skipped day move to the first Gregorian day
+	British d = British(1752, 8, 10) + 1_month;
+	GATS_CHECK(d == British(1752, 9, 14));
+	GATS_CHECK(British(1752, 8, 31) + 1_month == British(1752, 9, 30));
+	GATS_CHECK(British(1752, 10, 5) - detail::packaged_month_integer(1) == British(1752, 9, 14));
+	GATS_CHECK(British(1752, 9, 2) + 12_months == British(1753, 9, 2));
+	GATS_CHECK(Spanish(1582, 9, 10) + 1_month == Spanish(1582, 10, 15));
+	GATS_CHECK(Historical<russian_reform>(1918, 1, 5) + 1_month == Historical<russian_reform>(1918, 2, 14));
+	GATS_CHECK(Historical<russian_reform>(1918, 1, 31) + 1_month == Historical<russian_reform>(1918, 2, 28));
+
+	// ... unless the reform month is the next one
+	using Danish = Historical<gregorian_reform<1700, 3, 1>>;
+	GATS_CHECK(Danish(1700, 1, 31) + 1_month == Danish(1700, 2, 18));
+	GATS_CHECK(Danish(1700, 1, 10) + 1_month == Danish(1700, 2, 10));
+
+	// years keep 29 February where the calendar in force has it
+	GATS_CHECK(British(1696, 2, 29) + 4.0_years == British(1700, 2, 29));
+	GATS_CHECK(Spanish(1696, 2, 29) + 4.0_years == Spanish(1700, 2, 28));
+	GATS_CHECK(British(1700, 2, 29) + 1.0_year == British(1701, 2, 28));
+	GATS_CHECK(British(1751, 9, 5) + 1.0_year == British(1752, 9, 14));
+#endif
+}
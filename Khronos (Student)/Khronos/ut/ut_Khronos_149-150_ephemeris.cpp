@@ -0,0 +1,155 @@
+/*	ut_Khronos_149-150_ephemeris.cpp
+
+	Khronos library Sun and Moon ephemeris unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+
+
+/** Positions and new moons match the worked examples of Meeus, "Astronomical Algorithms". */
+GATS_TEST_CASE(ut149_ephemeris_positions, UTILITY_GROUP, 1) {
+#if PHASE_149
+	using namespace khronos;
+
+	// example 25.a: 1992 October 13.0 TD
+	auto const sun = sun_position(2'448'908.5);
+	GATS_CHECK(abs(sun.longitude - 199.908'95) < 1e-4);
+	GATS_CHECK(abs(sun.distance - 0.997'66) < 1e-5);
+
+	// example 47.a: 1992 April 12.0 TD
+	auto const moon = moon_position(2'448'724.5);
+	GATS_CHECK(abs(moon.longitude - 133.167'265) < 1e-4);
+	GATS_CHECK(abs(moon.latitude + 3.229'126) < 1e-6);
+	GATS_CHECK(abs(moon.distance - 368'409.7) < 0.1);
+
+	// the block kernels agree with the scalar functions
+	vector<jd_t> jdes(1'000);
+	for (size_t i = 0; i < jdes.size(); ++i)
+		jdes[i] = 2'415'020.5 + 73.3 * i;
+	vector<ecliptic_position> suns(jdes.size()), moons(jdes.size());
+	sun_positions(jdes, suns);
+	moon_positions(jdes, moons);
+	bool same = true;
+	for (size_t i = 0; i < jdes.size(); ++i) {
+		auto const m = moon_position(jdes[i]);
+		same &= abs(moons[i].longitude - m.longitude) < 1e-9 && abs(moons[i].latitude - m.latitude) < 1e-9
+			&& abs(moons[i].distance - m.distance) < 1e-6 && suns[i].longitude == sun_position(jdes[i]).longitude;
+	}
+	GATS_CHECK(same);
+
+	// example 49.a: the new moon of February 1977
+	GATS_CHECK(abs(new_moon(-283) - 2'443'192.651'18) < 1e-5);
+
+	// the eclipse new moon of 8 April 2024, 18:21 UT
+	long long const k = lunation_of(gregorian_to_jd(2024, 4, 9));
+	GATS_CHECK(abs(new_moon(k) - delta_t(new_moon(k)) / SECONDS_PER_DAY - gregorian_to_jd(2024, 4, 8, 18, 21, 0)) < 2.0 / 1'440);
+	GATS_CHECK_EQUAL(lunation_of(new_moon(k)), k);
+	GATS_CHECK_EQUAL(lunation_of(new_moon(k) - 1e-5), k - 1);
+
+	vector<jd_t> moons1977(600);
+	new_moons(-300, moons1977);
+	same = true;
+	for (size_t i = 0; i < moons1977.size(); ++i) {
+		same &= abs(moons1977[i] - new_moon(-300 + static_cast<long long>(i))) < 1e-9;
+		if (i > 0)
+			same &= moons1977[i] - moons1977[i - 1] > 29.2 && moons1977[i] - moons1977[i - 1] < 29.9;
+	}
+	GATS_CHECK(same);
+
+	// the molad: BaHaRaD, and Friday 15 September 2023, 5:49 am Jerusalem for Tishri 5784
+	GATS_CHECK_EQUAL(day_of_week(hebrew_to_jd(1, 7, 1)), Monday);
+	GATS_CHECK(abs(hebrew_molad(1, 7) - (hebrew_to_jd(1, 7, 1) - 1 + tod(23, 11, 20))) < 1e-6);
+	GATS_CHECK(abs(hebrew_molad(5784, 7) - gregorian_to_jd(2023, 9, 15, 5, 49, 0)) < 1e-6);
+	GATS_CHECK(abs(hebrew_molad(5784, 8) - hebrew_molad(5784, 7) - (29 + 13'753 / 25'920.0)) < 1e-6);
+	GATS_CHECK(abs(hebrew_molad(5785, 7) - hebrew_molad(5784, 7) - 13 * (29 + 13'753 / 25'920.0)) < 1e-6);
+
+	GATS_CHECK(abs(delta_t(2'451'545.0) - 64) < 30);
+#endif
+}
+
+
+
+/** Sunrise, sunset and the first crescent decide the observed Islamic months. */
+GATS_TEST_CASE(ut150_ephemeris_observation, UTILITY_GROUP, 1) {
+#if PHASE_150
+	using namespace khronos;
+
+	// midsummer in London: sunrise 4:43 am, sunset 9:21 pm BST
+	geo_location const london{ 51.507'4, -0.127'8 };
+	jd_t const midsummer = gregorian_to_jd(2024, 6, 21);
+	GATS_CHECK(abs(sunrise(midsummer, london) - gregorian_to_jd(2024, 6, 21, 3, 43, 0)) < 2.0 / 1'440);
+	GATS_CHECK(abs(sunset(midsummer, london) - gregorian_to_jd(2024, 6, 21, 20, 21, 0)) < 2.0 / 1'440);
+	GATS_CHECK_EQUAL(sunset_date(gregorian_to_jd(2024, 6, 21, 20, 0, 0), london), midsummer);
+	GATS_CHECK_EQUAL(sunset_date(gregorian_to_jd(2024, 6, 21, 20, 30, 0), london), midsummer + 1);
+
+	// the midnight sun and the polar night
+	geo_location const tromso{ 69.65, 18.96 };
+	GATS_CHECK(isnan(sunset(midsummer, tromso)));
+	GATS_CHECK(isnan(sunrise(gregorian_to_jd(2024, 12, 21), tromso)));
+
+	vector<jd_t> days(366), sets(days.size());
+	for (size_t i = 0; i < days.size(); ++i)
+		days[i] = gregorian_to_jd(2024, 1, 1) + static_cast<jd_t>(i);
+	sunsets(days, london, sets);
+	bool same = true;
+	for (size_t i = 0; i < days.size(); ++i)
+		same &= sets[i] == sunset(days[i], london) && sets[i] > days[i] + 0.5 && sets[i] < days[i] + 0.9;
+	GATS_CHECK(same);
+
+	// Ramadan 1445 from Mecca: no crescent on 10 March 2024, an easy one on the 11th
+	geo_location const mecca{ 21.422'5, 39.826'2 };
+	auto const march10 = observe_crescent(gregorian_to_jd(2024, 3, 10), mecca);
+	GATS_CHECK(march10.visibility >= crescent_visibility::below_telescope);
+	auto const march11 = observe_crescent(gregorian_to_jd(2024, 3, 11), mecca);
+	GATS_CHECK(march11.visibility == crescent_visibility::easily_visible);
+	GATS_CHECK(march11.moonset > march11.sunset);
+	GATS_CHECK(march11.best_time > march11.sunset && march11.best_time < march11.moonset);
+	GATS_CHECK(march11.arcl > 10 && march11.arcl < 25);
+	auto const april8 = observe_crescent(gregorian_to_jd(2024, 4, 8), mecca);
+	GATS_CHECK(april8.visibility == crescent_visibility::not_visible);
+	GATS_CHECK(isnan(april8.q));
+
+	long long const ramadan = lunation_of(gregorian_to_jd(2024, 3, 11));
+	GATS_CHECK_EQUAL(observed_month_start(ramadan, mecca), gregorian_to_jd(2024, 3, 12));
+	GATS_CHECK_EQUAL(observed_month_start(ramadan + 1, mecca), gregorian_to_jd(2024, 4, 10));
+
+	auto const months = observed_islamic_months(1444, 1446, mecca);
+	GATS_CHECK_EQUAL(months.first_year(), 1444);
+	GATS_CHECK_EQUAL(months.last_year(), 1446);
+	GATS_CHECK_EQUAL(months.to_jd(1445, 1, 1), gregorian_to_jd(2023, 7, 19));
+	GATS_CHECK_EQUAL(months.to_jd(1445, 9, 1), gregorian_to_jd(2024, 3, 12));
+	GATS_CHECK_EQUAL(months.to_jd(1445, 10, 1), gregorian_to_jd(2024, 4, 10));
+	GATS_CHECK_EQUAL(months.days_in_month(1445, 9), 29);
+	for (year_t y = 1444; y <= 1446; ++y)
+		GATS_CHECK(months.days_in_year(y) >= 354 && months.days_in_year(y) <= 355);
+
+	// every month starts after its conjunction, and the table round trips
+	same = true;
+	for (year_t y = 1444; y <= 1446; ++y)
+		for (month_t m = 1; m <= 12; ++m) {
+			jd_t const start = months.to_jd(y, m, 1);
+			jd_t const conjunction = new_moon(lunation_of(start));
+			same &= start - conjunction > 0 && start - conjunction < 3.5;
+			year_t y2; month_t m2; day_t d2;
+			months.from_jd(start + 14, y2, m2, d2);
+			same &= y2 == y && m2 == m && d2 == 15;
+		}
+	GATS_CHECK(same);
+	GATS_CHECK_THROW(observed_islamic_months(1446, 1445, mecca), std::invalid_argument);
+#endif
+}
@@ -0,0 +1,136 @@
+/*	ut_Khronos_151-152_astronomical_time.cpp
+
+	Khronos library astronomical time (epochs, sidereal time, equation of time) unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <cmath>
+#include <vector>
+using namespace std;
+
+
+
+/** The epoch views and Julian centuries are constexpr and exact on split days. */
+GATS_TEST_CASE(ut151_astronomical_epochs, UTILITY_GROUP, 1) {
+#if PHASE_151
+	using namespace khronos;
+
+	constexpr double mjd = jd_to_mjd(J2000);
+	GATS_CHECK_EQUAL(mjd, 51'544.5);
+	GATS_CHECK_EQUAL(mjd_to_jd(mjd), J2000);
+	GATS_CHECK_EQUAL(jd_to_tjd(J2000), 11'544.5);
+	GATS_CHECK_EQUAL(tjd_to_jd(0.0), gregorian_to_jd(1968, 5, 24));
+	GATS_CHECK_EQUAL(jd_to_rjd(J2000), 51'545.0);
+	GATS_CHECK_EQUAL(rjd_to_jd(0.0), gregorian_to_jd(1858, 11, 16, 12, 0, 0));
+	GATS_CHECK_EQUAL(jd_to_mjd(gregorian_to_jd(1858, 11, 17)), 0.0);
+	GATS_CHECK_EQUAL(J2000, gregorian_to_jd(2000, 1, 1, 12, 0, 0));
+
+	// example 12.a: 1987 April 10, 0h UT
+	constexpr double T = julian_centuries(2'446'895.5);
+	GATS_CHECK(abs(T + 0.127'296'372'348) < 1e-12);
+	GATS_CHECK_EQUAL(julian_centuries(split(2'446'895.5)), T);
+	GATS_CHECK_EQUAL(julian_centuries(J2000 + DAYS_PER_JULIAN_CENTURY), 1.0);
+
+	// split days and fractions
+	constexpr split_jd s = split(2'446'895.75);
+	GATS_CHECK_EQUAL(s.day, 2'446'895);
+	GATS_CHECK_EQUAL(s.fraction, 0.75);
+	GATS_CHECK_EQUAL(split(-0.25).day, -1);
+	GATS_CHECK_EQUAL(split(-0.25).fraction, 0.75);
+	GATS_CHECK_EQUAL(split(2'451'545).day, 2'451'545);			// an integer is a JD, not ticks
+	GATS_CHECK_EQUAL(split(2'451'545).fraction, 0.0);
+	GATS_CHECK_EQUAL(split_ticks(-1).day, -1);
+	GATS_CHECK_EQUAL(split_ticks(jd_to_ticks(J2000) + TICKS_PER_DAY / 4).day, 2'451'545);
+	GATS_CHECK_EQUAL(split_ticks(jd_to_ticks(J2000) + TICKS_PER_DAY / 4).fraction, 0.25);
+
+	// a microsecond survives in MJD from ticks; a JD double rounds it away
+	tick_t const t = jd_to_ticks(gregorian_to_jd(2024, 1, 1, 12, 0, 0)) + 1;
+	GATS_CHECK_EQUAL(days_since(split_ticks(t), MJD_EPOCH), 60'310.5 + 1.0 / TICKS_PER_DAY);
+	GATS_CHECK(ticks_to_jd(t) - MJD_EPOCH != 60'310.5 + 1.0 / TICKS_PER_DAY);
+
+	// columns
+	vector<tick_t> const ticks = { t, jd_to_ticks(J2000), jd_to_ticks(MJD_EPOCH) - TICKS_PER_DAY / 2 };
+	vector<jd_t> const jds = { J2000, 2'446'895.5, MJD_EPOCH };
+	vector<double> days(3), centuries(3);
+	days_since(ticks, MJD_EPOCH, days);
+	GATS_CHECK_EQUAL(days[0], 60'310.5 + 1.0 / TICKS_PER_DAY);
+	GATS_CHECK_EQUAL(days[1], 51'544.5);
+	GATS_CHECK_EQUAL(days[2], -0.5);
+	days_since(jds, TJD_EPOCH, days);
+	GATS_CHECK_EQUAL(days[0], 11'544.5);
+	GATS_CHECK_EQUAL(days[2], -40'000.0);
+	julian_centuries(jds, centuries);
+	GATS_CHECK_EQUAL(centuries[0], 0.0);
+	GATS_CHECK_EQUAL(centuries[1], T);
+#endif
+}
+
+
+
+/** Sidereal time and the equation of time match the worked examples of Meeus, "Astronomical Algorithms". */
+GATS_TEST_CASE(ut152_sidereal_time, UTILITY_GROUP, 1) {
+#if PHASE_152
+	using namespace khronos;
+	auto hms = [](double h, double m, double s) { return (h + m / 60 + s / 3'600) * 15; };	// degrees
+
+	// example 12.a: 1987 April 10, 0h UT
+	constexpr double theta0 = gmst(2'446'895.5);
+	GATS_CHECK(abs(theta0 - hms(13, 10, 46.366'8)) < 1e-6);
+	GATS_CHECK(abs(gast(2'446'895.5) - hms(13, 10, 46.135'1)) < 1e-4);		// 0.02 s with four nutation terms
+
+	// example 12.b: 1987 April 10, 19h21m UT
+	GATS_CHECK(abs(gmst(Jd(gregorian_to_jd(1987, 4, 10, 19, 21, 0))) - hms(8, 34, 57.089'6)) < 1e-6);
+	GATS_CHECK_EQUAL(gmst(split_ticks(jd_to_ticks(2'446'895.5))), gmst(split(2'446'895.5)));
+
+	// example 22.a: 1987 April 10, 0h TD
+	auto const n = nutation(2'446'895.5);
+	GATS_CHECK(abs(n.longitude + 3.788) < 0.5);
+	GATS_CHECK(abs(n.obliquity - 9.443) < 0.1);
+	GATS_CHECK(abs(mean_obliquity(2'446'895.5) - (23 + 26.0 / 60 + 27.407 / 3'600)) < 1e-6);
+
+	// example 28.a: 1992 October 13, 0h TD, +13m42.6s
+	GATS_CHECK(abs(equation_of_time(2'448'908.5) - (13 + 42.6 / 60)) < 2.0 / 60);
+
+	// the equation of time through a year: about -14m in February, +16m in November, 0 in mid-April
+	GATS_CHECK(abs(equation_of_time(gregorian_to_jd(2024, 2, 11)) + 14.2) < 0.2);
+	GATS_CHECK(abs(equation_of_time(gregorian_to_jd(2024, 11, 3)) - 16.4) < 0.2);
+	GATS_CHECK(abs(equation_of_time(gregorian_to_jd(2024, 4, 15))) < 0.5);
+
+	// one second of tick time is 1.0027379 seconds of sidereal time, at microsecond precision
+	tick_t const t = jd_to_ticks(gregorian_to_jd(2026, 10, 18, 3, 0, 0));
+	double const step = gmst(split_ticks(t + 1'000'000)) - gmst(split_ticks(t));
+	GATS_CHECK(abs(step - 360.985'647'366'29 / SECONDS_PER_DAY) < 1e-10);
+
+	// the kernels agree with the scalar functions
+	vector<jd_t> uts(1'000);
+	vector<tick_t> ticks(uts.size());
+	for (size_t i = 0; i < uts.size(); ++i) {
+		uts[i] = 2'415'020.5 + 47.123 * i;
+		ticks[i] = jd_to_ticks(uts[i]);
+	}
+	vector<double> mean(uts.size()), apparent(uts.size()), fromTicks(uts.size()), eot(uts.size());
+	gmst(uts, mean);
+	gast(uts, apparent);
+	gmst(ticks, fromTicks);
+	equation_of_time(uts, eot);
+	bool same = true, close = true;
+	for (size_t i = 0; i < uts.size(); ++i) {
+		same = same && mean[i] == gmst(uts[i]) && apparent[i] == gast(uts[i]) && eot[i] == equation_of_time(uts[i]);
+		close = close && abs(fromTicks[i] - mean[i]) < 1e-6 && mean[i] >= 0.0 && mean[i] < 360.0;
+	}
+	GATS_CHECK(same);
+	GATS_CHECK(close);
+	gast(ticks, apparent);
+	GATS_CHECK(abs(apparent[0] - gast(uts[0])) < 1e-6);
+#endif
+}
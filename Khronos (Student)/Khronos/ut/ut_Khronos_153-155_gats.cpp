@@ -0,0 +1,153 @@
+/*	ut_Khronos_153-155_gats.cpp
+
+	gats test framework (case pool, case output and budgets) unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <gats/ThreadPool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+
+/** A thread waiting on its parallel loop runs chunks of that loop only, never unrelated queued tasks. */
+GATS_TEST_CASE(ut153_pool_runs_own_chunks, UTILITY_GROUP, 1) {
+#if PHASE_153
+	thread::id unrelatedThread;
+	vector<long long> squares(1'000);
+	{
+		gats::ThreadPool pool(1);
+
+		// keep the only worker busy, then queue an unrelated task behind it
+		atomic<bool> blocked{ false }, released{ false };
+		pool.submit([&] { blocked = true; while (!released) this_thread::yield(); });
+		while (!blocked)
+			this_thread::yield();
+		pool.submit([&] { unrelatedThread = this_thread::get_id(); });
+
+		pool.parallel_for(0, 1'000, [&](int i) { squares[i] = static_cast<long long>(i) * i; });
+		GATS_CHECK(unrelatedThread == thread::id());		// still queued: the caller did not run it
+		released = true;
+	}
+	GATS_CHECK(unrelatedThread != thread::id());
+	GATS_CHECK(unrelatedThread != this_thread::get_id());
+	bool same = true;
+	for (int i = 0; i < 1'000; ++i)
+		same &= squares[i] == static_cast<long long>(i) * i;
+	GATS_CHECK(same);
+
+	// an idle worker takes a loop's helper before the whole tasks queued ahead of it
+	{
+		gats::ThreadPool pair(2);
+		atomic<bool> blocked{ false }, released{ false }, caseStarted{ false }, done{ false };
+		atomic<int> helperSawCase{ -1 };
+		pair.submit([&] { blocked = true; while (!released) this_thread::yield(); });
+		while (!blocked)
+			this_thread::yield();
+		pair.submit([&] {
+			thread::id const caller = this_thread::get_id();
+			for (int c = 0; c < 3; ++c)
+				pair.submit([&] { caseStarted = true; });
+			pair.parallel_for_chunks(0, 8, [&](int, int) {
+				if (this_thread::get_id() != caller) {
+					int expected = -1;
+					helperSawCase.compare_exchange_strong(expected, caseStarted ? 1 : 0);
+				}
+				else if (!released) {
+					// hold the first chunk until the other worker, now free, has taken a helper
+					released = true;
+					auto const deadline = chrono::steady_clock::now() + 5s;
+					while (helperSawCase < 0 && chrono::steady_clock::now() < deadline)
+						this_thread::yield();
+				}
+			});
+			done = true;
+		});
+		while (!done)
+			this_thread::yield();
+		GATS_CHECK_EQUAL(helperSawCase.load(), 0);
+	}
+
+	// loops nest inside chunks, and a chunk's exception reaches the caller
+	gats::ThreadPool pool(4);
+	atomic<long long> sum{ 0 };
+	pool.parallel_for(0, 100, [&](int i) {
+		pool.parallel_for(0, 100, [&](int j) { sum += i * 100 + j; });
+	});
+	GATS_CHECK_EQUAL(sum.load(), 10'000LL * 9'999 / 2);
+	GATS_CHECK_THROW(pool.parallel_for(0, 100, [](int i) { if (i == 57) throw std::runtime_error("chunk"); }), std::runtime_error);
+#endif
+}
+
+
+
+/** Console output written in a case is collected with that case. */
+GATS_TEST_CASE(ut154_case_console, UTILITY_GROUP, 1) {
+#if PHASE_154
+	auto const testCase = gats::TestApp::current_case(__FILE__, __LINE__);
+	auto const before = testCase->console().size();
+	cout << "ut154: case output ";
+	GATS_CHECK(testCase->console().ends_with("ut154: case output "));
+
+	// each chunk writes its own mark; the case prints them
+	string marks(8, ' ');
+	GATS_PARALLEL_FOR(i, 0, 8, { marks[i] = static_cast<char>('0' + i); });
+	GATS_CHECK_EQUAL(marks, "01234567");
+	cout << marks << endl;
+	auto const text = testCase->console().substr(before);
+	GATS_CHECK_EQUAL(text, "ut154: case output 01234567\n");
+#endif
+}
+
+
+
+/** A case's time is its own: unrelated work queued while it waits on a parallel loop is not charged to its budget. */
+GATS_TEST_CASE_BUDGETED(ut155_budget_excludes_unrelated_work, UTILITY_GROUP, 1, 1s) {
+#if PHASE_155
+	gats::ThreadPool pool(1);
+
+	// the unrelated task runs for 2 s if it starts before the loop is done, and returns at once after
+	atomic<bool> blocked{ false }, released{ false };
+	pool.submit([&] { blocked = true; while (!released) this_thread::yield(); });
+	while (!blocked)
+		this_thread::yield();
+	atomic<bool> unrelatedStarted{ false };
+	pool.submit([&] {
+		unrelatedStarted = true;
+		auto const deadline = chrono::steady_clock::now() + 2s;
+		while (!released && chrono::steady_clock::now() < deadline)
+			this_thread::yield();
+	});
+
+	// every chunk runs on this thread, and the unrelated task waits until the loop is done
+	thread::id const caller = this_thread::get_id();
+	atomic<int> foreignChunks{ 0 };
+	vector<double> roots(100'000);
+	pool.parallel_for_chunks(0, 100'000, [&](int first, int last) {
+		foreignChunks += this_thread::get_id() != caller;
+		for (int i = first; i < last; ++i)
+			roots[i] = sqrt(static_cast<double>(i));
+	});
+	GATS_CHECK(!unrelatedStarted);
+	GATS_CHECK_EQUAL(foreignChunks.load(), 0);
+	GATS_CHECK_EQUAL(roots[99'999], sqrt(99'999.0));
+	released = true;
+#endif
+}
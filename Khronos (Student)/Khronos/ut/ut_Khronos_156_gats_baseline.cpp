@@ -0,0 +1,70 @@
+/*	ut_Khronos_156_gats_baseline.cpp
+
+	gats test framework baseline times file unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <sstream>
+#include <string>
+#include <vector>
+using namespace std;
+
+
+
+/** Baseline times are read in any column order, and lines that cannot be read are skipped and reported. */
+GATS_TEST_CASE(ut156_baseline_malformed_lines, UTILITY_GROUP, 1) {
+#if PHASE_156
+	using namespace std::chrono_literals;
+	using Baseline = gats::TestApp::Baseline;
+
+	// column order differs from write_times(); the last column keeps its comma
+	istringstream good(
+		"case,budget_ns,cpu_ns,elapsed_ns,checked,passed,weight,group\r\n"
+		"first,0,1500,9000,1,1,1,{1} A, B\r\n"
+		"second,0,2000000,3000000,1,1,1,{1} A, B\r\n");
+	Baseline const read = gats::TestApp::read_baseline(good);
+	GATS_CHECK(read.badLines_m.empty());
+	GATS_CHECK_EQUAL(read.times_m.size(), 2u);
+	GATS_CHECK(read.times_m.at("first") == 1500ns);
+	GATS_CHECK(read.times_m.at("second") == 2ms);
+
+	// a file from before cpu_ns was kept is read on elapsed_ns
+	istringstream old(
+		"case,elapsed_ns,budget_ns,checked,passed,weight,group\n"
+		"only,42,0,1,1,1,g\n");
+	GATS_CHECK(gats::TestApp::read_baseline(old).times_m.at("only") == 42ns);
+
+	// hand-edited lines: a time that is not a number, a trailing unit, a negative time, an overflow, too few fields
+	istringstream bad(
+		"case,elapsed_ns,cpu_ns,budget_ns,checked,passed,weight,group\n"
+		"a,1,x,0,1,1,1,g\n"
+		"b,1,10ms,0,1,1,1,g\n"
+		"c,1,-5,0,1,1,1,g\n"
+		"d,1,99999999999999999999999,0,1,1,1,g\n"
+		"e,1\n"
+		"\n"
+		"f,1,7,0,1,1,1,g\n");
+	Baseline const skipped = gats::TestApp::read_baseline(bad);
+	GATS_CHECK(skipped.badLines_m == vector<size_t>({ 2, 3, 4, 5, 6 }));
+	GATS_CHECK_EQUAL(skipped.times_m.size(), 1u);
+	GATS_CHECK(skipped.times_m.at("f") == 7ns);
+
+	// no usable header: nothing is read
+	istringstream noHeader("name,seconds\nfirst,1\n");
+	Baseline const none = gats::TestApp::read_baseline(noHeader);
+	GATS_CHECK(none.times_m.empty());
+	GATS_CHECK(none.badLines_m == vector<size_t>({ 1 }));
+	istringstream empty;
+	GATS_CHECK(gats::TestApp::read_baseline(empty).badLines_m == vector<size_t>({ 1 }));
+#endif
+}
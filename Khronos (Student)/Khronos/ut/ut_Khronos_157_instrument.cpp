@@ -0,0 +1,94 @@
+/*	ut_Khronos_157_instrument.cpp
+
+	Khronos library hot-path instrumentation unit test.
+	The counts are checked in the Instrumented configuration, which defines
+	KHRONOS_INSTRUMENT and KHRONOS_INSTRUMENT_TIMING for the library and the tests.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <khronos/instrument.hpp>
+#include <sstream>
+#include <string>
+using namespace std;
+
+
+
+/** One Gregorian equality converts each date once; the probes count exactly those calls. */
+GATS_TEST_CASE(ut157_instrument_counts, UTILITY_GROUP, 1) {
+#if PHASE_157
+	using namespace khronos;
+
+#if defined(KHRONOS_INSTRUMENT)
+	using instrument::probe;
+
+	// this thread's own slots: cases running on other threads do not disturb them
+	auto const thread_totals = [] {
+		instrument::snapshot_type totals{};
+		for (size_t i = 0; i < instrument::PROBE_COUNT; ++i) {
+			auto const& slot = instrument::detail::this_thread_slot(probe(i));
+			totals[i] = { slot.calls.load(), slot.ticks.load() };
+		}
+		return totals;
+	};
+	auto const count_of = [](instrument::snapshot_type const& totals, probe p) { return totals[size_t(p)].calls; };
+
+	Gregorian const a(2024, 3, 1), b(2024, 3, 2);
+	auto const before = thread_totals();
+	bool const equal = a == b;
+	auto const after = thread_totals();
+	GATS_CHECK(!equal);
+
+	bool othersUntouched = true;
+	for (size_t i = 0; i < instrument::PROBE_COUNT; ++i) {
+		auto const calls = after[i].calls - before[i].calls;
+		switch (probe(i)) {
+		case probe::Gregorian_to_jd:
+		case probe::gregorian_to_jd_hms:
+		case probe::gregorian_to_jd:
+			GATS_CHECK_EQUAL(calls, 2u);
+			break;
+		default:
+			othersUntouched &= calls == 0;
+		}
+	}
+	GATS_CHECK(othersUntouched);
+
+	// Jd arithmetic is counted by the inline probes of the header
+	Jd jd(2'460'000.5);
+	auto const beforeArithmetic = thread_totals();
+	jd += 1.0_days;
+	jd += 12.0_hours;
+	GATS_CHECK_EQUAL(count_of(thread_totals(), probe::Jd_arithmetic) - count_of(beforeArithmetic, probe::Jd_arithmetic), 2u);
+	GATS_CHECK_EQUAL(jd.jd(), 2'460'002.0);
+
+	// every thread's counts are in the snapshot, and dump() names the probes hit
+	auto const totals = instrument::snapshot();
+	GATS_CHECK(count_of(totals, probe::Gregorian_to_jd) >= count_of(after, probe::Gregorian_to_jd));
+	GATS_CHECK_EQUAL(string(instrument::probe_name(probe::Gregorian_to_jd)), "Gregorian_to_jd");
+	ostringstream oss;
+	instrument::dump(oss, totals);
+	GATS_CHECK(oss.str().find("Gregorian_to_jd") != string::npos);
+
+#if defined(KHRONOS_INSTRUMENT_TIMING)
+	GATS_CHECK(after[size_t(probe::Gregorian_to_jd)].ticks > before[size_t(probe::Gregorian_to_jd)].ticks);
+#else
+	GATS_CHECK_EQUAL(after[size_t(probe::Gregorian_to_jd)].ticks, 0u);
+#endif
+
+#else
+	// without KHRONOS_INSTRUMENT a probe is an empty statement
+	KHRONOS_PROBE(Gregorian_to_jd);
+	GATS_CHECK(Gregorian(2024, 3, 1) != Gregorian(2024, 3, 2));
+#endif
+#endif
+}
@@ -0,0 +1,58 @@
+/*	ut_Khronos_158_perf_counters.cpp
+
+	gats test framework hardware counter sample unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <gats/PerfCounters.hpp>
+using namespace std;
+
+
+
+/** An interval's events are the raw difference, scaled by the share of the interval a multiplexed counter ran. */
+GATS_TEST_CASE(ut158_perf_counter_intervals, UTILITY_GROUP, 1) {
+#if PHASE_158
+	using gats::PerfCounters;
+	auto reading = [](uint64_t value, uint64_t enabled, uint64_t running) {
+		PerfCounters::Sample sample;
+		sample.values[PerfCounters::cycles] = value;
+		sample.enabled[PerfCounters::cycles] = enabled;
+		sample.running[PerfCounters::cycles] = running;
+		sample.valid[PerfCounters::cycles] = true;
+		return sample;
+	};
+
+	// counting throughout, then running half of the next interval
+	PerfCounters::Sample const first = reading(1'000, 100, 100), second = reading(1'500, 300, 200);
+	PerfCounters::Sample interval = second - first;
+	GATS_CHECK(interval.valid[PerfCounters::cycles]);
+	GATS_CHECK_EQUAL(interval.values[PerfCounters::cycles], 1'000u);
+	GATS_CHECK_EQUAL(interval.enabled[PerfCounters::cycles], 200u);
+	GATS_CHECK_EQUAL(interval.running[PerfCounters::cycles], 100u);
+
+	// the scaled totals fall (2000 to 1467), yet the interval's events do not wrap
+	interval = reading(1'100, 200, 150) - reading(1'000, 100, 50);
+	GATS_CHECK_EQUAL(interval.values[PerfCounters::cycles], 100u);
+
+	// an interval in which the counter never ran has no events
+	interval = reading(1'000, 400, 100) - reading(1'000, 300, 100);
+	GATS_CHECK_EQUAL(interval.values[PerfCounters::cycles], 0u);
+
+	// intervals add up; a counter missing from either read is not valid
+	interval += second - first;
+	GATS_CHECK_EQUAL(interval.values[PerfCounters::cycles], 1'000u);
+	GATS_CHECK_EQUAL(interval.enabled[PerfCounters::cycles], 300u);
+	GATS_CHECK(!(second - PerfCounters::Sample{}).valid[PerfCounters::cycles]);
+	GATS_CHECK(!(second - first).valid[PerfCounters::instructions]);
+#endif
+}
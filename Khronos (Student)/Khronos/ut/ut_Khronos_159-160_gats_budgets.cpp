@@ -0,0 +1,93 @@
+/*	ut_Khronos_159-160_gats_budgets.cpp
+
+	gats test framework budget enforcement and baseline comparison unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial Release
+
+
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	/** A case outside the suite that spins for 'work' of CPU time under 'budget'. */
+	class SpinCase : public gats::TestApp::TestCase {
+		chrono::nanoseconds work_m;
+	public:
+		SpinCase(chrono::nanoseconds work, chrono::nanoseconds budget) : TestCase("spin", budget, unlisted), work_m(work) {}
+		void execute() override {
+			auto const start = chrono::steady_clock::now();
+			volatile unsigned long long spins = 0;
+			while (chrono::steady_clock::now() - start < work_m)
+				spins = spins + 1;
+			GATS_CHECK(spins > 0u);
+		}
+	};
+}
+
+
+
+/** A budgeted case that uses more CPU time than its budget fails; one within its budget passes. */
+GATS_TEST_CASE(ut159_budget_fails_slow_case, UTILITY_GROUP, 1) {
+#if PHASE_159
+	using namespace std::chrono_literals;
+
+	SpinCase slow(200ms, 20ms);
+	gats::TestApp::run_case(slow);
+	GATS_CHECK_EQUAL(slow.checked(), 2u);
+	GATS_CHECK_EQUAL(slow.passed(), 1u);
+	GATS_CHECK(slow.reports().find("CPU time budget exceeded") != string::npos);
+
+	SpinCase quick(1ms, 1s);
+	gats::TestApp::run_case(quick);
+	GATS_CHECK_EQUAL(quick.checked(), 1u);
+	GATS_CHECK_EQUAL(quick.passed(), 1u);
+	GATS_CHECK(quick.reports().empty());
+
+	// a case without a budget is never charged
+	SpinCase unlimited(30ms, 0ns);
+	gats::TestApp::run_case(unlimited);
+	GATS_CHECK_EQUAL(unlimited.checked(), 1u);
+#endif
+}
+
+
+
+/** A case slower than its baseline by more than the threshold is flagged; one within it, or too quick to time, is not. */
+GATS_TEST_CASE(ut160_baseline_flags_slowdowns, UTILITY_GROUP, 1) {
+#if PHASE_160
+	using namespace std::chrono_literals;
+
+	map<string, chrono::nanoseconds> const baseline = {
+		{ "regressed", 10ms }, { "within", 10ms }, { "faster", 10ms }, { "noise", 100us } };
+	vector<pair<string, chrono::nanoseconds>> const times = {
+		{ "faster", 5ms }, { "regressed", 14ms }, { "within", 12ms }, { "noise", 1ms }, { "new", 50ms } };
+
+	auto const comparison = gats::TestApp::compare_times(baseline, times, 25.0);
+	GATS_CHECK_EQUAL(comparison.nCompared_m, 3u);
+	GATS_CHECK_EQUAL(comparison.slower_m.size(), 1u);
+	GATS_CHECK_EQUAL(comparison.slower_m[0].name_m, "regressed");
+	GATS_CHECK(comparison.slower_m[0].baseline_m == 10ms && comparison.slower_m[0].time_m == 14ms);
+	GATS_CHECK_WITHIN(comparison.slower_m[0].percent_m, 40.0, 1e-9);
+
+	// a tighter threshold flags the smaller slowdown too, in the order of the times
+	auto const strict = gats::TestApp::compare_times(baseline, times, 10.0);
+	GATS_CHECK_EQUAL(strict.slower_m.size(), 2u);
+	GATS_CHECK_EQUAL(strict.slower_m[0].name_m, "regressed");
+	GATS_CHECK_EQUAL(strict.slower_m[1].name_m, "within");
+#endif
+}
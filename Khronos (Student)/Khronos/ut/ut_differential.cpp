@@ -0,0 +1,315 @@
+/** @file ut_differential.cpp
+	@date 2026-10-18
+	@brief Differential checks of the Khronos conversions against the reference algorithms.
+	*/
+
+#include "ut_differential.hpp"
+#include <khronos.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+using namespace std;
+using namespace khronos;
+
+
+namespace differential {
+
+	namespace {
+		using reference::calendar;
+
+		/** The library's conversions for one calendar. */
+		struct conversions {
+			jd_t (*to_jd)(year_t, month_t, day_t);
+			jd_t (*to_jd_hms)(year_t, month_t, day_t, hour_t, minute_t, second_t);
+			void (*from_jd)(jd_t, year_t&, month_t&, day_t&);
+			void (*from_jd_hms)(jd_t, year_t&, month_t&, day_t&, hour_t&, minute_t&, second_t&);
+		};
+
+		conversions const& library(calendar cal) {
+			static conversions const table[reference::calendar_count] = {
+				{ gregorian_to_jd, gregorian_to_jd, jd_to_gregorian, jd_to_gregorian },
+				{ julian_to_jd, julian_to_jd, jd_to_julian, jd_to_julian },
+				{ islamic_to_jd, islamic_to_jd, jd_to_islamic, jd_to_islamic },
+				{ hebrew_to_jd, hebrew_to_jd, jd_to_hebrew, jd_to_hebrew },
+				{ vulcan_to_jd, vulcan_to_jd, jd_to_vulcan, jd_to_vulcan },
+			};
+			return table[static_cast<int>(cal)];
+		}
+
+		long long floored_mod(long long a, long long b) {
+			long long r = a % b;
+			return r < 0 ? r + b : r;
+		}
+
+		/** The sample's date: its month and day reduced onto the months of the year and the days of the month. */
+		reference::date valid_date(calendar cal, sample const& s) {
+			month_t const month = month_t(1 + floored_mod(s.month - 1, reference::months_in_year(cal, s.year)));
+			day_t const day = day_t(1 + floored_mod(s.day - 1, reference::days_in_month(cal, s.year, month)));
+			return { s.year, month, day };
+		}
+
+		/** Tolerance of a JD computed in double: a few units in the last place. */
+		double jd_tolerance(jd_t jd) {
+			return 8 * numeric_limits<double>::epsilon() * std::max(1.0, std::abs(jd));
+		}
+
+		/** A date that exists only in leap years. */
+		bool is_intercalary(calendar cal, reference::date const& d) {
+			switch (cal) {
+			case calendar::gregorian:
+			case calendar::julian:	return d.month == 2 && d.day == 29;
+			case calendar::islamic:	return d.month == 12 && d.day == 30;
+			case calendar::hebrew:	return d.month == 13;
+			case calendar::vulcan:	return d.month == 12 && d.day == 22;
+			}
+			return false;
+		}
+
+		string describe(calendar cal, reference::date const& d) {
+			ostringstream oss;
+			oss << reference::calendar_name(cal) << ' ' << d.year << '-' << d.month << '-' << d.day;
+			return oss.str();
+		}
+
+		string describe(double value) {
+			ostringstream oss;
+			oss << fixed << setprecision(9) << value;
+			return oss.str();
+		}
+
+		/** Reads fuzzer bytes in order; reads past the end give zero. */
+		class byte_reader {
+			uint8_t const*	data_m;
+			size_t			size_m;
+		public:
+			byte_reader(uint8_t const* data, size_t size) : data_m(data), size_m(size) {}
+
+			uint64_t next(int nBytes) {
+				uint64_t value = 0;
+				for (int i = 0; i < nBytes; ++i) {
+					value = value << 8 | (size_m ? *data_m : 0u);
+					if (size_m) { ++data_m; --size_m; }
+				}
+				return value;
+			}
+
+			/** A value in [lo, hi]. */
+			long long in_range(long long lo, long long hi, int nBytes) {
+				return lo + static_cast<long long>(next(nBytes) % static_cast<uint64_t>(hi - lo + 1));
+			}
+		};
+	}
+
+
+
+	char const* feature_name(feature f) {
+		constexpr char const* names[feature_count] = {
+			"year before 1", "distant year", "leap year", "common year", "new year's day",
+			"last day of month", "intercalary day", "midnight", "clamped day"
+		};
+		return names[f];
+	}
+
+
+
+	coverage& coverage::operator += (coverage const& rhs) {
+		for (size_t c = 0; c < hits.size(); ++c)
+			for (size_t f = 0; f < hits[c].size(); ++f)
+				hits[c][f] += rhs.hits[c][f];
+		return *this;
+	}
+
+
+
+	year_t min_year(calendar cal) { return cal == calendar::gregorian ? -30'000 : -99'999; }
+	year_t max_year(calendar cal) { return cal == calendar::gregorian ? 30'000 : 99'999; }
+
+
+
+	sample generate(mt19937_64& rng, calendar cal) {
+		auto uniform = [&rng](long long lo, long long hi) { return uniform_int_distribution<long long>(lo, hi)(rng); };
+
+		sample s{};
+		s.calendar = cal;
+		switch (uniform(0, 3)) {
+		case 0:		s.year = uniform(-3'000, 3'000); break;
+		case 1:		s.year = uniform(-10, 10); break;
+		default:	s.year = uniform(min_year(cal), max_year(cal)); break;
+		}
+
+		// 0 reduces to the last month or day
+		s.month = uniform(0, 13);
+		switch (uniform(0, 3)) {
+		case 0:		s.day = 0; break;
+		case 1:		s.day = 1; break;
+		default:	s.day = uniform(1, 31); break;
+		}
+
+		if (uniform(0, 1) == 0)
+			s.dayNumber = reference::new_year(cal, s.year) + uniform(-40, 40);
+		else
+			s.dayNumber = uniform(reference::new_year(cal, min_year(cal)), reference::new_year(cal, max_year(cal) + 1) - 1);
+
+		switch (uniform(0, 9)) {
+		case 0:		s.secondOfDay = 0; break;
+		case 1:		s.secondOfDay = 86'399; break;
+		default:	s.secondOfDay = int(uniform(0, 86'399)); break;
+		}
+		s.millisecond = uniform(0, 1) ? int(uniform(0, 499)) : 0;
+
+		s.monthDelta = int(uniform(0, 1) ? uniform(-30, 30) : uniform(-24'000, 24'000));
+		s.yearDelta = int(uniform(0, 1) ? uniform(-8, 8) : uniform(-2'000, 2'000));
+		return s;
+	}
+
+
+
+	sample decode(uint8_t const* data, size_t size) {
+		byte_reader bytes(data, size);
+		sample s{};
+		s.calendar = static_cast<calendar>(bytes.in_range(0, reference::calendar_count - 1, 1));
+		s.year = bytes.in_range(min_year(s.calendar), max_year(s.calendar), 4);
+		s.month = bytes.in_range(0, 255, 1);
+		s.day = bytes.in_range(0, 255, 1);
+		s.dayNumber = bytes.in_range(reference::new_year(s.calendar, min_year(s.calendar)), reference::new_year(s.calendar, max_year(s.calendar) + 1) - 1, 4);
+		s.secondOfDay = int(bytes.in_range(0, 86'399, 4));
+		s.millisecond = int(bytes.in_range(0, 499, 2));
+		s.monthDelta = int(bytes.in_range(-24'000, 24'000, 2));
+		s.yearDelta = int(bytes.in_range(-2'000, 2'000, 2));
+		return s;
+	}
+
+
+
+	string check_conversion(sample const& s, coverage& cov) {
+		auto const cal = s.calendar;
+		auto const& lib = library(cal);
+
+		// the date
+		auto const date = valid_date(cal, s);
+		auto const [year, month, day] = date;
+
+		if (year < 1) cov.hit(cal, year_before_1);
+		if (std::abs(year) > 10'000) cov.hit(cal, distant_year);
+		cov.hit(cal, reference::is_leap_year(cal, year) ? leap_year : common_year);
+		if (day == reference::days_in_month(cal, year, month)) cov.hit(cal, last_day_of_month);
+		if (is_intercalary(cal, date)) cov.hit(cal, intercalary_day);
+
+		auto const dn = reference::to_day_number(cal, date);
+		jd_t const jd = lib.to_jd(year, month, day);
+		if (jd != dn - 0.5)
+			return describe(cal, date) + ": to_jd " + describe(jd) + " != reference " + describe(dn - 0.5);
+
+		// the date and time of day, there and back
+		hour_t const hour = s.secondOfDay / 3600;
+		minute_t const minute = s.secondOfDay / 60 % 60;
+		second_t const second = s.secondOfDay % 60 + s.millisecond / 1000.0;
+		double const seconds = s.secondOfDay + s.millisecond / 1000.0;
+		if (seconds == 0.0) cov.hit(cal, midnight);
+
+		jd_t const jdTime = lib.to_jd_hms(year, month, day, hour, minute, second);
+		double const tolerance = jd_tolerance(jdTime);
+		if (std::abs(jdTime - (dn - 0.5 + seconds / 86'400.0)) > tolerance)
+			return describe(cal, date) + " " + describe(seconds) + " s: to_jd " + describe(jdTime)
+				+ " != reference " + describe(dn - 0.5 + seconds / 86'400.0);
+
+		year_t y;
+		month_t m;
+		day_t d;
+		hour_t h;
+		minute_t mi;
+		second_t sec;
+		lib.from_jd_hms(jdTime, y, m, d, h, mi, sec);
+		if (reference::date{ y, m, d } != date)
+			return describe(cal, date) + " " + describe(seconds) + " s: from_jd(" + describe(jdTime) + ") gave " + describe(cal, { y, m, d });
+		double const secondsBack = h * 3600.0 + mi * 60.0 + sec;
+		if (std::abs(secondsBack - seconds) > tolerance * 86'400.0 + 1e-6)
+			return describe(cal, date) + " " + describe(seconds) + " s: from_jd(" + describe(jdTime) + ") gave " + describe(secondsBack) + " s";
+
+		// the day number, at some time of that day
+		auto const expected = reference::from_day_number(cal, s.dayNumber);
+		if (s.dayNumber == reference::new_year(cal, expected.year)) cov.hit(cal, new_year_day);
+		lib.from_jd(s.dayNumber - 0.5 + s.secondOfDay / 86'400.0, y, m, d);
+		if (reference::date{ y, m, d } != expected)
+			return string(reference::calendar_name(cal)) + " from_jd(" + describe(s.dayNumber - 0.5 + s.secondOfDay / 86'400.0) + ") gave "
+				+ describe(cal, { y, m, d }) + " != reference " + describe(cal, expected);
+
+		return {};
+	}
+
+
+
+	namespace {
+		/** Month arithmetic of the calendar class against the reference. */
+		template <typename Calendar>
+		string check_month_arithmetic(sample const& s, coverage& cov) {
+			auto const cal = s.calendar;
+			auto const start = valid_date(cal, s);
+			auto const expected = reference::add_months(cal, start, s.monthDelta);
+			if (expected.day != start.day) cov.hit(cal, clamped_day);
+
+			Calendar date(start.year, start.month, start.day);
+			date += detail::packaged_month_integer(s.monthDelta);
+			if (reference::date{ date.year(), date.month(), date.day() } != expected)
+				return describe(cal, start) + " + " + to_string(s.monthDelta) + " months gave "
+					+ describe(cal, { date.year(), date.month(), date.day() }) + " != reference " + describe(cal, expected);
+			return {};
+		}
+	}
+
+
+
+	string check_arithmetic(sample const& s, coverage& cov) {
+		switch (s.calendar) {
+		case calendar::gregorian:	break;
+		case calendar::julian:		return check_month_arithmetic<Julian>(s, cov);
+		case calendar::islamic:		return check_month_arithmetic<Islamic>(s, cov);
+		case calendar::hebrew:		return check_month_arithmetic<Hebrew>(s, cov);
+		case calendar::vulcan:		return check_month_arithmetic<Vulcan>(s, cov);
+		}
+
+		auto const [year, month, day] = valid_date(calendar::gregorian, s);
+		chrono::year_month_day const start{ chrono::year{ int(year) }, chrono::month{ unsigned(month) }, chrono::day{ unsigned(day) } };
+
+		// std::chrono leaves the day alone; the library clamps it to the end of the month
+		auto clamp = [](chrono::year_month_day ymd) {
+			return ymd.ok() ? ymd : chrono::year_month_day{ chrono::year_month_day_last{ ymd.year(), chrono::month_day_last{ ymd.month() } } };
+		};
+		auto matches = [](Gregorian const& g, chrono::year_month_day ymd) {
+			return g.year() == int(ymd.year()) && g.month() == month_t(unsigned(ymd.month())) && g.day() == day_t(unsigned(ymd.day()));
+		};
+
+		auto const byMonths = start + chrono::months(s.monthDelta);
+		if (!byMonths.ok()) cov.hit(calendar::gregorian, clamped_day);
+		Gregorian g(year, month, day);
+		g += detail::packaged_month_integer(s.monthDelta);
+		if (!matches(g, clamp(byMonths)))
+			return describe(calendar::gregorian, { year, month, day }) + " + " + to_string(s.monthDelta) + " months gave "
+				+ describe(calendar::gregorian, { g.year(), g.month(), g.day() });
+
+		auto const byYears = start + chrono::years(s.yearDelta);
+		if (!byYears.ok()) cov.hit(calendar::gregorian, clamped_day);
+		g = Gregorian(year, month, day);
+		g += detail::packaged_year_real(s.yearDelta);
+		if (!matches(g, clamp(byYears)))
+			return describe(calendar::gregorian, { year, month, day }) + " + " + to_string(s.yearDelta) + " years gave "
+				+ describe(calendar::gregorian, { g.year(), g.month(), g.day() });
+
+		return {};
+	}
+
+} // end-of-namespace differential
+
+
+
+/*============================================================================
+
+Revision History
+
+Version 2026.10.18
+	Initial release.
+
+============================================================================*/
@@ -0,0 +1,88 @@
+#pragma once
+
+/** @file ut_differential.hpp
+	@date 2026-10-18
+	@brief Differential checks of the Khronos conversions against the reference algorithms.
+
+	A sample is one input: a calendar, a date, a day number, a time of day
+	and month/year offsets.  The same checks run on random samples in the
+	unit tests (ut_Khronos_120-122_differential.cpp) and on fuzzer input
+	(fuzz/fuzz_Khronos.cpp).  A check returns an empty string on success or
+	a description of the first mismatch that reproduces it.
+	*/
+
+#include "ut_reference.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+
+namespace differential {
+
+	/** One input; the month and day are reduced onto the months of the year and days of the month. */
+	struct sample {
+		reference::calendar			calendar;
+		khronos::year_t				year;
+		long long					month;
+		long long					day;
+		reference::day_number_t		dayNumber;
+		int							secondOfDay;	// [0, 86400)
+		int							millisecond;	// [0, 500)
+		int							monthDelta;
+		int							yearDelta;
+	};
+
+	/** Features of the input space a check has exercised. */
+	enum feature {
+		year_before_1,
+		distant_year,
+		leap_year,
+		common_year,
+		new_year_day,
+		last_day_of_month,
+		intercalary_day,
+		midnight,
+		clamped_day,
+		feature_count
+	};
+
+	char const* feature_name(feature f);
+
+	/** Coverage counters, per calendar and feature. */
+	struct coverage {
+		std::array<std::array<std::uint64_t, feature_count>, reference::calendar_count> hits{};
+
+		void hit(reference::calendar cal, feature f) { ++hits[static_cast<int>(cal)][f]; }
+		coverage& operator += (coverage const& rhs);
+	};
+
+	/** Years a calendar's samples are drawn from; the Gregorian range is that of std::chrono. */
+	khronos::year_t min_year(reference::calendar cal);
+	khronos::year_t max_year(reference::calendar cal);
+
+	/** A random sample, weighted towards the modern era and the ends of months and years. */
+	sample generate(std::mt19937_64& rng, reference::calendar cal);
+
+	/** A sample decoded from fuzzer bytes; missing bytes read as zero. */
+	sample decode(std::uint8_t const* data, std::size_t size);
+
+	/** to_jd and from_jd, with and without the time of day, against the reference. */
+	std::string check_conversion(sample const& s, coverage& cov);
+
+	/** Month arithmetic against the reference; Gregorian month and whole-year arithmetic against std::chrono. */
+	std::string check_arithmetic(sample const& s, coverage& cov);
+
+} // end-of-namespace differential
+
+
+
+/*============================================================================
+
+Revision History
+
+Version 2026.10.18
+	Initial release.
+
+============================================================================*/
@@ -0,0 +1,274 @@
+/** @file ut_reference.cpp
+	@date 2026-10-18
+	@brief Reference calendar algorithms for the differential tests.
+	*/
+
+#include "ut_reference.hpp"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+using namespace std;
+
+
+namespace reference {
+
+	namespace {
+		using khronos::year_t;
+		using khronos::month_t;
+		using khronos::day_t;
+
+		constexpr day_number_t UNIX_EPOCH_DAY = 2'440'588;		// 1970-01-01
+		constexpr day_number_t JULIAN_NEW_YEAR_1 = 1'721'424;	// 1 January 1 AD (Julian)
+		constexpr day_number_t ISLAMIC_NEW_YEAR_1 = 1'948'440;	// 1 Muharram 1 AH
+		constexpr day_number_t HEBREW_DAY_0 = 347'997;			// the day before 1 Tishri 1 AM
+		constexpr day_number_t VULCAN_NEW_YEAR_1 = 1'723'763;	// 1 Z'at 1
+
+		long long floored_div(long long a, long long b) { return a / b - (a % b != 0 && (a < 0) != (b < 0)); }
+		long long floored_mod(long long a, long long b) { return a - b * floored_div(a, b); }
+
+		chrono::sys_days gregorian_day(year_t year, month_t month, day_t day) {
+			return chrono::sys_days{ chrono::year_month_day{ chrono::year{ int(year) }, chrono::month{ unsigned(month) }, chrono::day{ unsigned(day) } } };
+		}
+
+		// Julian: a leap day every fourth year
+		bool julian_leap(year_t year) { return floored_mod(year, 4) == 0; }
+
+		day_number_t julian_new_year(year_t year) {
+			day_number_t dn = JULIAN_NEW_YEAR_1;
+			long long cycles = floored_div(year - 1, 4);		// whole 1461-day cycles since 1 AD
+			dn += cycles * 1461;
+			for (year_t y = 1 + 4 * cycles; y < year; ++y)
+				dn += julian_leap(y) ? 366 : 365;
+			return dn;
+		}
+
+		// Islamic: 11 leap years in each 30-year cycle
+		constexpr int islamicLeapYears[] = { 2, 5, 7, 10, 13, 16, 18, 21, 24, 26, 29 };
+
+		bool islamic_leap(year_t year) {
+			auto const inCycle = floored_mod(year - 1, 30) + 1;
+			for (int leap : islamicLeapYears)
+				if (inCycle == leap)
+					return true;
+			return false;
+		}
+
+		day_number_t islamic_new_year(year_t year) {
+			day_number_t dn = ISLAMIC_NEW_YEAR_1;
+			long long cycles = floored_div(year - 1, 30);		// whole 10631-day cycles since 1 AH
+			dn += cycles * 10631;
+			for (year_t y = 1 + 30 * cycles; y < year; ++y)
+				dn += islamic_leap(y) ? 355 : 354;
+			return dn;
+		}
+
+		// Hebrew: the molad of Tishri, then the four postponements (dehiyyot)
+		bool hebrew_leap(year_t year) { return floored_mod(7 * year + 1, 19) < 7; }
+
+		day_number_t hebrew_new_year(year_t year) {
+			long long months = floored_div(235 * year - 234, 19);		// lunations since the molad of Tishri 1 AM
+			long long partsElapsed = 204 + 793 * months;				// 1080 parts per hour
+			long long hoursElapsed = 5 + 12 * months + floored_div(partsElapsed, 1080);
+			long long day = 1 + 29 * months + floored_div(hoursElapsed, 24);
+			long long parts = 1080 * floored_mod(hoursElapsed, 24) + floored_mod(partsElapsed, 1080);
+			auto weekday = [](long long d) { return floored_mod(d, 7); };		// 0 = Sunday
+
+			if (parts >= 19440															// molad zaken: molad at or after noon
+				|| (weekday(day) == 2 && parts >= 9924 && !hebrew_leap(year))			// GaTaRaD
+				|| (weekday(day) == 1 && parts >= 16789 && hebrew_leap(year - 1)))		// BeTUTaKPaT
+				++day;
+			if (weekday(day) == 0 || weekday(day) == 3 || weekday(day) == 5)			// lo ADU Rosh
+				++day;
+			return HEBREW_DAY_0 + day;
+		}
+
+		// Vulcan: 12 months of 21 days, a leap day closing every fourth year
+		bool vulcan_leap(year_t year) { return floored_mod(year, 4) == 0; }
+
+		day_number_t vulcan_new_year(year_t year) {
+			long long cycles = floored_div(year - 1, 4);		// whole 1009-day cycles since year 1
+			return VULCAN_NEW_YEAR_1 + cycles * 1009 + (year - 1 - 4 * cycles) * 252;
+		}
+
+		double mean_year(calendar cal) {
+			switch (cal) {
+			case calendar::gregorian:	return 365.2425;
+			case calendar::julian:		return 365.25;
+			case calendar::islamic:		return 10631.0 / 30.0;
+			case calendar::hebrew:		return 35975351.0 / 98496.0;
+			case calendar::vulcan:		return 252.25;
+			}
+			return 365.0;
+		}
+
+		/** The month following 'month' in the order of the year, 0 after the last. */
+		month_t next_month(calendar cal, year_t year, month_t month) {
+			if (cal == calendar::hebrew) {
+				if (month == 6)
+					return 0;
+				return month == months_in_year(cal, year) ? 1 : month + 1;
+			}
+			return month == months_in_year(cal, year) ? 0 : month + 1;
+		}
+
+		month_t first_month(calendar cal) { return cal == calendar::hebrew ? 7 : 1; }
+
+		/** Position of the month in the order of the year, from 0. */
+		int month_position(calendar cal, year_t year, month_t month) {
+			int position = 0;
+			for (month_t m = first_month(cal); m != month; m = next_month(cal, year, m))
+				++position;
+			return position;
+		}
+
+		month_t month_at(calendar cal, year_t year, long long position) {
+			month_t m = first_month(cal);
+			while (position-- > 0)
+				m = next_month(cal, year, m);
+			return m;
+		}
+	}
+
+
+
+	char const* calendar_name(calendar cal) {
+		constexpr char const* names[calendar_count] = { "Gregorian", "Julian", "Islamic", "Hebrew", "Vulcan" };
+		return names[static_cast<int>(cal)];
+	}
+
+
+
+	int months_in_year(calendar cal, year_t year) {
+		return cal == calendar::hebrew && hebrew_leap(year) ? 13 : 12;
+	}
+
+
+
+	bool is_leap_year(calendar cal, year_t year) {
+		switch (cal) {
+		case calendar::gregorian:	return chrono::year{ int(year) }.is_leap();
+		case calendar::julian:		return julian_leap(year);
+		case calendar::islamic:		return islamic_leap(year);
+		case calendar::hebrew:		return hebrew_leap(year);
+		case calendar::vulcan:		return vulcan_leap(year);
+		}
+		return false;
+	}
+
+
+
+	int days_in_month(calendar cal, year_t year, month_t month) {
+		assert(month >= 1 && month <= months_in_year(cal, year));
+		switch (cal) {
+		case calendar::gregorian:
+			return int(unsigned(chrono::year_month_day_last{ chrono::year{ int(year) }, chrono::month_day_last{ chrono::month{ unsigned(month) } } }.day()));
+
+		case calendar::julian: {
+			constexpr int days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+			return month == 2 && julian_leap(year) ? 29 : days[month - 1];
+		}
+
+		case calendar::islamic:
+			if (month == 12)
+				return islamic_leap(year) ? 30 : 29;
+			return month % 2 == 1 ? 30 : 29;
+
+		case calendar::hebrew: {
+			auto const yearLength = new_year(cal, year + 1) - new_year(cal, year);
+			switch (month) {
+			case 2: case 4: case 6: case 10: case 13:
+				return 29;
+			case 8:		// Cheshvan is long in a complete year
+				return yearLength % 10 == 5 ? 30 : 29;
+			case 9:		// Kislev is short in a deficient year
+				return yearLength % 10 == 3 ? 29 : 30;
+			case 12:	// Adar (Adar I in a leap year)
+				return hebrew_leap(year) ? 30 : 29;
+			default:
+				return 30;
+			}
+		}
+
+		case calendar::vulcan:
+			return month == 12 && vulcan_leap(year) ? 22 : 21;
+		}
+		return 0;
+	}
+
+
+
+	day_number_t new_year(calendar cal, year_t year) {
+		switch (cal) {
+		case calendar::gregorian:	return gregorian_day(year, 1, 1).time_since_epoch().count() + UNIX_EPOCH_DAY;
+		case calendar::julian:		return julian_new_year(year);
+		case calendar::islamic:		return islamic_new_year(year);
+		case calendar::hebrew:		return hebrew_new_year(year);
+		case calendar::vulcan:		return vulcan_new_year(year);
+		}
+		return 0;
+	}
+
+
+
+	day_number_t to_day_number(calendar cal, date const& d) {
+		if (cal == calendar::gregorian)
+			return gregorian_day(d.year, d.month, d.day).time_since_epoch().count() + UNIX_EPOCH_DAY;
+
+		day_number_t dn = new_year(cal, d.year);
+		for (month_t m = first_month(cal); m != d.month; m = next_month(cal, d.year, m)) {
+			assert(m != 0);
+			dn += days_in_month(cal, d.year, m);
+		}
+		return dn + d.day - 1;
+	}
+
+
+
+	date from_day_number(calendar cal, day_number_t dn) {
+		if (cal == calendar::gregorian) {
+			chrono::year_month_day ymd{ chrono::sys_days{ chrono::days{ dn - UNIX_EPOCH_DAY } } };
+			return { int(ymd.year()), month_t(unsigned(ymd.month())), day_t(unsigned(ymd.day())) };
+		}
+
+		year_t year = static_cast<year_t>(std::floor(double(dn - new_year(cal, 1)) / mean_year(cal))) + 1;
+		while (new_year(cal, year) > dn)
+			--year;
+		while (new_year(cal, year + 1) <= dn)
+			++year;
+
+		auto dayOfYear = dn - new_year(cal, year);
+		month_t month = first_month(cal);
+		while (dayOfYear >= days_in_month(cal, year, month)) {
+			dayOfYear -= days_in_month(cal, year, month);
+			month = next_month(cal, year, month);
+		}
+		return { year, month, day_t(dayOfYear + 1) };
+	}
+
+
+
+	date add_months(calendar cal, date const& d, long long n) {
+		year_t year = d.year;
+		long long position = month_position(cal, year, d.month) + n;
+		while (position >= months_in_year(cal, year))
+			position -= months_in_year(cal, year++);
+		while (position < 0)
+			position += months_in_year(cal, --year);
+
+		month_t const month = month_at(cal, year, position);
+		return { year, month, std::min(d.day, day_t(days_in_month(cal, year, month))) };
+	}
+
+} // end-of-namespace reference
+
+
+
+/*============================================================================
+
+Revision History
+
+Version 2026.10.18
+	Initial release.
+
+============================================================================*/
@@ -0,0 +1,66 @@
+#pragma once
+
+/** @file ut_reference.hpp
+	@date 2026-10-18
+	@brief Reference calendar algorithms for the differential tests.
+
+	Written independently of the library: each calendar is defined by the day
+	number of its new year and its month lengths, and dates are found by
+	counting months from there.  Day numbers are whole days (JD + 0.5 at
+	midnight).  The Gregorian calendar is delegated to std::chrono, which
+	limits it to years [-32767, 32767].
+	*/
+
+#include <khronos/def.hpp>
+
+
+namespace reference {
+
+	using day_number_t = long long;
+
+	enum class calendar { gregorian, julian, islamic, hebrew, vulcan };
+	constexpr int calendar_count = 5;
+
+	struct date {
+		khronos::year_t		year;
+		khronos::month_t	month;
+		khronos::day_t		day;
+
+		bool operator == (date const&) const = default;
+	};
+
+	char const* calendar_name(calendar cal);
+
+	/** Months in the given year. */
+	int months_in_year(calendar cal, khronos::year_t year);
+
+	/** Days in the given month. */
+	int days_in_month(calendar cal, khronos::year_t year, khronos::month_t month);
+
+	/** Day number of the first day of the year. */
+	day_number_t new_year(calendar cal, khronos::year_t year);
+
+	/** Is the given year a leap year (a leap day or a leap month). */
+	bool is_leap_year(calendar cal, khronos::year_t year);
+
+	/** Day number of a valid date. */
+	day_number_t to_day_number(calendar cal, date const& d);
+
+	/** Date of a day number. */
+	date from_day_number(calendar cal, day_number_t dn);
+
+	/** The date 'n' months on in the order of the year, its day clamped to the end of the month. */
+	date add_months(calendar cal, date const& d, long long n);
+
+} // end-of-namespace reference
+
+
+
+/*============================================================================
+
+Revision History
+
+Version 2026.10.18
+	Initial release.
+
+============================================================================*/
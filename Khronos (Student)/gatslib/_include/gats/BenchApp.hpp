@@ -0,0 +1,181 @@
+#pragma once
+/*!	\file		gats/BenchApp.hpp
+	\brief		BenchApp micro-benchmark framework declarations.
+	\date		2026-10-18
+
+=============================================================
+BenchApp framework declarations.
+	BenchApp class declaration.
+	BenchApp::State class declaration.
+	BenchApp::Benchmark class declaration.
+	gats::do_not_optimize()
+	GATS_BENCHMARK()
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial release.
+
+=============================================================*/
+
+
+#include <gats/ConsoleApp.hpp>
+#include <gats/PerfCounters.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace gats {
+
+	namespace detail {
+		extern void const volatile* volatile optimizerSink_g;
+	}
+
+	/*!	Prevents the optimizer from discarding the computation of 'value'. */
+	template <typename T>
+	inline void do_not_optimize(T const& value) {
+		detail::optimizerSink_g = &value;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+	}
+
+
+
+	/*!	\brief class BenchApp
+
+		BenchApp singleton class runs the registered benchmarks and reports
+		ns/op, ops/s and allocations/op to the console and to a JSON file.
+
+		Command line:
+			--filter=text		run only benchmarks whose name contains 'text'
+			--min-time=ms		minimum measured time per repetition (default 100)
+			--repetitions=N		repetitions per benchmark, the medians of ns/op and allocations/op are reported (default 3)
+			--json=file			results file (default gats-bench-results.json)
+			--perf				also report IPC and hardware events per operation
+	*/
+	class BenchApp : public ConsoleApp {
+	// TYPES
+	public:
+		using clock_type = std::chrono::steady_clock;
+
+		/*!	\brief class BenchApp::State
+
+			Passed to each benchmark.  The measured region is the benchmark's
+			range-for loop over the state:
+
+				for ([[maybe_unused]] auto _ : state) { ... }
+		*/
+		class State {
+		// ATTRIBUTES
+			std::uint64_t				iterations_m;
+			std::uint64_t				itemsPerIteration_m = 1;
+			clock_type::time_point		start_m{};
+			clock_type::duration		elapsed_m{};
+			std::uint64_t				allocationsAtStart_m = 0;
+			std::uint64_t				allocations_m = 0;
+			bool						perf_m = false;
+			PerfCounters::Sample		countersAtStart_m;
+			PerfCounters::Sample		counters_m;
+
+		public:
+			/*!	Counts down the iterations; reaching the end stops the measurement. */
+			class iterator {
+				State*			state_m;
+				std::uint64_t	remaining_m;
+			public:
+				iterator(State* state, std::uint64_t remaining) : state_m(state), remaining_m(remaining) {}
+				int operator * () const { return 0; }
+				iterator& operator ++ () { --remaining_m; return *this; }
+				bool operator != (iterator const&) {
+					if (remaining_m != 0)
+						return true;
+					state_m->stop();
+					return false;
+				}
+			};
+
+		// OPERATIONS
+			explicit State(std::uint64_t iterations) : iterations_m(iterations) {}
+
+			iterator begin() { start(); return iterator(this, iterations_m); }
+			iterator end() { return iterator(this, 0); }
+
+			std::uint64_t iterations() const { return iterations_m; }
+
+			/*!	Declares how many operations one loop iteration performs (e.g. one per element of a batch). */
+			void set_items_per_iteration(std::uint64_t items) { itemsPerIteration_m = items; }
+
+		private:
+			void start();
+			void stop();
+			friend class BenchApp;
+		};
+
+
+
+		/*!	\brief class BenchApp::Benchmark
+
+			Benchmark is the base type of classes generated by GATS_BENCHMARK(). */
+		class Benchmark {
+		// ATTRIBUTES
+			std::string		name_m;
+			std::string		group_m;
+
+		// OPERATIONS
+		public:
+			// Blocked
+			Benchmark(Benchmark const&) = delete;
+			void operator = (Benchmark const&) = delete;
+
+			Benchmark(std::string const& name, std::string const& group);
+			virtual ~Benchmark() = default;
+
+			virtual void run(State& state) = 0;
+
+			friend class BenchApp;
+		};
+
+	// ATTRIBUTES
+	private:
+		using benchmark_list_type = std::vector<Benchmark*>;
+
+		static std::unique_ptr<benchmark_list_type>	benchmarksPtr_sm;
+
+	// OPERATIONS
+		static benchmark_list_type& benchmarks();
+
+		// Interface
+		int execute() override;
+
+	public:
+		/*!	Registers a benchmark implemented by a callable; returns true for use in static initializers. */
+		static bool add(std::string const& name, std::string const& group, std::function<void(State&)> body);
+
+		/*!	Number of global operator new calls so far. */
+		static std::uint64_t allocation_count();
+	};
+
+} // end-of-namespace gats
+
+
+
+/*!	Creates a benchmark with the identifier 'name'
+
+	\param 'name' is the benchmark's identifier.
+	\param 'group' is the group the benchmark is reported in.
+
+	The body receives 'state'; its range-for loop over 'state' is the measured region.
+*/
+#define GATS_BENCHMARK(name, group) \
+	static class Benchmark_ ## name : public gats::BenchApp::Benchmark {\
+	public: Benchmark_ ## name() : Benchmark(#name, group) { }\
+	public: virtual void run(gats::BenchApp::State& state) override;\
+	} Benchmark_ ## name ## _g;\
+	void Benchmark_ ## name :: run([[maybe_unused]] gats::BenchApp::State& state)
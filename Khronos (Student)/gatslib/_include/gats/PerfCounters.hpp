@@ -0,0 +1,94 @@
+#pragma once
+/*!	\file		gats/PerfCounters.hpp
+	\brief		Hardware performance counter declarations.
+	\date		2026-10-18
+
+=============================================================
+Hardware performance counters used by TestApp and BenchApp (--perf).
+	gats::PerfCounters
+	gats::PerfCounters::Sample
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial release.
+
+=============================================================*/
+
+
+#include <array>
+#include <cstdint>
+
+
+namespace gats {
+
+	/*!	\brief class PerfCounters
+
+		Free-running hardware counters of the calling thread, opened with
+		Linux perf_event_open().  A counter the platform, kernel or
+		permissions (perf_event_paranoid) do not provide is unavailable;
+		its value reads as zero and Sample::valid is false.  On other
+		platforms every counter is unavailable.
+
+		Counters count user-mode events of the thread that opened them,
+		so each thread uses its own instance: this_thread().
+	*/
+	class PerfCounters {
+	// TYPES
+	public:
+		enum counter { cycles, instructions, branch_misses, l1d_misses, llc_misses, dtlb_misses };
+		static constexpr std::size_t count_c = 6;
+
+		using values_type = std::array<std::uint64_t, count_c>;
+
+		/*!	Counter values: the raw running totals from read(), or the
+			events over an interval from the difference of two reads.
+			A multiplexed counter's interval count is scaled up by the
+			share of the interval it was enabled but not running.
+		*/
+		struct Sample {
+			values_type					values{};
+			values_type					enabled{};		// ns the counter was enabled
+			values_type					running{};		// ns the counter was counting
+			std::array<bool, count_c>	valid{};
+
+			Sample& operator += (Sample const& rhs);
+
+			/*!	Instructions per cycle, or 0 if unavailable. */
+			double ipc() const;
+
+			/*!	Events of 'c' per operation, or 0 if unavailable. */
+			double per(counter c, double nOperations) const;
+		};
+
+	// ATTRIBUTES
+	private:
+		std::array<int, count_c>	fd_m;
+
+	// OPERATIONS
+	public:
+		// Blocked
+		PerfCounters(PerfCounters const&) = delete;
+		void operator = (PerfCounters const&) = delete;
+
+		PerfCounters();
+		~PerfCounters();
+
+		bool available(counter c) const { return fd_m[c] >= 0; }
+		bool any_available() const;
+
+		/*!	Reads the raw running totals and the times each counter was enabled and running. */
+		Sample read() const;
+
+		static char const* name(counter c);
+
+		/*!	The calling thread's counters, opened on first use. */
+		static PerfCounters& this_thread();
+	};
+
+	/*!	Events between two reads, each counter scaled by its enabled/running times over the interval. */
+	PerfCounters::Sample operator - (PerfCounters::Sample const& lhs, PerfCounters::Sample const& rhs);
+
+} // end-of-namespace gats
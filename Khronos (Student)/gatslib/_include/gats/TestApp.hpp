@@ -13,17 +13,45 @@ TestApp frame declarations.
 	TestApp::TestCase::check_close_epsilon template implemenation.
 	GATS_TEST_CASE()
 	GATS_TEST_CASE_WEIGHTED()
+	GATS_TEST_CASE_BUDGETED()
 	GATS_CHECK()
 	GATS_CHECK_MESSAGE()
 	GATS_CHECK_EQUAL()
 	GATS_CHECK_WITHIN()
 	GATS_CHECK_THROW()
 	GATS_FAIL()
+	GATS_PARALLEL_FOR()
+	GATS_CHECK_ALL_EQUAL()
+	GATS_CHECK_ALL_WITHIN()
 
 =============================================================
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Added:
+		Concurrent case execution on a work-stealing ThreadPool (--threads=N)
+		TestApp::parallel_for(), GATS_PARALLEL_FOR()
+		TestCase::report()
+		GATS_CHECK_ALL_EQUAL(), GATS_CHECK_ALL_WITHIN() bulk range checks
+		Failure report cap per case (--max-failures=N, 0 = unlimited)
+		GATS_TEST_CASE_BUDGETED(): a case fails when it exceeds its CPU time budget
+		Case times written to gats-test-times.csv; compared against a
+		previous run with --baseline=file [--slowdown=percent];
+		malformed baseline lines are reported and skipped
+		TestApp::run_case() runs a case outside the suite (TestCase::unlisted);
+		TestApp::compare_times() compares times against a baseline
+		--perf: hardware performance counters per case, written to
+		gats-test-counters.csv
+	Changed:
+		The current case is thread-local.
+		Check counts accumulate per thread and merge into the case when
+		the thread leaves it; failure reports are buffered per case
+		and displayed in case order.
+		Console output written while a case is current is collected
+		per case (TestCase::console()) and displayed with its report.
+		current_case() and check() fast paths are inline.
+
 2021-11-27
 	Added: Groups
 
@@ -64,16 +92,25 @@ the program(s) have been supplied.
 
 
 #include <gats/ConsoleApp.hpp>
+#include <gats/PerfCounters.hpp>
+#include <gats/ThreadPool.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <cmath>
 #include <memory>
+#include <mutex>
+#include <ranges>
+#include <span>
 #include <sstream>
+#include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 
@@ -87,6 +124,7 @@ namespace gats {
 	// TYPES
 	public:
 		using char_type				= char;
+		using istream_type			= std::basic_istream<char_type>;
 		using ostream_type			= std::basic_ostream<char_type>;
 		using ofstream_type			= std::basic_ofstream<char_type>;
 		using ostringstream_type	= std::basic_ostringstream<char_type>;
@@ -102,9 +140,19 @@ namespace gats {
 			string_type		name_m;
 			string_type		group_m;
 
-			std::chrono::nanoseconds	elapsedTime_m{};
-			std::uintmax_t				nChecked_m = 0;
-			std::uintmax_t				nPassed_m = 0;
+			std::chrono::nanoseconds		elapsedTime_m{};
+			std::atomic<std::chrono::nanoseconds::rep>	cpuTime_m{ 0 };		// CPU time of the case's threads while it was current, ns.
+			std::chrono::nanoseconds		budget_m{};			// maximum CPU time (0 = unlimited).
+			std::atomic<std::uintmax_t>		nChecked_m{ 0 };
+			std::atomic<std::uintmax_t>		nPassed_m{ 0 };
+
+			string_type		output_m;				// failure reports, displayed after the case completes.
+			std::mutex		outputMutex_m;
+			std::atomic<std::uintmax_t>		nFailures_m{ 0 };	// including failures past the report cap.
+			string_type		console_m;				// std::cout output of the case, displayed with its report.
+
+			PerfCounters::Sample	counters_m;			// hardware counters while the case was current (--perf).
+			std::mutex				countersMutex_m;
 
 			double			weight_m = 1.0;			// weighted score of this case.
 
@@ -121,20 +169,48 @@ namespace gats {
 			TestCase(string_type const& name, string_type const& group, double weight=1.0);
 			TestCase(string_type const& name) : TestCase(name, defaultGroup_csm) {}
 			TestCase(string_type const& name, double weight) : TestCase(name, defaultGroup_csm, weight) {}
+			TestCase(string_type const& name, string_type const& group, double weight, std::chrono::nanoseconds budget) : TestCase(name, group, weight) { budget_m = budget; }
+		protected:
+			/*!	A case outside the suite, not registered with the TestApp; run it with TestApp::run_case(). */
+			struct unlisted_t {};
+			static constexpr unlisted_t unlisted{};
+			TestCase(string_type const& name, std::chrono::nanoseconds budget, unlisted_t) : name_m(name), budget_m(budget) {}
+		public:
 
 			// Application Interface
 			virtual void execute() = 0;
 
 			// Check Services
-			void add_check() { ++nChecked_m; }
-			void add_passed() { ++nPassed_m; }
+			void add_check() { ++tally_sm.nChecked; }
+			void add_passed() { ++tally_sm.nPassed; }
+			void add_checks(std::uintmax_t nChecked, std::uintmax_t nPassed) { tally_sm.nChecked += nChecked; tally_sm.nPassed += nPassed; }
+			std::uintmax_t reports_wanted(std::uintmax_t nFailures);
+			bool report_wanted() { return reports_wanted(1) != 0; }
+			void report(string_type const& text);
+			string_type console();
+			string_type reports();
 			void output_check_location(ostream_type& os, std::filesystem::path file, int line);
-			void check(bool condition, const char_type* const condStr, const char * const file, int line);
+			void check(bool condition, const char_type* const condStr, const char * const file, int line) {
+				add_check();
+				if (condition)
+					add_passed();
+				else
+					check_failed(condStr, file, line);
+			}
 			void check_message(bool condition, const string_type& message, const char* const file, int line);
 			template <typename LHS, typename RHS> 
 			void check_equal(const LHS& lhs, const RHS& rhs, const char_type* lhsStr, const char_type* rhsStr, const char* const file, int line);
 			template <typename LHS, typename RHS, typename VALUE>
 			void check_close_within(const LHS& lhs, const RHS& rhs, const VALUE& minimum, const char_type* lhsStr, const char_type* rhsStr, const char_type* minimumStr, const char* const file, int line);
+			template <std::ranges::contiguous_range LHS, std::ranges::contiguous_range RHS>
+			void check_all_equal(const LHS& lhs, const RHS& rhs, const char_type* lhsStr, const char_type* rhsStr, const char* const file, int line);
+			template <std::ranges::contiguous_range LHS, std::ranges::contiguous_range RHS, typename VALUE>
+			void check_all_within(const LHS& lhs, const RHS& rhs, const VALUE& minimum, const char_type* lhsStr, const char_type* rhsStr, const char_type* minimumStr, const char* const file, int line);
+
+		private:
+			void check_failed(const char_type* const condStr, const char* const file, int line);
+			bool check_sizes(std::size_t lhsSize, std::size_t rhsSize, const char_type* lhsStr, const char_type* rhsStr, const char* const file, int line);
+		public:
 
 			// Parent Services
 			inline ostream_type& display() { return TestApp::display(); }
@@ -144,6 +220,8 @@ namespace gats {
 			constexpr bool operator == (TestCase const& rhs) const { return name_m == rhs.name_m; }
 
 			// Access
+			std::uintmax_t checked() const { return nChecked_m.load(); }
+			std::uintmax_t passed() const { return nPassed_m.load(); }
 			friend class TestApp;
 		};
 
@@ -156,7 +234,64 @@ namespace gats {
 
 		static case_groups_pointer_type	casesPtr_sm;
 		static ofstream_type			logFile_m;
-		static case_pointer_type		currentCasePtr_sm;
+		static thread_local case_pointer_type	currentCasePtr_sm;
+		static ThreadPool*				poolPtr_sm;
+		static std::uintmax_t			failureLimit_sm;		// failure reports displayed per case (0 = all).
+		static bool						perfEnabled_sm;			// count hardware events per case (--perf).
+
+		/*!	Check counts of the calling thread's current case, not yet merged into the case. */
+		struct Tally {
+			std::uintmax_t	nChecked = 0;
+			std::uintmax_t	nPassed = 0;
+		};
+		static thread_local Tally		tally_sm;
+
+		/*!	Merge the calling thread's tally into its current case. */
+		static void merge_tally() {
+			if (currentCasePtr_sm && tally_sm.nChecked) {
+				currentCasePtr_sm->nChecked_m.fetch_add(tally_sm.nChecked, std::memory_order_relaxed);
+				currentCasePtr_sm->nPassed_m.fetch_add(tally_sm.nPassed, std::memory_order_relaxed);
+			}
+			tally_sm = Tally{};
+			merge_cpu_time();
+			if (perfEnabled_sm)
+				merge_counters();
+		}
+
+		/*!	Credit the calling thread's CPU time since its last merge to its current case. */
+		static void merge_cpu_time();
+		static std::chrono::nanoseconds thread_cpu_time();
+		static thread_local std::chrono::nanoseconds	cpuMark_sm;
+
+		/*!	Credit the calling thread's counter deltas since its last merge to its current case. */
+		static void merge_counters();
+		static thread_local PerfCounters::Sample	countersMark_sm;
+
+		/*!	std::cout's buffer while cases run: text written on a thread with a current case
+			is collected in that case's console_m, other text goes to the console. */
+		class CaseConsoleBuffer : public std::streambuf {
+			std::ostream&		os_m;
+			std::streambuf*		console_m;
+		public:
+			explicit CaseConsoleBuffer(std::ostream& os) : os_m(os), console_m(os.rdbuf()) { os_m.rdbuf(this); }
+			~CaseConsoleBuffer() { os_m.rdbuf(console_m); }
+			CaseConsoleBuffer(CaseConsoleBuffer const&) = delete;
+			void operator = (CaseConsoleBuffer const&) = delete;
+		protected:
+			int_type overflow(int_type ch) override;
+			std::streamsize xsputn(char_type const* text, std::streamsize n) override;
+			int sync() override;
+		};
+
+		/*!	Makes a case current on the calling thread for the lifetime of the scope. */
+		class CaseScope {
+			case_pointer_type	previous_m;
+		public:
+			CaseScope(case_pointer_type testCase) : previous_m(currentCasePtr_sm) { merge_tally(); currentCasePtr_sm = testCase; }
+			~CaseScope() { merge_tally(); currentCasePtr_sm = previous_m; }
+			CaseScope(CaseScope const&) = delete;
+			void operator = (CaseScope const&) = delete;
+		};
 
 	// OPERATIONS
 		static ostream_type&		display() { return std::cout; }
@@ -166,11 +301,75 @@ namespace gats {
 		void setup() override;
 		int execute() override;
 
+		[[noreturn]] static void no_current_case(const char* file, int line);
+
+		// Timing results
+		static void enforce_budget(case_pointer_type testCase);
+		static void write_times(std::filesystem::path const& path);
+		static void compare_times(std::filesystem::path const& baselinePath, double slowdownPercent);
+		static void write_counters(std::filesystem::path const& path);
+
 	public:
-		static case_pointer_type current_case(const char* file, int line);
+		static case_pointer_type current_case(const char* file, int line) {
+			if (currentCasePtr_sm == nullptr)
+				no_current_case(file, line);
+			return currentCasePtr_sm;
+		}
+
+		template <typename First, typename Last, typename Fn>
+		static void parallel_for(First first, Last last, Fn fn);
+
+		/*!	Case times read from a baseline results file, and the numbers of the lines that could not be used. */
+		struct Baseline {
+			std::map<string_type, std::chrono::nanoseconds>	times_m;
+			std::vector<std::size_t>						badLines_m;
+		};
+		static Baseline read_baseline(istream_type& in);
+
+		/*!	Cases compared with a baseline, and those that used more CPU time than 'slowdownPercent' over it. */
+		struct Slowdown {
+			string_type					name_m;
+			std::chrono::nanoseconds	baseline_m;
+			std::chrono::nanoseconds	time_m;
+			double						percent_m;
+		};
+		struct Comparison {
+			std::size_t				nCompared_m = 0;
+			std::vector<Slowdown>	slower_m;
+		};
+		static Comparison compare_times(std::map<string_type, std::chrono::nanoseconds> const& baseline,
+			std::vector<std::pair<string_type, std::chrono::nanoseconds>> const& times, double slowdownPercent);
+
+		/*!	Runs a case on the calling thread, as the suite runs its cases: its CPU time is charged to it and its budget enforced. */
+		static void run_case(TestCase& testCase);
 	};
 
 
+
+	/*!	\brief Run fn(i) for every i in [first, last) on the case pool.
+
+		Checks made by 'fn' are credited to the calling case.
+		Runs sequentially when cases are not executing on a pool.
+		This function is wrapped by GATS_PARALLEL_FOR() and not called directly.
+	*/
+	template <typename First, typename Last, typename Fn>
+	void TestApp::parallel_for(First first, Last last, Fn fn) {
+		using index_type = std::common_type_t<First, Last>;
+		if (poolPtr_sm == nullptr) {
+			for (index_type i = first; i < last; ++i)
+				fn(i);
+			return;
+		}
+
+		case_pointer_type testCase = currentCasePtr_sm;
+		poolPtr_sm->parallel_for_chunks(index_type(first), index_type(last), [testCase, &fn](index_type chunkFirst, index_type chunkLast) {
+			CaseScope scope(testCase);
+			for (index_type i = chunkFirst; i < chunkLast; ++i)
+				fn(i);
+		});
+	}
+
+
 	/*!	\brief Check for value equality.
 	
 		Check for value equality, reporting if different.
@@ -179,18 +378,86 @@ namespace gats {
 	template <typename LHS, typename RHS>
 	void TestApp::TestCase::check_equal(const LHS& lhs, const RHS& rhs, const TestApp::char_type* lhsStr, const TestApp::char_type* rhsStr, const char* const file, int line) {
 		bool condition = lhs == rhs;
-		++nChecked_m;
+		add_check();
 		if (condition==false) {
+			if (!report_wanted())
+				return;
 			ostringstream_type oss;
 			output_check_location(oss, file, line);
 			oss << "\"" << lhsStr <<  "\" [" << lhs << "] != \"" << rhsStr << "\" [" << rhs << "]\n";
-			display() << oss.str();
+			report(oss.str());
 			//log() << oss.str();
 		} else
-			++nPassed_m;
+			add_passed();
 	}
 
 
+	/*!	\brief Check two ranges for element-wise equality.
+
+		Each element pair counts as one check.  The comparison pass has no
+		branches so it vectorizes; reports are formatted only for the
+		mismatches within the case's failure cap.
+		This function is wrapped by GATS_CHECK_ALL_EQUAL() and not called directly.
+	*/
+	template <std::ranges::contiguous_range LHS, std::ranges::contiguous_range RHS>
+	void TestApp::TestCase::check_all_equal(const LHS& lhs, const RHS& rhs, const char_type* lhsStr, const char_type* rhsStr, const char* const file, int line) {
+		std::span const l{ std::ranges::data(lhs), std::ranges::size(lhs) };
+		std::span const r{ std::ranges::data(rhs), std::ranges::size(rhs) };
+		if (!check_sizes(l.size(), r.size(), lhsStr, rhsStr, file, line))
+			return;
+
+		std::size_t nFailed = 0;
+		for (std::size_t i = 0; i < l.size(); ++i)
+			nFailed += !(l[i] == r[i]);
+		add_checks(l.size(), l.size() - nFailed);
+
+		auto nWanted = nFailed ? reports_wanted(nFailed) : 0;
+		for (std::size_t i = 0; nWanted > 0; ++i) {
+			if (l[i] == r[i])
+				continue;
+			ostringstream_type oss;
+			output_check_location(oss, file, line);
+			oss << "\"" << lhsStr << "[" << i << "]\" [" << l[i] << "] != \"" << rhsStr << "[" << i << "]\" [" << r[i] << "]\n";
+			report(oss.str());
+			--nWanted;
+		}
+	}
+
+
+
+	/*!	\brief Check two ranges for element-wise closeness.
+
+		Each element pair counts as one check.
+		This function is wrapped by GATS_CHECK_ALL_WITHIN() and not called directly.
+	*/
+	template <std::ranges::contiguous_range LHS, std::ranges::contiguous_range RHS, typename VALUE>
+	void TestApp::TestCase::check_all_within(const LHS& lhs, const RHS& rhs, const VALUE& minimum, const char_type* lhsStr, const char_type* rhsStr, const char_type* minimumStr, const char* const file, int line) {
+		using std::abs;
+		std::span const l{ std::ranges::data(lhs), std::ranges::size(lhs) };
+		std::span const r{ std::ranges::data(rhs), std::ranges::size(rhs) };
+		if (!check_sizes(l.size(), r.size(), lhsStr, rhsStr, file, line))
+			return;
+
+		auto const limit = abs(minimum);
+		std::size_t nFailed = 0;
+		for (std::size_t i = 0; i < l.size(); ++i)
+			nFailed += !(abs(l[i] - r[i]) <= limit);
+		add_checks(l.size(), l.size() - nFailed);
+
+		auto nWanted = nFailed ? reports_wanted(nFailed) : 0;
+		for (std::size_t i = 0; nWanted > 0; ++i) {
+			if (abs(l[i] - r[i]) <= limit)
+				continue;
+			ostringstream_type oss;
+			output_check_location(oss, file, line);
+			oss << "difference(" << lhsStr << "[" << i << "], " << rhsStr << "[" << i << "]) > " << minimumStr << " ==> \t|" << l[i] << " - " << r[i] << "| > " << limit << "\n";
+			report(oss.str());
+			--nWanted;
+		}
+	}
+
+
+
 	/*!	\brief Check for value closeness.
 
 		Check for real number value similarity as defined by a minimum value, reporting if the difference is
@@ -201,10 +468,12 @@ namespace gats {
 		bool condition = abs((lhs) - (rhs)) <= abs(minimum);
 		add_check();
 		if (condition==false) {
+			if (!report_wanted())
+				return;
 			ostringstream_type oss;
 			output_check_location(oss, file, line);
 			oss << "difference(" << lhsStr << ", " << rhsStr << ") > " << minimumStr << " ==> \t|" << lhs << " - " << rhs << "| > " << abs(minimum) << "\n";
-			display() << oss.str();
+			report(oss.str());
 			//log() << oss.str();
 		} else
 			add_passed();
@@ -242,6 +511,26 @@ namespace gats {
 	void TestCase_ ## name :: execute()
 
 
+/*!	Creates a test case with the identifier 'name' that fails if it uses more CPU time than 'budget'.
+
+	\param 'name' is the test cases identifier.
+	\param 'group' is the group the case is reported in.
+	\param 'weight' is the weighted score of the case.
+	\param 'budget' is the maximum CPU time, a std::chrono::duration (e.g. 500ms).
+
+	The CPU time is that of every thread while it ran the case or its GATS_PARALLEL_FOR()
+	chunks, so it does not depend on the cases running beside it.
+
+	The identifier is used to indicate execution order (lexicographical ordering) and both the class and global object name.
+*/
+#define GATS_TEST_CASE_BUDGETED(name, group, weight, budget) \
+	static class TestCase_ ## name : public gats::TestApp::TestCase {\
+	public: TestCase_ ## name() : TestCase(#name, group, weight, std::chrono::duration_cast<std::chrono::nanoseconds>(budget)) { }\
+	public: virtual void execute() override;\
+	} TestCase_ ## name ## _g;\
+	void TestCase_ ## name :: execute()
+
+
 /*!	Creates a test case with the identifier 'name', and a percentage
 
 	\param 'name' is the test cases identifier.
@@ -300,6 +589,25 @@ namespace gats {
 
 
 
+/*!	Performs an element-wise exact match check of two contiguous ranges.
+
+	\param 'testValues' is the range being checked.
+	\param 'expectedValues' is the range of values the test range should have.
+*/
+#define GATS_CHECK_ALL_EQUAL(testValues, expectedValues) gats::TestApp::current_case(__FILE__,__LINE__)->check_all_equal((testValues), (expectedValues), #testValues, #expectedValues, __FILE__, __LINE__)
+
+
+
+/*!	Performs an element-wise close match check of two contiguous ranges.
+
+	\param 'testValues' is the range being checked.
+	\param 'expectedValues' is the range of values the test range should have.
+	\param 'minimum' is the maximum difference allowed.
+*/
+#define GATS_CHECK_ALL_WITHIN(testValues, expectedValues, minimum) gats::TestApp::current_case(__FILE__,__LINE__)->check_all_within((testValues), (expectedValues), (minimum), #testValues, #expectedValues, #minimum, __FILE__, __LINE__)
+
+
+
 /*!	Performs a check that the values are exact matches.
 
 	\param 'testValue' is the value being checked.
@@ -314,17 +622,19 @@ namespace gats {
 		gats::TestApp::current_case(__FILE__,__LINE__)->add_passed();\
 		isGood = true;\
 	} catch(...){\
-		gats::TestApp::ostringstream_type oss;\
-		gats::TestApp::current_case(__FILE__,__LINE__)->output_check_location(oss, file, line);\
-		oss << "unknown exception \"" #expectedException "\" not thrown\n";\
-		gats::TestApp::current_case(__FILE__,__LINE__)->display() << oss.str();\
+		if (gats::TestApp::current_case(__FILE__,__LINE__)->report_wanted()) {\
+			gats::TestApp::ostringstream_type oss;\
+			gats::TestApp::current_case(__FILE__,__LINE__)->output_check_location(oss, file, line);\
+			oss << "unknown exception \"" #expectedException "\" not thrown\n";\
+			gats::TestApp::current_case(__FILE__,__LINE__)->report(oss.str());\
+		}\
 		isGood = true;\
 	}\
-	if (!isGood) {\
+	if (!isGood && gats::TestApp::current_case(__FILE__,__LINE__)->report_wanted()) {\
 		gats::TestApp::ostringstream_type oss;\
 		gats::TestApp::current_case(__FILE__,__LINE__)->output_check_location(oss, file, line);\
 		oss << "no exception thrown, expecting \"" #expectedException "\"\n";\
-		gats::TestApp::current_case(__FILE__,__LINE__)->display() << oss.str();\
+		gats::TestApp::current_case(__FILE__,__LINE__)->report(oss.str());\
 	}\
 }
 #define GATS_CHECK_THROW(operation, expectedException) DETAIL_GATS_CHECK_THROW(operation, expectedException, __FILE__, __LINE__)
@@ -338,10 +648,26 @@ namespace gats {
 */
 #define DETAIL_GATS_FAIL(msg, file, line) {\
 	gats::TestApp::current_case(__FILE__,__LINE__)->add_check();\
-	gats::TestApp::ostringstream_type oss;\
-	gats::TestApp::current_case(__FILE__,__LINE__)->output_check_location(oss, file, line);\
-	oss << msg << '\n';\
-	gats::TestApp::current_case(__FILE__,__LINE__)->display() << oss.str();\
+	if (gats::TestApp::current_case(__FILE__,__LINE__)->report_wanted()) {\
+		gats::TestApp::ostringstream_type oss;\
+		gats::TestApp::current_case(__FILE__,__LINE__)->output_check_location(oss, file, line);\
+		oss << msg << '\n';\
+		gats::TestApp::current_case(__FILE__,__LINE__)->report(oss.str());\
+	}\
 	return;\
 }
 #define GATS_FAIL(msg) DETAIL_GATS_FAIL(msg, __FILE__, __LINE__)
+
+
+
+/*!	Runs a loop body for every index in [first, last) across the case pool.
+
+	\param 'index' is the name of the loop index within the body.
+	\param 'first' is the first index.
+	\param 'last' is one past the last index.
+	\param '...' is the loop body, a braced block.  Iterations run concurrently
+	and in no particular order; the body may use the GATS_CHECK macros.
+
+	GATS_PARALLEL_FOR(i, 0, n, { GATS_CHECK_EQUAL(f(i), g(i)); });
+*/
+#define GATS_PARALLEL_FOR(index, first, last, ...) gats::TestApp::parallel_for((first), (last), [&](auto index) __VA_ARGS__)
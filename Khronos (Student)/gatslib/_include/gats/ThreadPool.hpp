@@ -0,0 +1,168 @@
+#pragma once
+/*!	\file		gats/ThreadPool.hpp
+	\brief		Work-stealing thread pool declarations.
+	\date		2026-10-18
+
+=============================================================
+Work-stealing thread pool used by TestApp to run cases concurrently.
+	gats::ThreadPool
+	gats::ThreadPool::parallel_for_chunks() template implementation.
+	gats::ThreadPool::parallel_for() template implementation.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial release.
+
+=============================================================*/
+
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace gats {
+
+	/*!	\brief class ThreadPool
+
+		Each worker owns a task deque: it pops its own newest task and, when
+		empty, steals the oldest task of another worker.  The helpers of a
+		parallel_for() go on a shared queue that every worker takes from
+		first, so a loop is split across idle workers while whole tasks are
+		still queued.  A thread calling parallel_for() works through the
+		chunks of its own loop and then sleeps until the helpers finish, so
+		loops may be nested inside pool tasks; it never runs unrelated queued
+		tasks, which would nest one test case inside another.
+	*/
+	class ThreadPool {
+	// TYPES
+	public:
+		using task_type = std::function<void()>;
+
+	private:
+		struct Queue {
+			std::mutex				mutex_m;
+			std::deque<task_type>	tasks_m;
+		};
+
+	// ATTRIBUTES
+		std::vector<std::unique_ptr<Queue>>	queues_m;
+		Queue								helpers_m;		// parallel_for() helpers, taken ahead of any task
+		std::vector<std::jthread>			workers_m;
+
+		std::mutex					wakeMutex_m;
+		std::condition_variable		wake_m;
+		std::atomic<std::size_t>	nQueued_m{ 0 };
+		std::atomic<unsigned>		nextQueue_m{ 0 };
+		bool						stopping_m = false;
+
+		static thread_local ThreadPool*	currentPool_sm;
+		static thread_local unsigned	workerIndex_sm;
+
+	// OPERATIONS
+	public:
+		// Blocked
+		ThreadPool(ThreadPool const&) = delete;
+		void operator = (ThreadPool const&) = delete;
+
+		// Constructors
+		explicit ThreadPool(unsigned nThreads = 0);
+		~ThreadPool();
+
+		unsigned size() const { return static_cast<unsigned>(queues_m.size()); }		// complete before the workers start
+
+		void submit(task_type task);
+		bool run_pending_task();
+
+		template <typename Index, typename Fn>
+		void parallel_for_chunks(Index first, Index last, Fn fn);
+
+		template <typename Index, typename Fn>
+		void parallel_for(Index first, Index last, Fn fn);
+
+	private:
+		void submit_helper(task_type task);
+		bool try_pop(task_type& task);
+		void worker_loop(unsigned index);
+	};
+
+
+
+	/*!	\brief Run fn(chunkFirst, chunkLast) over contiguous chunks of [first, last) on the pool.
+
+		The range is split into a few chunks per worker.  The chunks are
+		claimed from a counter by the calling thread and by helper tasks
+		queued ahead of the pool's other tasks, so the caller only ever runs
+		chunks of this loop.  Helpers that start after every chunk is claimed
+		return at once.  The first exception raised by a chunk is rethrown
+		once all chunks are done.
+	*/
+	template <typename Index, typename Fn>
+	void ThreadPool::parallel_for_chunks(Index first, Index last, Fn fn) {
+		if (!(first < last))
+			return;
+
+		auto const count = static_cast<unsigned long long>(last - first);
+		auto const nChunks = std::min<unsigned long long>(count, 4ull * size());
+
+		// shared with helpers that may start after this call returns; they touch 'fn' only after claiming a chunk
+		struct Loop {
+			std::atomic<unsigned long long>	nClaimed{ 0 };
+			std::atomic<unsigned long long>	nDone{ 0 };
+			std::exception_ptr				error;
+			std::mutex						errorMutex;
+		};
+		auto const loop = std::make_shared<Loop>();
+
+		auto const runChunks = [=, &fn] {
+			for (unsigned long long chunk; (chunk = loop->nClaimed.fetch_add(1, std::memory_order_relaxed)) < nChunks; ) {
+				Index const chunkFirst = first + static_cast<Index>(count * chunk / nChunks);
+				Index const chunkLast = first + static_cast<Index>(count * (chunk + 1) / nChunks);
+				try {
+					fn(chunkFirst, chunkLast);
+				}
+				catch (...) {
+					std::lock_guard lock(loop->errorMutex);
+					if (!loop->error)
+						loop->error = std::current_exception();
+				}
+				if (loop->nDone.fetch_add(1, std::memory_order_release) + 1 == nChunks)
+					loop->nDone.notify_all();
+			}
+		};
+
+		auto const nHelpers = std::min<unsigned long long>(nChunks - 1, size());
+		for (unsigned long long helper = 0; helper < nHelpers; ++helper)
+			submit_helper(runChunks);
+		runChunks();
+
+		// the remaining chunks are running on helpers
+		for (auto done = loop->nDone.load(std::memory_order_acquire); done < nChunks; done = loop->nDone.load(std::memory_order_acquire))
+			loop->nDone.wait(done, std::memory_order_acquire);
+
+		if (loop->error)
+			std::rethrow_exception(loop->error);
+	}
+
+
+
+	/*!	\brief Run fn(i) for every i in [first, last) on the pool. */
+	template <typename Index, typename Fn>
+	void ThreadPool::parallel_for(Index first, Index last, Fn fn) {
+		parallel_for_chunks(first, last, [&fn](Index chunkFirst, Index chunkLast) {
+			for (Index i = chunkFirst; i < chunkLast; ++i)
+				fn(i);
+		});
+	}
+
+} // end-of-namespace gats
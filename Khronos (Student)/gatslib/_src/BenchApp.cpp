@@ -0,0 +1,293 @@
+/*!	\file	BenchApp.cpp
+	\brief	BenchApp micro-benchmark framework implementations.
+	\date	2026-10-18
+
+=============================================================
+BenchApp framework implementations.
+	global operator new/delete allocation counting
+	BenchApp::State
+	BenchApp::Benchmark
+	BenchApp
+	Hardware counters per operation (--perf)
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial release.
+
+=============================================================*/
+
+
+#include <gats/BenchApp.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+using namespace std;
+using namespace std::chrono;
+
+
+
+// ----------------------------------------------------------------------------
+// Allocation counting
+// ----------------------------------------------------------------------------
+
+namespace {
+	std::atomic<std::uint64_t> allocations_g{ 0 };
+}
+
+void* operator new(std::size_t size) {
+	allocations_g.fetch_add(1, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+
+
+namespace gats {
+
+	void const volatile* volatile detail::optimizerSink_g = nullptr;
+
+
+
+// ----------------------------------------------------------------------------
+// BenchApp::State
+// ----------------------------------------------------------------------------
+
+	void BenchApp::State::start() {
+		if (perf_m)
+			countersAtStart_m = PerfCounters::this_thread().read();
+		allocationsAtStart_m = allocation_count();
+		start_m = clock_type::now();
+	}
+
+	void BenchApp::State::stop() {
+		elapsed_m = clock_type::now() - start_m;
+		allocations_m = allocation_count() - allocationsAtStart_m;
+		if (perf_m)
+			counters_m = PerfCounters::this_thread().read() - countersAtStart_m;
+	}
+
+
+
+// ----------------------------------------------------------------------------
+// BenchApp::Benchmark
+// ----------------------------------------------------------------------------
+
+	/*!	Benchmark constructor registers the benchmark with the BenchApp */
+	BenchApp::Benchmark::Benchmark(std::string const& name, std::string const& group) : name_m(name), group_m(group) {
+		BenchApp::benchmarks().push_back(this);
+	}
+
+
+
+// ----------------------------------------------------------------------------
+// BenchApp
+// ----------------------------------------------------------------------------
+
+	std::unique_ptr<BenchApp::benchmark_list_type> BenchApp::benchmarksPtr_sm;
+
+	//! Global BenchApp instance <<singleton>>
+	BenchApp benchApp_g;
+
+
+
+	/*!	Returns a reference to the benchmarks container. */
+	BenchApp::benchmark_list_type& BenchApp::benchmarks() {
+		if (!benchmarksPtr_sm)
+			benchmarksPtr_sm.reset(new benchmark_list_type);
+		return *benchmarksPtr_sm;
+	}
+
+
+
+	std::uint64_t BenchApp::allocation_count() {
+		return allocations_g.load(std::memory_order_relaxed);
+	}
+
+
+
+	bool BenchApp::add(std::string const& name, std::string const& group, std::function<void(State&)> body) {
+		class FunctionBenchmark : public Benchmark {
+			std::function<void(State&)> body_m;
+		public:
+			FunctionBenchmark(std::string const& name, std::string const& group, std::function<void(State&)> body)
+				: Benchmark(name, group), body_m(std::move(body)) {}
+			void run(State& state) override { body_m(state); }
+		};
+		static std::vector<std::unique_ptr<Benchmark>> owned;
+		owned.push_back(std::make_unique<FunctionBenchmark>(name, group, std::move(body)));
+		return true;
+	}
+
+
+
+	namespace {
+		struct Result {
+			std::string		name;
+			std::string		group;
+			std::uint64_t	iterations = 0;
+			double			nsPerOp = 0.0;
+			double			allocsPerOp = 0.0;
+			PerfCounters::Sample	counters;		// summed over the repetitions
+			double			nOps = 0.0;
+		};
+
+		/*!	A rate as a JSON number, or null if its counter is unavailable. */
+		std::string json_rate(bool valid, double value) {
+			if (!valid)
+				return "null";
+			std::ostringstream oss;
+			oss << std::fixed << std::setprecision(4) << value;
+			return oss.str();
+		}
+
+		/*!	Escapes a string for a JSON string literal. */
+		std::string json_string(std::string const& text) {
+			std::string quoted = "\"";
+			for (char c : text) {
+				if (c == '"' || c == '\\')
+					quoted += '\\';
+				quoted += c;
+			}
+			return quoted + '"';
+		}
+	}
+
+
+
+	/*!	'execute' overrides the application interface method to run the benchmarks and report the results. */
+	int BenchApp::execute() {
+		// Command line
+		std::string filter;
+		nanoseconds minTime = 100ms;
+		unsigned repetitions = 3;
+		std::string jsonPath = "gats-bench-results.json";
+		bool perf = false;
+		for (auto const& arg : get_args()) {
+			if (arg.starts_with("--filter="))
+				filter = arg.substr(9);
+			else if (arg.starts_with("--min-time="))
+				minTime = milliseconds(std::stoll(arg.substr(11)));
+			else if (arg.starts_with("--repetitions="))
+				repetitions = std::max(1u, static_cast<unsigned>(std::stoul(arg.substr(14))));
+			else if (arg.starts_with("--json="))
+				jsonPath = arg.substr(7);
+			else if (arg == "--perf")
+				perf = true;
+		}
+		if (perf && !PerfCounters::this_thread().any_available())
+			cout << "--perf: no hardware counters are available on this system\n";
+
+		// run in a stable order: by group then name
+		auto ordered = benchmarks();
+		std::sort(ordered.begin(), ordered.end(), [](Benchmark const* lhs, Benchmark const* rhs) {
+			return std::tie(lhs->group_m, lhs->name_m) < std::tie(rhs->group_m, rhs->name_m);
+		});
+
+		std::vector<Result> results;
+		std::string currentGroup;
+		for (auto benchmark : ordered) {
+			if (!filter.empty() && benchmark->name_m.find(filter) == std::string::npos)
+				continue;
+
+			if (benchmark->group_m != currentGroup || results.empty()) {
+				currentGroup = benchmark->group_m;
+				cout << "Group: " << currentGroup << '\n';
+			}
+
+			// calibrate: grow the iteration count until a run takes a tenth of the minimum time
+			std::uint64_t iterations = 1;
+			for (;;) {
+				State state(iterations);
+				benchmark->run(state);
+				if (state.elapsed_m >= minTime / 10 || iterations >= (std::uint64_t(1) << 40))
+					break;
+				iterations *= 10;
+			}
+			{
+				State state(iterations);
+				benchmark->run(state);
+				auto const perIteration = std::max<double>(1.0, double(duration_cast<nanoseconds>(state.elapsed_m).count()) / double(iterations));
+				iterations = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(double(minTime.count()) / perIteration));
+			}
+
+			// measure: median of the repetitions
+			std::vector<double> nsPerOp, allocsPerOp;
+			PerfCounters::Sample counters;
+			double nOps = 0.0;
+			for (unsigned r = 0; r < repetitions; ++r) {
+				State state(iterations);
+				state.perf_m = perf;
+				benchmark->run(state);
+				double const ops = double(iterations) * double(state.itemsPerIteration_m);
+				nsPerOp.push_back(double(duration_cast<nanoseconds>(state.elapsed_m).count()) / ops);
+				allocsPerOp.push_back(double(state.allocations_m) / ops);
+				counters += state.counters_m;
+				nOps += ops;
+			}
+			std::sort(nsPerOp.begin(), nsPerOp.end());
+			std::sort(allocsPerOp.begin(), allocsPerOp.end());
+
+			Result result{ benchmark->name_m, benchmark->group_m, iterations, nsPerOp[nsPerOp.size() / 2], allocsPerOp[allocsPerOp.size() / 2], counters, nOps };
+			cout << "  " << std::left << std::setw(48) << result.name << std::right
+				<< std::fixed << std::setprecision(2)
+				<< std::setw(12) << result.nsPerOp << " ns/op"
+				<< std::setw(16) << std::setprecision(0) << (result.nsPerOp > 0.0 ? 1e9 / result.nsPerOp : 0.0) << " ops/s"
+				<< std::setw(10) << std::setprecision(2) << result.allocsPerOp << " allocs/op\n";
+			if (perf && counters.valid[PerfCounters::cycles]) {
+				cout << "  " << std::setw(48) << "" << std::setprecision(2)
+					<< std::setw(12) << counters.ipc() << " IPC";
+				for (auto c : { PerfCounters::branch_misses, PerfCounters::l1d_misses, PerfCounters::llc_misses, PerfCounters::dtlb_misses })
+					if (counters.valid[c])
+						cout << "  " << PerfCounters::name(c) << "/op " << std::setprecision(4) << counters.per(c, nOps);
+				cout << '\n';
+			}
+			results.push_back(result);
+		}
+
+		// JSON results: one benchmark per line, fixed key order, for diffing between releases
+		std::ofstream json(jsonPath);
+		if (!json)
+			throw std::runtime_error("Could not open: " + jsonPath);
+		json << "{\n\t\"benchmarks\": [\n";
+		for (size_t i = 0; i < results.size(); ++i) {
+			auto const& r = results[i];
+			std::ostringstream line;
+			line << std::fixed << std::setprecision(3)
+				<< "\t\t{ \"name\": " << json_string(r.name)
+				<< ", \"group\": " << json_string(r.group)
+				<< ", \"iterations\": " << r.iterations
+				<< ", \"ns_per_op\": " << r.nsPerOp
+				<< ", \"ops_per_s\": " << (r.nsPerOp > 0.0 ? 1e9 / r.nsPerOp : 0.0)
+				<< ", \"allocs_per_op\": " << r.allocsPerOp;
+			if (perf) {
+				auto const& c = r.counters;
+				line << ", \"ipc\": " << json_rate(c.valid[PerfCounters::cycles] && c.valid[PerfCounters::instructions], c.ipc());
+				for (size_t k = 0; k < PerfCounters::count_c; ++k) {
+					auto const counter = PerfCounters::counter(k);
+					line << ", \"" << PerfCounters::name(counter) << "_per_op\": " << json_rate(c.valid[k], c.per(counter, r.nOps));
+				}
+			}
+			line << " }";
+			json << line.str() << (i + 1 < results.size() ? ",\n" : "\n");
+		}
+		json << "\t]\n}\n";
+
+		cout << results.size() << " benchmarks, results written to " << jsonPath << endl;
+		return EXIT_SUCCESS;
+	}
+
+} // end-of-namespace gats
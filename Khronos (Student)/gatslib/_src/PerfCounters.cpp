@@ -0,0 +1,172 @@
+/*!	\file	PerfCounters.cpp
+	\brief	Hardware performance counter implementation.
+	\date	2026-10-18
+
+=============================================================
+Hardware performance counter implementation.
+	gats::PerfCounters
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial release.
+
+=============================================================*/
+
+
+#include <gats/PerfCounters.hpp>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace gats {
+
+#if defined(__linux__)
+	namespace {
+		/*!	perf_event_attr type and config of each counter, in PerfCounters::counter order. */
+		struct Event {
+			std::uint32_t	type;
+			std::uint64_t	config;
+		};
+
+		constexpr std::uint64_t cache_read_miss(std::uint64_t cache) {
+			return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		}
+
+		constexpr Event events_c[PerfCounters::count_c] = {
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+			{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+			{ PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_L1D) },
+			{ PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_LL) },
+			{ PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_DTLB) },
+		};
+
+		int open_event(Event const& event) {
+			perf_event_attr attr{};
+			attr.size = sizeof(attr);
+			attr.type = event.type;
+			attr.config = event.config;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+		}
+	}
+#endif
+
+
+
+	/*!	Opens each counter separately, so one the hardware lacks does not disable the others. */
+	PerfCounters::PerfCounters() {
+		fd_m.fill(-1);
+#if defined(__linux__)
+		for (std::size_t c = 0; c < count_c; ++c)
+			fd_m[c] = open_event(events_c[c]);
+#endif
+	}
+
+
+
+	PerfCounters::~PerfCounters() {
+#if defined(__linux__)
+		for (int fd : fd_m)
+			if (fd >= 0)
+				close(fd);
+#endif
+	}
+
+
+
+	bool PerfCounters::any_available() const {
+		return std::any_of(fd_m.begin(), fd_m.end(), [](int fd) { return fd >= 0; });
+	}
+
+
+
+	PerfCounters::Sample PerfCounters::read() const {
+		Sample sample;
+#if defined(__linux__)
+		for (std::size_t c = 0; c < count_c; ++c) {
+			if (fd_m[c] < 0)
+				continue;
+			std::uint64_t data[3];		// value, time enabled, time running
+			if (::read(fd_m[c], data, sizeof(data)) != sizeof(data))
+				continue;
+			sample.values[c] = data[0];
+			sample.enabled[c] = data[1];
+			sample.running[c] = data[2];
+			sample.valid[c] = true;
+		}
+#endif
+		return sample;
+	}
+
+
+
+	char const* PerfCounters::name(counter c) {
+		static char const* const names[count_c] = { "cycles", "instructions", "branch_misses", "l1d_misses", "llc_misses", "dtlb_misses" };
+		return names[c];
+	}
+
+
+
+	PerfCounters& PerfCounters::this_thread() {
+		thread_local PerfCounters counters;
+		return counters;
+	}
+
+
+
+	PerfCounters::Sample& PerfCounters::Sample::operator += (Sample const& rhs) {
+		for (std::size_t c = 0; c < count_c; ++c) {
+			values[c] += rhs.values[c];
+			enabled[c] += rhs.enabled[c];
+			running[c] += rhs.running[c];
+			valid[c] = valid[c] || rhs.valid[c];
+		}
+		return *this;
+	}
+
+
+
+	double PerfCounters::Sample::ipc() const {
+		return valid[cycles] && valid[instructions] && values[cycles] != 0
+			? double(values[instructions]) / double(values[cycles])
+			: 0.0;
+	}
+
+
+
+	double PerfCounters::Sample::per(counter c, double nOperations) const {
+		return valid[c] && nOperations > 0.0 ? double(values[c]) / nOperations : 0.0;
+	}
+
+
+
+	/*!	The raw totals are subtracted before scaling: scaled totals are not monotone, so their difference could wrap. */
+	PerfCounters::Sample operator - (PerfCounters::Sample const& lhs, PerfCounters::Sample const& rhs) {
+		PerfCounters::Sample difference;
+		for (std::size_t c = 0; c < PerfCounters::count_c; ++c) {
+			difference.valid[c] = lhs.valid[c] && rhs.valid[c]
+				&& lhs.values[c] >= rhs.values[c] && lhs.enabled[c] >= rhs.enabled[c] && lhs.running[c] >= rhs.running[c];
+			if (!difference.valid[c])
+				continue;
+			std::uint64_t const events = lhs.values[c] - rhs.values[c];
+			difference.enabled[c] = lhs.enabled[c] - rhs.enabled[c];
+			difference.running[c] = lhs.running[c] - rhs.running[c];
+			difference.values[c] = difference.running[c] == 0 || difference.running[c] == difference.enabled[c]
+				? events
+				: static_cast<std::uint64_t>(double(events) * double(difference.enabled[c]) / double(difference.running[c]));
+		}
+		return difference;
+	}
+
+} // end-of-namespace gats
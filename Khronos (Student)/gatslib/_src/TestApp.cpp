@@ -22,6 +22,19 @@ TestApp framework implementations.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Added:
+		TestApp::TestCase::report()
+		TestApp::TestCase::reports_wanted()
+		TestApp::TestCase::check_failed(), check_sizes()
+		TestApp::poolPtr_sm, failureLimit_sm, tally_sm
+		TestApp::perfEnabled_sm, countersMark_sm, merge_counters()
+		TestApp::TestCase::console(), reports(), TestApp::CaseConsoleBuffer
+		TestApp::cpuMark_sm, merge_cpu_time(), thread_cpu_time()
+	Changed:
+		TestApp::currentCasePtr_sm is thread-local.
+		TestApp::TestCase::check() and TestApp::current_case() fast paths moved inline.
+
 Version 2021.10.29
 	Added:
 		TestApp::current_case()
@@ -57,6 +70,7 @@ the program(s) have been supplied.
 
 
 #include <gats/TestApp.hpp>
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -65,6 +79,12 @@ the program(s) have been supplied.
 #include <filesystem>
 #include <string>
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
 
 namespace gats {
 // ----------------------------------------------------------------------------
@@ -86,32 +106,84 @@ namespace gats {
 
 
 
-	/*! Checks a condition, logging and reporting a failure to achieve that condition. */
-	void TestApp::TestCase::check(bool condition, const char_type* const condStr, const char* file, int line) {
-		++nChecked_m;
-		if (condition == false) {
+	/*!	Counts 'nFailures' failures, returning how many of them may still be reported under the failure cap. */
+	std::uintmax_t TestApp::TestCase::reports_wanted(std::uintmax_t nFailures) {
+		auto const nPrevious = nFailures_m.fetch_add(nFailures, std::memory_order_relaxed);
+		if (failureLimit_sm == 0)
+			return nFailures;
+		if (nPrevious >= failureLimit_sm)
+			return 0;
+		return std::min(nFailures, failureLimit_sm - nPrevious);
+	}
+
+
+
+	/*!	Appends to the case's failure report, displayed once the case completes. */
+	void TestApp::TestCase::report(string_type const& text) {
+		std::lock_guard lock(outputMutex_m);
+		output_m += text;
+	}
+
+
+
+	/*!	Returns the console output the case has written so far. */
+	TestApp::string_type TestApp::TestCase::console() {
+		std::lock_guard lock(outputMutex_m);
+		return console_m;
+	}
+
+
+
+	/*!	Returns the failure reports of the case so far. */
+	TestApp::string_type TestApp::TestCase::reports() {
+		std::lock_guard lock(outputMutex_m);
+		return output_m;
+	}
+
+
+
+	/*! Reports a failed check() condition. */
+	void TestApp::TestCase::check_failed(const char_type* const condStr, const char* file, int line) {
+		if (!report_wanted())
+			return;
+		ostringstream_type oss;
+		output_check_location(oss, file, line);
+		oss << condStr << "\n";
+		report(oss.str());
+		//log() << oss.str();
+	}
+
+
+
+	/*!	Checks that two ranges have the same length, reporting if not. */
+	bool TestApp::TestCase::check_sizes(std::size_t lhsSize, std::size_t rhsSize, const char_type* lhsStr, const char_type* rhsStr, const char* const file, int line) {
+		if (lhsSize == rhsSize)
+			return true;
+		add_check();
+		if (report_wanted()) {
 			ostringstream_type oss;
 			output_check_location(oss, file, line);
-			oss << condStr << "\n";
-			display() << oss.str();
-			//log() << oss.str();
-		} else
-			++nPassed_m;
+			oss << "size of \"" << lhsStr << "\" [" << lhsSize << "] != size of \"" << rhsStr << "\" [" << rhsSize << "]\n";
+			report(oss.str());
+		}
+		return false;
 	}
 
 
 
 	/*! Checks a condition, logging and reporting a failure to achieve that condition with a user supplied message. */
 	void TestApp::TestCase::check_message(bool condition, const string_type& message, const char* const file, int line) {
-		++nChecked_m;
+		add_check();
 		if (condition == false) {
+			if (!report_wanted())
+				return;
 			ostringstream_type oss;
 			output_check_location(oss, file, line);
 			oss << message << "\n";
-			display() << oss.str();
+			report(oss.str());
 			//log() << oss.str();
 		} else
-			++nPassed_m;
+			add_passed();
 	}
 
 
@@ -123,7 +195,13 @@ namespace gats {
 	//! Classifier instances for TestApp
 	TestApp::case_groups_pointer_type	TestApp::casesPtr_sm;
 	TestApp::ofstream_type				TestApp::logFile_m;
-	TestApp::case_pointer_type			TestApp::currentCasePtr_sm = nullptr;
+	thread_local TestApp::case_pointer_type	TestApp::currentCasePtr_sm = nullptr;
+	ThreadPool*							TestApp::poolPtr_sm = nullptr;
+	std::uintmax_t						TestApp::failureLimit_sm = 50;
+	thread_local TestApp::Tally			TestApp::tally_sm;
+	bool								TestApp::perfEnabled_sm = false;
+	thread_local PerfCounters::Sample	TestApp::countersMark_sm;
+	thread_local std::chrono::nanoseconds	TestApp::cpuMark_sm{};
 
 
 
@@ -141,13 +219,76 @@ namespace gats {
 
 
 
-	/*!	Get a reference to the cases container. */
-	TestApp::case_pointer_type TestApp::current_case(const char* file, int line) {
-		using namespace std;
-		if (currentCasePtr_sm == nullptr) {
-			throw std::runtime_error("Check invoked without enclosing test case: "s + file + "(" + to_string(line) + ")");
+	/*!	CPU time used by the calling thread. */
+	std::chrono::nanoseconds TestApp::thread_cpu_time() {
+#if defined(_WIN32)
+		FILETIME creation, exit, kernel, user;
+		if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+			return {};
+		auto const ticks = [](FILETIME const& t) { return (std::uint64_t(t.dwHighDateTime) << 32) | t.dwLowDateTime; };
+		return std::chrono::nanoseconds((ticks(kernel) + ticks(user)) * 100);
+#else
+		timespec now{};
+		clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+		return std::chrono::seconds(now.tv_sec) + std::chrono::nanoseconds(now.tv_nsec);
+#endif
+	}
+
+
+
+	/*!	Like the counters, the CPU time between two scope changes belongs to the case current in between. */
+	void TestApp::merge_cpu_time() {
+		auto const now = thread_cpu_time();
+		if (currentCasePtr_sm)
+			currentCasePtr_sm->cpuTime_m.fetch_add((now - cpuMark_sm).count(), std::memory_order_relaxed);
+		cpuMark_sm = now;
+	}
+
+
+
+	/*!	Counters run freely; the events between two scope changes belong to the case current in between. */
+	void TestApp::merge_counters() {
+		auto const now = PerfCounters::this_thread().read();
+		if (currentCasePtr_sm) {
+			std::lock_guard lock(currentCasePtr_sm->countersMutex_m);
+			currentCasePtr_sm->counters_m += now - countersMark_sm;
 		}
-		return currentCasePtr_sm;
+		countersMark_sm = now;
+	}
+
+
+
+	/*!	Collects a character written to std::cout in the current case, if any. */
+	TestApp::CaseConsoleBuffer::int_type TestApp::CaseConsoleBuffer::overflow(int_type ch) {
+		if (traits_type::eq_int_type(ch, traits_type::eof()))
+			return traits_type::not_eof(ch);
+		char_type const c = traits_type::to_char_type(ch);
+		return xsputn(&c, 1) == 1 ? ch : traits_type::eof();
+	}
+
+
+
+	/*!	Collects text written to std::cout in the current case, if any. */
+	std::streamsize TestApp::CaseConsoleBuffer::xsputn(char_type const* text, std::streamsize n) {
+		if (currentCasePtr_sm == nullptr)
+			return console_m->sputn(text, n);
+		std::lock_guard lock(currentCasePtr_sm->outputMutex_m);
+		currentCasePtr_sm->console_m.append(text, static_cast<std::size_t>(n));
+		return n;
+	}
+
+
+
+	int TestApp::CaseConsoleBuffer::sync() {
+		return currentCasePtr_sm == nullptr ? console_m->pubsync() : 0;
+	}
+
+
+
+	/*!	Reports a check made outside of any test case. */
+	void TestApp::no_current_case(const char* file, int line) {
+		using namespace std;
+		throw std::runtime_error("Check invoked without enclosing test case: "s + file + "(" + to_string(line) + ")");
 	}
 
 
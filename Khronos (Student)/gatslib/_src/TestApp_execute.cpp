@@ -22,6 +22,20 @@ TestApp framework implementations.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.18
+	Changed:
+		Cases run concurrently on a work-stealing ThreadPool; reports are
+		displayed in case order.  --threads=N sets the pool size
+		(--threads=1 runs the cases sequentially on the main thread).
+		Failure reports past --max-failures=N per case (default 50,
+		0 = unlimited) are summarized.
+		Console output of a case is collected and displayed with its report.
+		Case CPU time budgets are enforced, also for a case run by hand
+		with TestApp::run_case(); case times are written to
+		gats-test-times.csv and CPU times compared with --baseline=file.
+		--perf counts hardware events per case into gats-test-counters.csv.
+		Flags with values that cannot be read are reported and ignored.
+
 Version 2021.10.29
 	Added:
 		TestApp::current_case()
@@ -57,14 +71,56 @@ the program(s) have been supplied.
 
 
 #include <gats/TestApp.hpp>
+#include <gats/ThreadPool.hpp>
+#include <charconv>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
 using namespace std;
 using namespace std::chrono;
 using namespace gats::win32;
 
 
 
+namespace {
+	/*!	Reads the whole value of 'arg' after its 'prefixLength' characters into 'value'; false leaves 'value' unchanged. */
+	template <typename T>
+	bool parse_flag(gats::TestApp::string_type const& arg, size_t prefixLength, T& value) {
+		char const* first = arg.data() + prefixLength;
+		char const* last = arg.data() + arg.size();
+		T parsed{};
+		auto const [end, ec] = from_chars(first, last, parsed);
+		if (first == last || ec != errc() || end != last)
+			return false;
+		value = parsed;
+		return true;
+	}
+}
+
+
+
 namespace gats {
+	/*!	Runs one case on the calling thread and enforces its budget. */
+	void TestApp::run_case(TestCase& testCase) {
+		auto start = high_resolution_clock::now();
+		{
+			CaseScope scope(&testCase);
+			try {
+				testCase.execute();
+			}
+			catch (...) {
+				testCase.report(testCase.name_m + ": Unknown exception caught.\n");
+			};
+		}
+		auto stop = high_resolution_clock::now();
+		// wall time depends on the cases running beside it; the budget is charged the case's own CPU time
+		testCase.elapsedTime_m = stop - start;
+		enforce_budget(&testCase);
+	}
+
+
+
 	/*!	'execute' overrides the application interface method to perform all test cases and log/report the results. */
 	int TestApp::execute() {
 
@@ -90,6 +146,9 @@ namespace gats {
 		// restore console attributes on exit
 		ScopedAttributeState sas;
 
+		// collect each case's console output, displayed with its report
+		CaseConsoleBuffer caseConsole(cout);
+
 
 
 		// sort the cases
@@ -106,36 +165,77 @@ namespace gats {
 
 
 
+		// Command line: --threads=N --max-failures=N --baseline=file --slowdown=percent --perf
+		// a flag whose value cannot be read is reported and its default kept
+		unsigned nThreads = 0;
+		std::filesystem::path baselinePath;
+		double slowdownPercent = 25.0;
+		for (auto const& arg : get_args()) {
+			bool good = true;
+			if (arg.starts_with("--threads="))
+				good = parse_flag(arg, 10, nThreads);
+			else if (arg.starts_with("--max-failures="))
+				good = parse_flag(arg, 15, failureLimit_sm);
+			else if (arg.starts_with("--baseline="))
+				baselinePath = arg.substr(11);
+			else if (arg.starts_with("--slowdown="))
+				good = parse_flag(arg, 11, slowdownPercent);
+			else if (arg == "--perf")
+				perfEnabled_sm = true;
+			if (!good) {
+				cout << bright(red) << "Ignored bad flag: " << arg << white << '\n';
+				logFile_m << "Ignored bad flag: " << arg << '\n';
+			}
+		}
+
+
+
 		// Run the cases
-		for (auto& testCaseGroup : cases()) {
-			for (auto& testCase : testCaseGroup.second) {
-				cout << bright(yellow);
-				currentCasePtr_sm = testCase;
-				bool ranWithoutException = false;
-				string exceptionMessage;
-				auto start = high_resolution_clock::now();
-				try {
-					testCase->execute();
-					ranWithoutException = true;
-
-					nMaxChecked = std::max(nMaxChecked, testCase->nChecked_m);
-				}
-				catch (...) {
-					exceptionMessage = "Unknown exception caught.";
-				};
-				auto stop = high_resolution_clock::now();
-				auto elapsedTime = stop - start;
-				testCase->elapsedTime_m = elapsedTime;
-
-				// report exception trapped
-				if (!ranWithoutException) {
-					cout << testCase->name_m << ": ";
-					cout << exceptionMessage << endl;
-				}
+		case_list_type orderedCases;
+		for (auto& testCaseGroup : cases())
+			orderedCases.insert(orderedCases.end(), testCaseGroup.second.begin(), testCaseGroup.second.end());
+
+		std::vector<char> finished(orderedCases.size(), false);
+		std::mutex finishedMutex;
+		std::condition_variable finishedChanged;
+
+		auto runCase = [&](size_t index) {
+			run_case(*orderedCases[index]);
+			{
+				std::lock_guard lock(finishedMutex);
+				finished[index] = true;
+			}
+			finishedChanged.notify_all();
+		};
 
-				currentCasePtr_sm = nullptr;
-				cout << white;
+		// display the reports in case order as the cases finish
+		auto displayReport = [&](size_t index) {
+			{
+				std::unique_lock lock(finishedMutex);
+				finishedChanged.wait(lock, [&] { return finished[index] != false; });
+			}
+			auto testCase = orderedCases[index];
+			cout << testCase->console_m;
+			cout << bright(yellow) << testCase->output_m;
+			if (failureLimit_sm != 0 && testCase->nFailures_m > failureLimit_sm)
+				cout << testCase->name_m << ": " << testCase->nFailures_m - failureLimit_sm << " more failures not shown (--max-failures=" << failureLimit_sm << ")\n";
+			cout << white;
+			nMaxChecked = std::max(nMaxChecked, testCase->nChecked_m.load());
+		};
+
+		if (nThreads == 1) {
+			for (size_t index = 0; index < orderedCases.size(); ++index) {
+				runCase(index);
+				displayReport(index);
 			}
+		} else {
+			ThreadPool pool(nThreads);
+			poolPtr_sm = &pool;
+			for (size_t index = 0; index < orderedCases.size(); ++index)
+				pool.submit([&runCase, index] { runCase(index); });
+			for (size_t index = 0; index < orderedCases.size(); ++index)
+				displayReport(index);
+			poolPtr_sm = nullptr;
 		}
 		auto nMaxCheckedDigits = (std::streamsize)floor(log10(nMaxChecked)) + 1;
 
@@ -256,6 +356,15 @@ namespace gats {
 		std::cout << oss.str() << std::endl;
 		logFile_m << oss.str() << std::endl;
 
+
+
+		// timing results
+		write_times("gats-test-times.csv");
+		if (!baselinePath.empty())
+			compare_times(baselinePath, slowdownPercent);
+		if (perfEnabled_sm)
+			write_counters("gats-test-counters.csv");
+
 		return EXIT_SUCCESS;
 	}
 
@@ -0,0 +1,260 @@
+/*!	\file	TestApp_results.cpp
+	\brief	TestApp timing results implementations.
+	\date	2026-10-18
+
+=============================================================
+TestApp timing results implementations.
+	TestApp::enforce_budget()
+	TestApp::write_times()
+	TestApp::read_baseline()
+	TestApp::compare_times()
+	TestApp::write_counters()
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial release.
+
+=============================================================*/
+
+
+#include <gats/TestApp.hpp>
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+using namespace std;
+using namespace std::chrono;
+
+
+
+namespace gats {
+
+	/*!	Baseline cases faster than this are not compared; their times are mostly noise. */
+	static constexpr nanoseconds minimumComparedTime_c = 1ms;
+
+
+
+	/*!	Fails a case that used more CPU time than its budget by recording a failed check. */
+	void TestApp::enforce_budget(case_pointer_type testCase) {
+		nanoseconds const cpuTime(testCase->cpuTime_m.load());
+		if (testCase->budget_m.count() == 0 || cpuTime <= testCase->budget_m)
+			return;
+
+		testCase->nChecked_m.fetch_add(1, memory_order_relaxed);
+		if (testCase->report_wanted()) {
+			ostringstream_type oss;
+			oss << "error in \"" << testCase->name_m << "\": CPU time budget exceeded: "
+				<< duration_cast<milliseconds>(cpuTime).count() << " ms > "
+				<< duration_cast<milliseconds>(testCase->budget_m).count() << " ms\n";
+			testCase->report(oss.str());
+		}
+	}
+
+
+
+	/*!	Writes every case's results, one CSV row per case in execution order.
+
+		Columns: case, elapsed_ns, cpu_ns, budget_ns, checked, passed, weight, group
+		The group is last as it is free text.
+	*/
+	void TestApp::write_times(std::filesystem::path const& path) {
+		ofstream_type file(path);
+		if (!file)
+			throw std::runtime_error("Could not open: "s + path.string());
+
+		file << "case,elapsed_ns,cpu_ns,budget_ns,checked,passed,weight,group\n";
+		for (auto& testCaseGroup : cases())
+			for (auto& testCase : testCaseGroup.second)
+				file << testCase->name_m
+					<< ',' << testCase->elapsedTime_m.count()
+					<< ',' << testCase->cpuTime_m.load()
+					<< ',' << testCase->budget_m.count()
+					<< ',' << testCase->nChecked_m
+					<< ',' << testCase->nPassed_m
+					<< ',' << testCase->weight_m
+					<< ',' << testCase->group_m << '\n';
+	}
+
+
+
+	/*!	Splits a CSV line on commas; the last field keeps any commas of its own. */
+	static vector<TestApp::string_type> split_fields(TestApp::string_type const& line, size_t nFields) {
+		vector<TestApp::string_type> fields;
+		size_t begin = 0;
+		for (size_t end; fields.size() + 1 < nFields && (end = line.find(',', begin)) != TestApp::string_type::npos; begin = end + 1)
+			fields.push_back(line.substr(begin, end - begin));
+		fields.push_back(line.substr(begin));
+		return fields;
+	}
+
+
+
+	/*!	Reads the case times of a results file written by write_times(), in any column order.
+		The time is taken from cpu_ns, or from elapsed_ns in a file written before CPU times were kept.
+		Lines with the wrong number of fields or a time that is not a non-negative integer are skipped
+		and their numbers returned; a header without the case and time columns makes line 1 bad.
+	*/
+	TestApp::Baseline TestApp::read_baseline(istream_type& in) {
+		Baseline baseline;
+		string_type line;
+		if (!getline(in, line)) {
+			baseline.badLines_m.push_back(1);
+			return baseline;
+		}
+		if (line.ends_with('\r'))
+			line.pop_back();
+		auto const header = split_fields(line, string_type::npos);
+		auto const column = [&](char const* name) { return size_t(find(header.begin(), header.end(), name) - header.begin()); };
+		size_t const caseColumn = column("case");
+		size_t const timeColumn = column("cpu_ns") < header.size() ? column("cpu_ns") : column("elapsed_ns");
+		if (caseColumn >= header.size() || timeColumn >= header.size()) {
+			baseline.badLines_m.push_back(1);
+			return baseline;
+		}
+
+		for (size_t lineNumber = 2; getline(in, line); ++lineNumber) {
+			if (line.ends_with('\r'))
+				line.pop_back();
+			if (line.empty())
+				continue;
+			auto const fields = split_fields(line, header.size());
+			nanoseconds::rep ns = -1;
+			if (fields.size() == header.size() && !fields[caseColumn].empty()) {
+				auto const& text = fields[timeColumn];
+				auto const [end, ec] = from_chars(text.data(), text.data() + text.size(), ns);
+				if (ec != errc() || end != text.data() + text.size())
+					ns = -1;
+			}
+			if (ns < 0)
+				baseline.badLines_m.push_back(lineNumber);
+			else
+				baseline.times_m[fields[caseColumn]] = nanoseconds(ns);
+		}
+		return baseline;
+	}
+
+
+
+	/*!	The cases of 'times' that used more than 'slowdownPercent' more CPU time than in 'baseline', in the order of 'times'.
+		Cases missing from the baseline, or faster there than minimumComparedTime_c, are not compared.
+	*/
+	TestApp::Comparison TestApp::compare_times(map<string_type, nanoseconds> const& baseline,
+		vector<pair<string_type, nanoseconds>> const& times, double slowdownPercent) {
+		Comparison comparison;
+		for (auto const& [name, time] : times) {
+			auto found = baseline.find(name);
+			if (found == baseline.end() || found->second < minimumComparedTime_c)
+				continue;
+
+			++comparison.nCompared_m;
+			double change = 100.0 * (double(time.count()) / double(found->second.count()) - 1.0);
+			if (change > slowdownPercent)
+				comparison.slower_m.push_back({ name, found->second, time, change });
+		}
+		return comparison;
+	}
+
+
+
+	/*!	Reports the cases that used more than 'slowdownPercent' more CPU time than in the baseline results file.
+		Baseline lines that cannot be read are reported and skipped.
+	*/
+	void TestApp::compare_times(std::filesystem::path const& baselinePath, double slowdownPercent) {
+		std::ifstream file(baselinePath);
+		if (!file)
+			throw std::runtime_error("Could not open baseline: "s + baselinePath.string());
+		auto const [baseline, badLines] = read_baseline(file);
+
+		ostringstream_type oss;
+		oss << setprecision(1) << fixed;
+		if (!badLines.empty()) {
+			oss << "Skipped " << badLines.size() << " malformed line(s) of " << baselinePath.filename().string() << ':';
+			for (auto lineNumber : badLines)
+				oss << ' ' << lineNumber;
+			oss << '\n';
+		}
+		vector<pair<string_type, nanoseconds>> times;
+		for (auto& testCaseGroup : cases())
+			for (auto& testCase : testCaseGroup.second)
+				times.emplace_back(testCase->name_m, nanoseconds(testCase->cpuTime_m.load()));
+		auto const comparison = compare_times(baseline, times, slowdownPercent);
+		for (auto const& slower : comparison.slower_m)
+			oss << "Slower: " << slower.name_m << ' '
+				<< duration_cast<microseconds>(slower.baseline_m).count() / 1000.0 << " ms -> "
+				<< duration_cast<microseconds>(slower.time_m).count() / 1000.0 << " ms (+"
+				<< slower.percent_m << "%)\n";
+		oss << comparison.slower_m.size() << "/" << comparison.nCompared_m << " cases slower than " << baselinePath.filename().string()
+			<< " by more than " << slowdownPercent << "%\n";
+
+		display() << oss.str();
+		logFile_m << oss.str();
+	}
+
+
+
+	/*!	Writes every case's hardware counters and the derived rates per check, one CSV row per case.
+
+		Columns: case, checked, the raw counts, ipc, the miss counts per check, group
+		A counter the platform does not provide is left empty.
+	*/
+	void TestApp::write_counters(std::filesystem::path const& path) {
+		ofstream_type file(path);
+		if (!file)
+			throw std::runtime_error("Could not open: "s + path.string());
+
+		constexpr PerfCounters::counter misses[] = { PerfCounters::branch_misses, PerfCounters::l1d_misses, PerfCounters::llc_misses, PerfCounters::dtlb_misses };
+
+		file << "case,checked";
+		for (size_t c = 0; c < PerfCounters::count_c; ++c)
+			file << ',' << PerfCounters::name(PerfCounters::counter(c));
+		file << ",ipc";
+		for (auto c : misses)
+			file << ',' << PerfCounters::name(c) << "_per_check";
+		file << ",group\n";
+
+		PerfCounters::Sample available;
+		for (auto& testCaseGroup : cases()) {
+			for (auto& testCase : testCaseGroup.second) {
+				auto const& counters = testCase->counters_m;
+				available += counters;
+				double const nChecked = double(testCase->nChecked_m);
+
+				file << testCase->name_m << ',' << testCase->nChecked_m;
+				for (size_t c = 0; c < PerfCounters::count_c; ++c) {
+					file << ',';
+					if (counters.valid[c])
+						file << counters.values[c];
+				}
+				file << ',';
+				if (counters.valid[PerfCounters::cycles] && counters.valid[PerfCounters::instructions])
+					file << setprecision(3) << fixed << counters.ipc();
+				for (auto c : misses) {
+					file << ',';
+					if (counters.valid[c])
+						file << setprecision(4) << fixed << counters.per(c, nChecked);
+				}
+				file << ',' << testCase->group_m << '\n';
+			}
+		}
+
+		ostringstream_type oss;
+		oss << "Hardware counters written to " << path.string();
+		string_type unavailable;
+		for (size_t c = 0; c < PerfCounters::count_c; ++c)
+			if (!available.valid[c])
+				unavailable += (unavailable.empty() ? "" : ", ") + string_type(PerfCounters::name(PerfCounters::counter(c)));
+		if (!unavailable.empty())
+			oss << " (unavailable: " << unavailable << ")";
+		oss << '\n';
+		display() << oss.str();
+		logFile_m << oss.str();
+	}
+
+} // end-of-namespace gats
@@ -0,0 +1,155 @@
+/*!	\file	ThreadPool.cpp
+	\brief	Work-stealing thread pool implementation.
+	\date	2026-10-18
+
+=============================================================
+Work-stealing thread pool implementation.
+	gats::ThreadPool
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.18
+	Initial release.
+
+=============================================================*/
+
+
+#include <gats/ThreadPool.hpp>
+
+
+namespace gats {
+
+	thread_local ThreadPool*	ThreadPool::currentPool_sm = nullptr;
+	thread_local unsigned		ThreadPool::workerIndex_sm = 0;
+
+
+
+	/*!	Start 'nThreads' workers (0 = one per hardware thread). */
+	ThreadPool::ThreadPool(unsigned nThreads) {
+		if (nThreads == 0)
+			nThreads = std::max(1u, std::thread::hardware_concurrency());
+
+		for (unsigned i = 0; i < nThreads; ++i)
+			queues_m.push_back(std::make_unique<Queue>());
+		for (unsigned i = 0; i < nThreads; ++i)
+			workers_m.emplace_back([this, i] { worker_loop(i); });
+	}
+
+
+
+	/*!	Finish the queued tasks and join the workers. */
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard lock(wakeMutex_m);
+			stopping_m = true;
+		}
+		wake_m.notify_all();
+		workers_m.clear();
+	}
+
+
+
+	/*!	Queue a task.  A worker queues onto its own deque; other threads spread tasks round-robin. */
+	void ThreadPool::submit(task_type task) {
+		unsigned const index = currentPool_sm == this
+			? workerIndex_sm
+			: nextQueue_m.fetch_add(1, std::memory_order_relaxed) % size();
+		{
+			std::lock_guard lock(queues_m[index]->mutex_m);
+			queues_m[index]->tasks_m.push_back(std::move(task));
+		}
+		{
+			std::lock_guard lock(wakeMutex_m);
+			++nQueued_m;
+		}
+		wake_m.notify_one();
+	}
+
+
+
+	/*!	Queue a parallel_for() helper on the shared queue, ahead of every queued task. */
+	void ThreadPool::submit_helper(task_type task) {
+		{
+			std::lock_guard lock(helpers_m.mutex_m);
+			helpers_m.tasks_m.push_back(std::move(task));
+		}
+		{
+			std::lock_guard lock(wakeMutex_m);
+			++nQueued_m;
+		}
+		wake_m.notify_one();
+	}
+
+
+
+	/*!	Take a task: the oldest loop helper, else the newest of the calling worker's own deque, else the oldest of another. */
+	bool ThreadPool::try_pop(task_type& task) {
+		bool const isWorker = currentPool_sm == this;
+		unsigned const self = isWorker ? workerIndex_sm : 0;
+
+		{
+			std::lock_guard lock(helpers_m.mutex_m);
+			if (!helpers_m.tasks_m.empty()) {
+				task = std::move(helpers_m.tasks_m.front());
+				helpers_m.tasks_m.pop_front();
+				--nQueued_m;
+				return true;
+			}
+		}
+
+		if (isWorker) {
+			auto& own = *queues_m[self];
+			std::lock_guard lock(own.mutex_m);
+			if (!own.tasks_m.empty()) {
+				task = std::move(own.tasks_m.back());
+				own.tasks_m.pop_back();
+				--nQueued_m;
+				return true;
+			}
+		}
+
+		for (unsigned offset = isWorker ? 1 : 0; offset < size(); ++offset) {
+			auto& victim = *queues_m[(self + offset) % size()];
+			std::lock_guard lock(victim.mutex_m);
+			if (!victim.tasks_m.empty()) {
+				task = std::move(victim.tasks_m.front());
+				victim.tasks_m.pop_front();
+				--nQueued_m;
+				return true;
+			}
+		}
+		return false;
+	}
+
+
+
+	/*!	Run one queued task on the calling thread.  Returns false if none was queued. */
+	bool ThreadPool::run_pending_task() {
+		task_type task;
+		if (!try_pop(task))
+			return false;
+		task();
+		return true;
+	}
+
+
+
+	/*!	Worker thread body: run tasks until the pool is stopping and no task is queued. */
+	void ThreadPool::worker_loop(unsigned index) {
+		currentPool_sm = this;
+		workerIndex_sm = index;
+
+		for (;;) {
+			if (run_pending_task())
+				continue;
+
+			std::unique_lock lock(wakeMutex_m);
+			wake_m.wait(lock, [this] { return stopping_m || nQueued_m > 0; });
+			if (stopping_m && nQueued_m == 0)
+				return;
+		}
+	}
+
+} // end-of-namespace gats